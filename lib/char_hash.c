@@ -28,138 +28,180 @@
 #include "uniquestr.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <limits.h>
 #include <string.h>
-#include <math.h>
 
 #include "mem.h"
+#include "mem_arena.h"
 
-typedef struct string_link_tag string_link_t;
+// Open addressing (linear probing) hash table of strings. The hash and the
+// length of every string are kept in the slot so most mismatches are
+// discarded without touching the string. The bytes of the strings are kept
+// in an arena since they are never released.
 
-struct string_link_tag
+typedef
+struct string_slot_tag
 {
-    unsigned int hash;
     const char *string;
-    string_link_t *next;
-};
+    uint32_t hash;
+    uint32_t length;
+} string_slot_t;
 
-enum { HASH_LENGTH = 76003 };
+enum { INITIAL_TABLE_SIZE = 16384 };
+enum { STRING_ARENA_CHUNK_SIZE = 256 * 1024 };
 
-static string_link_t *hash_table[HASH_LENGTH];
-static unsigned long long int bytes_used = 0;
+static string_slot_t *string_table = NULL;
+static uint32_t string_table_size = 0;
+static uint32_t string_table_items = 0;
+
+static mem_arena_t *string_arena = NULL;
 
 unsigned long long int char_trie_used_memory(void)
 {
-    return bytes_used;
+    unsigned long long int result = string_table_size * sizeof(string_slot_t);
+    if (string_arena != NULL)
+    {
+        mem_arena_stats_t stats;
+        mem_arena_get_stats(string_arena, &stats);
+        result += stats.bytes_reserved;
+    }
+    return result;
 }
 
-static unsigned int hash_string(const char *string)
+// FNV-1a
+static inline uint32_t hash_string_n(const char *string, size_t length)
 {
-    unsigned int hash = 0;
-    const char *p;
+    uint32_t hash = 2166136261U;
 
-    for (p = string; *p; p++)
-        hash = ((hash << 5) + hash) ^ *p;
+    size_t i;
+    for (i = 0; i < length; i++)
+    {
+        hash ^= (unsigned char)string[i];
+        hash *= 16777619U;
+    }
 
     return hash;
 }
 
-const char *uniquestr(const char *string)
+static void init_string_table(void)
+{
+    string_table_size = INITIAL_TABLE_SIZE;
+    string_table = NEW_VEC0(string_slot_t, string_table_size);
+    string_arena = mem_arena_new(STRING_ARENA_CHUNK_SIZE);
+}
+
+static void grow_string_table(void)
+{
+    string_slot_t *old_table = string_table;
+    uint32_t old_size = string_table_size;
+
+    string_table_size = old_size * 2;
+    string_table = NEW_VEC0(string_slot_t, string_table_size);
+
+    uint32_t mask = string_table_size - 1;
+    uint32_t i;
+    for (i = 0; i < old_size; i++)
+    {
+        if (old_table[i].string == NULL)
+            continue;
+
+        uint32_t idx = old_table[i].hash & mask;
+        while (string_table[idx].string != NULL)
+            idx = (idx + 1) & mask;
+
+        string_table[idx] = old_table[i];
+    }
+
+    DELETE(old_table);
+}
+
+const char *uniquestr_n(const char *string, size_t length)
 {
     if (string == NULL)
         return NULL;
 
-    unsigned int hash = hash_string(string);
-    unsigned int hash_index = hash % (sizeof(hash_table) / sizeof(hash_table[0]));
-    string_link_t *p, *p_prev = 0, *new_link;
+    if (string_table == NULL)
+        init_string_table();
+
+    uint32_t hash = hash_string_n(string, length);
+    uint32_t mask = string_table_size - 1;
+    uint32_t idx = hash & mask;
 
-    for (p = hash_table[hash_index]; p; p_prev = p, p = p->next)
+    while (string_table[idx].string != NULL)
     {
-        if (p->hash == hash && !strcmp(p->string, string))
+        if (string_table[idx].hash == hash
+                && string_table[idx].length == length
+                && memcmp(string_table[idx].string, string, length) == 0)
         {
-            if (p != hash_table[hash_index])
-            {
-                p_prev->next = p->next;
-                p->next = hash_table[hash_index];
-                hash_table[hash_index] = p;
-            }
-
-            return p->string;
+            return string_table[idx].string;
         }
+        idx = (idx + 1) & mask;
     }
 
-    bytes_used += sizeof(string_link_t) + strlen(string) + 1;
+    char *new_string = mem_arena_alloc(string_arena, length + 1);
+    memcpy(new_string, string, length);
+    new_string[length] = '\0';
 
-    new_link = NEW(string_link_t);
-    new_link->string = xstrdup(string); 
-    new_link->hash = hash; 
-    new_link->next = hash_table[hash_index];
-    hash_table[hash_index] = new_link; 
+    string_table[idx].string = new_string;
+    string_table[idx].hash = hash;
+    string_table[idx].length = length;
+    string_table_items++;
 
-    return new_link->string;
+    // Keep the load factor below 0.7
+    if (string_table_items * 10 > string_table_size * 7)
+        grow_string_table();
+
+    return new_string;
+}
+
+const char *uniquestr(const char *string)
+{
+    if (string == NULL)
+        return NULL;
+
+    return uniquestr_n(string, strlen(string));
 }
 
 void uniquestr_stats(void)
 {
-    unsigned long long bucket_length[HASH_LENGTH];
     unsigned long long number_of_strings = 0;
     unsigned long long number_of_bytes = 0;
+    unsigned long long sum_probes = 0;
+    unsigned long long max_probes = 0;
 
-    int i, j;
-    for (i = 0; i < HASH_LENGTH; i++)
-    {
-        string_link_t *p = hash_table[i];
-
-        j = 0;
-        while (p != NULL)
-        {
-            // fprintf(stderr, "%d.%d |%s|\n", i, j, p->string);
-            number_of_strings++;
-            number_of_bytes += strlen(p->string) + 1; // +1 for NULL
-
-            p = p->next;
-            j++;
-        }
-
-        bucket_length[i] = j;
-    }
-
-    unsigned long long max_bucket = 0;
-    unsigned long long min_bucket = ULLONG_MAX;
-    unsigned long long sum_buckets = 0;
-    unsigned long long num_empty_buckets = 0;
-
-    for (i = 0; i < HASH_LENGTH; i++)
+    uint32_t mask = string_table_size - 1;
+    uint32_t i;
+    for (i = 0; i < string_table_size; i++)
     {
-        if (bucket_length[i] >= max_bucket)
-            max_bucket = bucket_length[i];
-        if (bucket_length[i] <= min_bucket)
-            min_bucket = bucket_length[i];
+        if (string_table[i].string == NULL)
+            continue;
 
-        sum_buckets += bucket_length[i];
+        number_of_strings++;
+        number_of_bytes += string_table[i].length + 1; // +1 for NULL
 
-        num_empty_buckets += (bucket_length[i] == 0);
+        // Distance from the home slot
+        unsigned long long probes = ((i - (string_table[i].hash & mask)) & mask) + 1;
+        sum_probes += probes;
+        if (probes > max_probes)
+            max_probes = probes;
     }
 
-    float avg_bucket = 0.0f;
-    avg_bucket = ((float)sum_buckets / (float)HASH_LENGTH);
-
-    float stddev_bucket = 0.0f;
-    for (i = 0; i < HASH_LENGTH; i++)
-    {
-        stddev_bucket += fabsf(bucket_length[i] - avg_bucket);
-    }
-    stddev_bucket = sqrtf(stddev_bucket / (float)(HASH_LENGTH - 1));
+    float load_factor = 0.0f;
+    float avg_probes = 0.0f;
+    if (string_table_size > 0)
+        load_factor = (float)number_of_strings / (float)string_table_size;
+    if (number_of_strings > 0)
+        avg_probes = (float)sum_probes / (float)number_of_strings;
 
     fprintf(stderr, "String table statistics\n");
     fprintf(stderr, "=======================\n\n");
 
-    fprintf(stderr, "Size of hash: %d\n", HASH_LENGTH);
+    fprintf(stderr, "Size of hash: %u\n", string_table_size);
     fprintf(stderr, "Number of strings: %llu\n", number_of_strings);
     fprintf(stderr, "Number of bytes taken by the strings: %llu\n", number_of_bytes);
-    fprintf(stderr, "Number of empty buckets: %llu\n", num_empty_buckets);
-    fprintf(stderr, "Minimum bucket length: %llu\n", min_bucket);
-    fprintf(stderr, "Maximum bucket length: %llu\n", max_bucket);
-    fprintf(stderr, "Average bucket length: %.2f\n", avg_bucket);
-    fprintf(stderr, "StdDev  bucket length: %.2f\n", stddev_bucket);
+    fprintf(stderr, "Total memory used by the string table: %llu\n", char_trie_used_memory());
+    fprintf(stderr, "Load factor: %.2f\n", load_factor);
+    fprintf(stderr, "Average probe length: %.2f\n", avg_probes);
+    fprintf(stderr, "Maximum probe length: %llu\n", max_probes);
 }
@@ -31,180 +31,138 @@
 #include "dhash_ptr.h"
 #include "mem.h"
 
+// Open addressing hash table with linear probing. Keys and values are kept
+// inline in the slots.
+//
+// Most of the tables (e.g. the ones of block scopes) only hold a few items,
+// so tables start in a small mode where the items are kept in an inline
+// array that is searched linearly. Once it overflows, a slot array is
+// allocated.
+
 typedef
-struct bucket_ptr_tag
+struct dhash_ptr_slot_tag
 {
     const char* key;
     dhash_ptr_info_t info;
-    struct bucket_ptr_tag* next;
-} bucket_ptr_t;
-
-enum { MAX_BUCKET_SIZE = 76003 };
-const static int prime_set[] = { 5, 11, 23, 53, 131, 317, 787, 1951, 4877, 12163, 30403, MAX_BUCKET_SIZE };
-const static int last_prime = (sizeof(prime_set) / sizeof(prime_set[0])) - 1;
-
-#ifdef __GNUC__
-  #if __GNUC__ == 4
-     #if __GNUC_MINOR__ >= 6
-       #define STATIC_INLINE static inline
-     #else
-       // This is a workaround for GCC 4.4 generating wrong code
-       #define STATIC_INLINE static
-     #endif
-  #else
-     #define STATIC_INLINE static inline
-  #endif
-#else
-   #define STATIC_INLINE static inline
-#endif
-
-STATIC_INLINE uint32_t Murmur3_32(const char* ptr);
+} dhash_ptr_slot_t;
+
+enum { NUM_INLINE_SLOTS = 3 };
+enum { MIN_NUM_SLOTS = 8 };
 
 struct dhash_ptr_tag
 {
-    bucket_ptr_t **buckets;
-    int num_buckets_idx;
-    int num_items;
+    // NULL while in small mode
+    dhash_ptr_slot_t* slots;
+    // Always a power of two (when slots != NULL)
+    uint32_t num_slots;
+    uint32_t num_items;
+    // Number of slots used when leaving small mode
+    uint32_t initial_num_slots;
+
+    dhash_ptr_slot_t inline_slots[NUM_INLINE_SLOTS];
 };
 
+static inline uint32_t hash_ptr(const char* ptr)
+{
+    uint64_t h = (uint64_t)(uintptr_t)ptr;
+
+    // Final mix of MurmurHash3
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+
+    return (uint32_t)h;
+}
+
+static inline char is_small(dhash_ptr_t* dhash)
+{
+    return dhash->slots == NULL;
+}
+
 dhash_ptr_t* dhash_ptr_new(int initial_size)
 {
     if (initial_size < 0) abort();
 
-    dhash_ptr_t* result = NEW(dhash_ptr_t);
-
-    result->num_items = 0;
+    dhash_ptr_t* result = NEW0(dhash_ptr_t);
 
-    if (initial_size >= MAX_BUCKET_SIZE)
+    // Keep the load factor under the limit for the requested size
+    uint32_t initial_num_slots = MIN_NUM_SLOTS;
+    while (initial_num_slots < ((uint32_t)initial_size * 10) / 7)
     {
-        result->num_buckets_idx = last_prime;
+        initial_num_slots *= 2;
     }
-    else
-    {
-        // Round to next prime
-        result->num_buckets_idx = 0;
-        while (prime_set[result->num_buckets_idx] < initial_size)
-        {
-            result->num_buckets_idx++;
-        }
-    }
-
-    result->buckets = NEW_VEC0(bucket_ptr_t*, prime_set[result->num_buckets_idx]);
+    result->initial_num_slots = initial_num_slots;
 
     return result;
 }
 
-static void free_bucket_list(bucket_ptr_t* bucket)
+void dhash_ptr_destroy(dhash_ptr_t* dhash)
 {
-    if (bucket == NULL)
-        return;
-
-    free_bucket_list(bucket->next);
-    xfree(bucket);
+    xfree(dhash->slots);
+    xfree(dhash);
 }
 
-void dhash_ptr_destroy(dhash_ptr_t* dhash)
+// Returns the slot of key or the empty slot where it should be inserted
+static inline uint32_t dhash_ptr_find_slot(dhash_ptr_t* dhash, const char* key)
 {
-    int num_buckets = prime_set[dhash->num_buckets_idx];
+    uint32_t mask = dhash->num_slots - 1;
+    uint32_t idx = hash_ptr(key) & mask;
 
-    int i;
-    for (i = 0; i < num_buckets; i++)
+    while (dhash->slots[idx].key != NULL
+            && dhash->slots[idx].key != key)
     {
-        free_bucket_list(dhash->buckets[i]);
+        idx = (idx + 1) & mask;
     }
 
-    xfree(dhash->buckets);
-    xfree(dhash);
+    return idx;
 }
 
 void* dhash_ptr_query(dhash_ptr_t* dhash, const char* key)
 {
     if (key == NULL) abort();
 
-    int num_buckets = prime_set[dhash->num_buckets_idx];
-    uint32_t hash = Murmur3_32(key) % num_buckets;
-
-    bucket_ptr_t* b = dhash->buckets[hash];
-    while (b != NULL)
+    if (is_small(dhash))
     {
-        if (b->key == key)
+        uint32_t i;
+        for (i = 0; i < dhash->num_items; i++)
         {
-            return b->info;
+            if (dhash->inline_slots[i].key == key)
+                return dhash->inline_slots[i].info;
         }
-        b = b->next;
+        return NULL;
     }
 
-    return NULL;
+    return dhash->slots[dhash_ptr_find_slot(dhash, key)].info;
 }
 
-
-static void dhash_ptr_do_insert(dhash_ptr_t* dhash, const char* key, dhash_ptr_info_t info)
+static void dhash_ptr_rehash(dhash_ptr_t* dhash, uint32_t new_num_slots)
 {
-    int num_buckets = prime_set[dhash->num_buckets_idx];
-    uint32_t hash = Murmur3_32(key) % num_buckets;
-
-    bucket_ptr_t* b = dhash->buckets[hash];
+    dhash_ptr_slot_t* old_slots = dhash->slots;
+    uint32_t num_old_slots = dhash->num_slots;
 
-    while (b != NULL)
+    if (old_slots == NULL)
     {
-        if (b->key == key)
-        {
-            // Update
-            b->info = info;
-            return;
-        }
-        b = b->next;
+        // Leaving small mode
+        old_slots = dhash->inline_slots;
+        num_old_slots = dhash->num_items;
     }
 
-    // Insert
-    b = NEW(bucket_ptr_t);
-    b->key = key;
-    b->info = info;
-    b->next = dhash->buckets[hash];
-    dhash->buckets[hash] = b;
-
-    dhash->num_items++;
-}
+    dhash->slots = NEW_VEC0(dhash_ptr_slot_t, new_num_slots);
+    dhash->num_slots = new_num_slots;
 
-static void dhash_ptr_increase_rehash(dhash_ptr_t* dhash)
-{
-    // Do not rehash anymore
-    if (dhash->num_buckets_idx == last_prime)
-        return;
-
-    int num_old_buckets = prime_set[dhash->num_buckets_idx];
-    bucket_ptr_t **old_buckets = dhash->buckets;
-
-    dhash->num_buckets_idx++;
-    int num_new_buckets = prime_set[dhash->num_buckets_idx];
-    bucket_ptr_t **new_buckets = NEW_VEC0(bucket_ptr_t*, num_new_buckets);
-
-    int i;
-    for (i = 0; i < num_old_buckets; i++)
+    uint32_t i;
+    for (i = 0; i < num_old_slots; i++)
     {
-        bucket_ptr_t* old_b = old_buckets[i];
-
-        while (old_b != NULL)
-        {
-            uint32_t new_hash = Murmur3_32(old_b->key) % num_new_buckets;
-
-            bucket_ptr_t* new_b = NEW(bucket_ptr_t);
-            new_b->key = old_b->key;
-            new_b->info = old_b->info;
-            new_b->next = new_buckets[new_hash];
-            new_buckets[new_hash] = new_b;
+        if (old_slots[i].key == NULL)
+            continue;
 
-            old_b = old_b->next;
-        }
+        dhash->slots[dhash_ptr_find_slot(dhash, old_slots[i].key)] = old_slots[i];
     }
 
-    for (i = 0; i < num_old_buckets; i++)
-    {
-        free_bucket_list(old_buckets[i]);
-    }
-    xfree(old_buckets);
-
-    dhash->buckets = new_buckets;
+    if (old_slots != dhash->inline_slots)
+        xfree(old_slots);
 }
 
 void dhash_ptr_insert(dhash_ptr_t* dhash, const char* key, dhash_ptr_info_t info)
@@ -212,112 +170,119 @@ void dhash_ptr_insert(dhash_ptr_t* dhash, const char* key, dhash_ptr_info_t info
     if (key == NULL) abort();
     if (info == NULL) abort();
 
-    int num_buckets = prime_set[dhash->num_buckets_idx];
-    if (((num_buckets * 3) / 4) < dhash->num_items)
+    if (is_small(dhash))
+    {
+        uint32_t i;
+        for (i = 0; i < dhash->num_items; i++)
+        {
+            if (dhash->inline_slots[i].key == key)
+            {
+                // Update
+                dhash->inline_slots[i].info = info;
+                return;
+            }
+        }
+
+        if (dhash->num_items < NUM_INLINE_SLOTS)
+        {
+            dhash->inline_slots[dhash->num_items].key = key;
+            dhash->inline_slots[dhash->num_items].info = info;
+            dhash->num_items++;
+            return;
+        }
+
+        dhash_ptr_rehash(dhash, dhash->initial_num_slots);
+    }
+    else if ((dhash->num_items + 1) * 10 > dhash->num_slots * 7)
     {
-        dhash_ptr_increase_rehash(dhash);
+        dhash_ptr_rehash(dhash, dhash->num_slots * 2);
     }
 
-    dhash_ptr_do_insert(dhash, key, info);
+    uint32_t idx = dhash_ptr_find_slot(dhash, key);
+    if (dhash->slots[idx].key == NULL)
+    {
+        // Insert
+        dhash->slots[idx].key = key;
+        dhash->num_items++;
+    }
+    dhash->slots[idx].info = info;
 }
 
 void dhash_ptr_remove(dhash_ptr_t* dhash, const char* key)
 {
     if (key == NULL) abort();
 
-    int num_buckets = prime_set[dhash->num_buckets_idx];
-    uint32_t hash = Murmur3_32(key) % num_buckets;
+    if (is_small(dhash))
+    {
+        uint32_t i;
+        for (i = 0; i < dhash->num_items; i++)
+        {
+            if (dhash->inline_slots[i].key == key)
+            {
+                dhash->num_items--;
+                dhash->inline_slots[i] = dhash->inline_slots[dhash->num_items];
+                dhash->inline_slots[dhash->num_items].key = NULL;
+                dhash->inline_slots[dhash->num_items].info = NULL;
+                return;
+            }
+        }
+        // Not found
+        return;
+    }
 
-    bucket_ptr_t** b = &(dhash->buckets[hash]);
+    uint32_t mask = dhash->num_slots - 1;
+    uint32_t i = dhash_ptr_find_slot(dhash, key);
+    if (dhash->slots[i].key == NULL)
+    {
+        // Not found
+        return;
+    }
 
-    while ((*b) != NULL)
+    // Backward shift deletion: move back the items of the probe sequence
+    // that follows the removed item so no tombstones are needed
+    uint32_t j = i;
+    for (;;)
     {
-        if ((*b)->key == key)
+        j = (j + 1) & mask;
+        if (dhash->slots[j].key == NULL)
+            break;
+
+        uint32_t home = hash_ptr(dhash->slots[j].key) & mask;
+
+        // Move the item unless its home is cyclically in (i, j]
+        char home_in_range = (i <= j)
+            ? (i < home && home <= j)
+            : (i < home || home <= j);
+        if (!home_in_range)
         {
-            bucket_ptr_t* current = *b;
-            *b = (*b)->next;
-            xfree(current);
-            dhash->num_items--;
-            return;
+            dhash->slots[i] = dhash->slots[j];
+            i = j;
         }
-        b = &((*b)->next);
     }
 
-    // Not found
+    dhash->slots[i].key = NULL;
+    dhash->slots[i].info = NULL;
+    dhash->num_items--;
 }
 
 void dhash_ptr_walk(dhash_ptr_t* dhash, dhash_ptr_walk_fn walk_fn, void *walk_info)
 {
-    int num_buckets = prime_set[dhash->num_buckets_idx];
-
-    int i;
-    for (i = 0; i < num_buckets; i++)
+    if (is_small(dhash))
     {
-        bucket_ptr_t* b = dhash->buckets[i];
-        while (b != NULL)
+        uint32_t i;
+        for (i = 0; i < dhash->num_items; i++)
         {
-            walk_fn(b->key, b->info, walk_info);
-            b = b->next;
+            walk_fn(dhash->inline_slots[i].key, dhash->inline_slots[i].info, walk_info);
         }
+        return;
     }
-}
 
-// Hash function
-// Taken from wikipedia
-STATIC_INLINE uint32_t Murmur3_32(const char* ptr)
-{
-	static const uint32_t c1 = 0xcc9e2d51;
-	static const uint32_t c2 = 0x1b873593;
-	static const uint32_t r1 = 15;
-	static const uint32_t r2 = 13;
-	static const uint32_t m = 5;
-	static const uint32_t n = 0xe6546b64;
-
-    // Size of a pointer
-    uint32_t len = sizeof(ptr);
-    const char* key = (const char*)&ptr;
-
-	uint32_t hash = 0;
- 
-	uint32_t* keydata = (uint32_t*) key; //used to extract 32 bits at a time
-	int keydata_it = 0;
- 
-	while (len >= 4)
-	{
-		uint32_t k = keydata[keydata_it++];
-		len -= 4;
- 
-		k *= c1;
-		k = (k << r1) | (k >> (32-r1));
-		k *= c2;
- 
-		hash ^= k;
-		hash = ((hash << r2) | (hash >> (32-r2)) * m) + n;
-	}
- 
-	const uint8_t * tail = (const uint8_t*)(keydata + keydata_it*4);
-	uint32_t k1 = 0;
- 
-	switch(len & 3) {
-	case 3:
-		k1 ^= tail[2] << 16;
-	case 2:
-		k1 ^= tail[1] << 8;
-	case 1:
-		k1 ^= tail[0];
- 
-		k1 *= c1;
-		k1 = (k1 << r1) | (k1 >> (32-r1));
-		k1 *= c2;
-		hash ^= k1;
-	}
- 
-	hash ^= len;
-	hash ^= (hash >> 16);
-	hash *= 0x85ebca6b;
-	hash ^= (hash >> 13);
-	hash *= 0xc2b2ae35;
-	hash ^= (hash >> 16);
- 
-	return hash;
+    uint32_t i;
+    for (i = 0; i < dhash->num_slots; i++)
+    {
+        if (dhash->slots[i].key != NULL)
+        {
+            walk_fn(dhash->slots[i].key, dhash->slots[i].info, walk_info);
+        }
+    }
 }
@@ -28,7 +28,7 @@
 #ifndef DHASH_PTR_H
 #define DHASH_PTR_H
 
-// Hash for strings
+// Hash for pointers
 
 #ifdef __cplusplus
 extern "C" {
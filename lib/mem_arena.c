@@ -0,0 +1,161 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mem_arena.h"
+#include "mem.h"
+
+typedef
+struct mem_arena_chunk_tag
+{
+    struct mem_arena_chunk_tag* next;
+    size_t size;
+} mem_arena_chunk_t;
+
+enum { DEFAULT_CHUNK_SIZE = 1024 * 1024 };
+enum { ARENA_ALIGNMENT = 2 * sizeof(void*) };
+
+#define ALIGN_UP(x) (((x) + (ARENA_ALIGNMENT - 1)) & ~((size_t)ARENA_ALIGNMENT - 1))
+
+struct mem_arena_tag
+{
+    // First chunk is the one being used for small allocations
+    mem_arena_chunk_t* chunks;
+
+    char* top;
+    char* end;
+
+    size_t chunk_size;
+
+    mem_arena_stats_t stats;
+};
+
+mem_arena_t* mem_arena_new(size_t chunk_size)
+{
+    if (chunk_size == 0)
+        chunk_size = DEFAULT_CHUNK_SIZE;
+
+    mem_arena_t* result = NEW0(mem_arena_t);
+    result->chunk_size = chunk_size;
+
+    return result;
+}
+
+void mem_arena_destroy(mem_arena_t* arena)
+{
+    if (arena == NULL)
+        return;
+
+    mem_arena_chunk_t* chunk = arena->chunks;
+    while (chunk != NULL)
+    {
+        mem_arena_chunk_t* next = chunk->next;
+        xfree(chunk);
+        chunk = next;
+    }
+
+    xfree(arena);
+}
+
+static mem_arena_chunk_t* mem_arena_new_chunk(mem_arena_t* arena, size_t size)
+{
+    size_t total_size = ALIGN_UP(sizeof(mem_arena_chunk_t)) + size;
+    mem_arena_chunk_t* chunk = (mem_arena_chunk_t*)xmalloc(total_size);
+    chunk->next = NULL;
+    chunk->size = total_size;
+
+    arena->stats.num_chunks++;
+    arena->stats.bytes_reserved += total_size;
+
+    return chunk;
+}
+
+static inline char* mem_arena_chunk_start(mem_arena_chunk_t* chunk)
+{
+    return (char*)chunk + ALIGN_UP(sizeof(mem_arena_chunk_t));
+}
+
+void* mem_arena_alloc(mem_arena_t* arena, size_t size)
+{
+    if (size == 0)
+        return NULL;
+
+    size = ALIGN_UP(size);
+
+    arena->stats.num_allocations++;
+    arena->stats.bytes_requested += size;
+
+    if ((size_t)(arena->end - arena->top) >= size)
+    {
+        void* p = arena->top;
+        arena->top += size;
+        return p;
+    }
+
+    if (size > arena->chunk_size / 4)
+    {
+        // Big allocations get their own chunk. Link it after the current one
+        // so we can keep using what remains of the latter
+        mem_arena_chunk_t* chunk = mem_arena_new_chunk(arena, size);
+        if (arena->chunks != NULL)
+        {
+            chunk->next = arena->chunks->next;
+            arena->chunks->next = chunk;
+        }
+        else
+        {
+            arena->chunks = chunk;
+        }
+        return mem_arena_chunk_start(chunk);
+    }
+
+    mem_arena_chunk_t* chunk = mem_arena_new_chunk(arena, arena->chunk_size);
+    chunk->next = arena->chunks;
+    arena->chunks = chunk;
+
+    arena->top = mem_arena_chunk_start(chunk);
+    arena->end = arena->top + arena->chunk_size;
+
+    void* p = arena->top;
+    arena->top += size;
+    return p;
+}
+
+void* mem_arena_calloc(mem_arena_t* arena, size_t nmemb, size_t size)
+{
+    void* p = mem_arena_alloc(arena, nmemb * size);
+    if (p != NULL)
+        memset(p, 0, nmemb * size);
+    return p;
+}
+
+void mem_arena_get_stats(mem_arena_t* arena, mem_arena_stats_t* stats)
+{
+    *stats = arena->stats;
+}
@@ -0,0 +1,73 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+#ifndef MEM_ARENA_H
+#define MEM_ARENA_H
+
+#include <stddef.h>
+#include "libutils-common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bump-pointer arena
+//
+// Memory obtained from an arena cannot be released individually. The whole
+// arena is released at once with mem_arena_destroy
+
+typedef struct mem_arena_tag mem_arena_t;
+
+typedef
+struct mem_arena_stats_tag
+{
+    // Number of calls to mem_arena_alloc
+    unsigned long long num_allocations;
+    // Bytes requested by the callers of mem_arena_alloc
+    unsigned long long bytes_requested;
+    // Bytes obtained from the system (including unused tails of the chunks)
+    unsigned long long bytes_reserved;
+    // Number of chunks obtained from the system
+    unsigned long long num_chunks;
+} mem_arena_stats_t;
+
+// A chunk_size of 0 means a sensible default
+LIBUTILS_EXTERN mem_arena_t* mem_arena_new(size_t chunk_size);
+LIBUTILS_EXTERN void mem_arena_destroy(mem_arena_t*);
+
+// Returned memory is suitably aligned for any object
+LIBUTILS_EXTERN void* mem_arena_alloc(mem_arena_t*, size_t size);
+// Like mem_arena_alloc but memory is zeroed
+LIBUTILS_EXTERN void* mem_arena_calloc(mem_arena_t*, size_t nmemb, size_t size);
+
+LIBUTILS_EXTERN void mem_arena_get_stats(mem_arena_t*, mem_arena_stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MEM_ARENA_H
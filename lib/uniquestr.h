@@ -31,6 +31,7 @@
 #define UNIQUESTR_H
 
 #include "libutils-common.h"
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -38,6 +39,9 @@ extern "C" {
 
 #define uniqstr uniquestr
 LIBUTILS_EXTERN const char *uniquestr(const char*);
+// Like uniquestr but only the first 'length' chars of the string are used.
+// The string does not have to be NULL-ended
+LIBUTILS_EXTERN const char *uniquestr_n(const char*, size_t length);
 
 #define UNIQUESTR_LITERAL(literal) \
   ({ static const char* _cached_uniquestr = NULL; \
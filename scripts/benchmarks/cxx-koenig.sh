@@ -0,0 +1,108 @@
+#!/usr/bin/env bash
+
+# Compares the time spent by the C++ frontend on an expression template
+# translation unit with and without the cache of associated namespaces of
+# argument dependent lookup (see the disable_koenig_cache debug flag).
+# Every operator of the expressions is found by argument dependent lookup on
+# template specializations with several template arguments.
+#
+# usage: cxx-koenig.sh [plaincxx] [functions] [terms]
+#
+#  plaincxx   C++ driver to use (default: plaincxx in PATH)
+#  functions  number of functions of the generated file (default: 2000)
+#  terms      number of operands of the expression of every function
+#             (default: 16)
+
+set -e
+
+PLAINCXX=${1:-plaincxx}
+FUNCTIONS=${2:-2000}
+TERMS=${3:-16}
+
+WORKDIR=$(mktemp -d)
+trap "rm -rf ${WORKDIR}" EXIT
+
+generate_file()
+{
+    local f=${WORKDIR}/expression_templates.cpp
+
+    cat > $f <<EOF
+namespace et
+{
+    namespace ops
+    {
+        struct plus { };
+        struct minus { };
+        struct times { };
+    }
+
+    template <typename Op, typename L, typename R, typename Tag = void, int Rank = 1>
+    struct expr
+    {
+        const L& l;
+        const R& r;
+        expr(const L& l_, const R& r_) : l(l_), r(r_) { }
+    };
+
+    template <typename T, int N, typename Tag = void>
+    struct vector
+    {
+        T v[N];
+    };
+
+    template <typename L, typename R>
+    expr<ops::plus, L, R> operator+(const L& l, const R& r) { return expr<ops::plus, L, R>(l, r); }
+    template <typename L, typename R>
+    expr<ops::minus, L, R> operator-(const L& l, const R& r) { return expr<ops::minus, L, R>(l, r); }
+    template <typename L, typename R>
+    expr<ops::times, L, R> operator*(const L& l, const R& r) { return expr<ops::times, L, R>(l, r); }
+
+    template <typename E>
+    void evaluate(const E&) { }
+}
+
+namespace user
+{
+    struct tag { };
+    typedef et::vector<double, 3, tag> vec;
+}
+EOF
+
+    awk -v functions=${FUNCTIONS} -v terms=${TERMS} '
+    BEGIN {
+        split("+ - *", op, " ");
+        for (n = 1; n <= functions; n++)
+        {
+            printf "void function_%d(", n;
+            for (i = 1; i <= terms; i++)
+                printf "%suser::vec& a%d", (i > 1) ? ", " : "", i;
+            printf ")\n{\n    evaluate(a1";
+            for (i = 2; i <= terms; i++)
+                printf " %s a%d", op[(n + i) % 3 + 1], i;
+            printf ");\n}\n";
+        }
+    }' >> $f
+
+    echo $f
+}
+
+run()
+{
+    local debug_flags=$1
+
+    local start=$(date +%s.%N)
+    ${PLAINCXX} -y --debug-flags=memory_report${debug_flags:+,$debug_flags} -c -o /dev/null ${FILE} 2>&1 \
+        | grep "Associated namespaces" || true
+    local end=$(date +%s.%N)
+
+    printf "%-24s %d functions of %d terms: %7.3f s\n" \
+        "${debug_flags:-(cache)}" \
+        ${FUNCTIONS} \
+        ${TERMS} \
+        $(echo "$end - $start" | bc)
+}
+
+FILE=$(generate_file)
+
+run disable_koenig_cache
+run
@@ -0,0 +1,56 @@
+#!/usr/bin/env bash
+
+# Reports the tokens per second of the C/C++ lexer on a large preprocessed
+# file. Only the lexer runs (see the lexer_benchmark debug flag), the file is
+# not parsed.
+#
+# usage: cxx-lexer.sh [plaincxx] [functions] [headers]
+#
+#  plaincxx   C++ driver to use (default: plaincxx in PATH)
+#  functions  number of functions of the generated file (default: 50000)
+#  headers    number of headers the functions are spread over, each one
+#             introduces line markers (default: 500)
+
+set -e
+
+PLAINCXX=${1:-plaincxx}
+FUNCTIONS=${2:-50000}
+HEADERS=${3:-500}
+
+WORKDIR=$(mktemp -d)
+trap "rm -rf ${WORKDIR}" EXIT
+
+generate_file()
+{
+    local f=${WORKDIR}/big_file.ii
+    local per_header=$(( FUNCTIONS / HEADERS ))
+
+    awk -v headers=${HEADERS} -v per_header=${per_header} '
+    BEGIN {
+        print "# 1 \"big_file.cpp\"";
+        for (h = 1; h <= headers; h++)
+        {
+            printf "# 1 \"/usr/include/benchmark/header_%d.h\" 1 3\n", h;
+            for (i = 1; i <= per_header; i++)
+            {
+                n = (h - 1) * per_header + i;
+                printf "template <typename T>\n";
+                printf "static inline T function_%d(const T* a, unsigned long n)\n", n;
+                printf "{\n";
+                printf "    T result = T(0);\n";
+                printf "    for (unsigned long i = 0; i < n; i++)\n";
+                printf "        result += a[i] * %d + (a[i] >> 2) - 0x%x;\n", n, n;
+                printf "    return result; // \"string\" %d\n", n;
+                printf "}\n";
+            }
+            printf "# %d \"big_file.cpp\" 2\n", h + 1;
+        }
+    }' > $f
+
+    echo $f
+}
+
+FILE=$(generate_file)
+
+printf "%s: %d bytes, %d lines\n" $(basename ${FILE}) $(stat -c %s ${FILE}) $(wc -l < ${FILE})
+${PLAINCXX} --debug-flags=lexer_benchmark -y -c -o /dev/null ${FILE}
@@ -0,0 +1,86 @@
+#!/usr/bin/env bash
+
+# Compares the time spent by the driver starting subprocesses (preprocessor,
+# native compiler, ...) using posix_spawn and using fork and exec (see the
+# disable_posix_spawn debug flag) as the resident set size of the driver
+# grows. Every generated file instantiates more class templates than the
+# previous one so the driver is bigger when the native compiler is started.
+#
+# usage: driver-spawn.sh [plaincxx] [steps] [classes]
+#
+#  plaincxx   C++ driver to use (default: plaincxx in PATH)
+#  steps      number of generated files (default: 5)
+#  classes    classes instantiated in the first file, every next file
+#             doubles them (default: 500)
+
+set -e
+
+PLAINCXX=${1:-plaincxx}
+STEPS=${2:-5}
+CLASSES=${3:-500}
+
+WORKDIR=$(mktemp -d)
+trap "rm -rf ${WORKDIR}" EXIT
+
+generate_file()
+{
+    local classes=$1
+    local f=${WORKDIR}/spawn_${classes}.cpp
+
+    cat > $f <<EOF
+template <int N>
+struct node
+{
+    int a[N % 7 + 1];
+    node<N - 1> next;
+
+    int sum() const { return a[0] + next.sum(); }
+};
+
+template <>
+struct node<0>
+{
+    int sum() const { return 0; }
+};
+EOF
+
+    awk -v classes=${classes} '
+    BEGIN {
+        for (n = 1; n <= classes; n++)
+        {
+            printf "struct c_%d : node<%d> { int f(int x) { return x + sum(); } };\n", n, n % 64 + 1;
+            printf "int g_%d(c_%d& c) { return c.f(%d); }\n", n, n, n;
+        }
+    }' >> $f
+
+    echo $f
+}
+
+run()
+{
+    local file=$1
+    local classes=$2
+    local debug_flags=$3
+
+    local report=$(${PLAINCXX} --debug-flags=memory_report${debug_flags:+,$debug_flags} -c -o /dev/null ${file} 2>&1)
+
+    local rss=$(echo "${report}" | sed -n 's/.*Maximum resident set size: \(.*\)$/\1/p')
+    local spawn=$(echo "${report}" | sed -n 's/.*Subprocesses started: \(.*\)$/\1/p')
+
+    printf "%-22s %7d classes  RSS %-12s %s\n" \
+        "${debug_flags:-(posix_spawn)}" \
+        ${classes} \
+        "${rss}" \
+        "${spawn}"
+}
+
+classes=${CLASSES}
+for step in $(seq 1 ${STEPS});
+do
+    FILE=$(generate_file ${classes})
+
+    run ${FILE} ${classes} disable_posix_spawn
+    run ${FILE} ${classes}
+
+    classes=$((classes * 2))
+done
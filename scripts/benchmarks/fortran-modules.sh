@@ -0,0 +1,120 @@
+#!/usr/bin/env bash
+
+# Compares the time spent compiling USE-heavy Fortran files when modules are
+# written as images (binary) and when they are written as SQLite databases.
+# It also compares compiling all the files in a single invocation with and
+# without the cache that keeps loaded modules between files.
+#
+# usage: fortran-modules.sh [plainfc] [members] [files]
+#
+#  plainfc   Fortran driver to use (default: plainfc in PATH)
+#  members   number of members of the generated module (default: 2000)
+#  files     number of files using the module (default: 50)
+
+set -e
+
+PLAINFC=${1:-plainfc}
+MEMBERS=${2:-2000}
+FILES=${3:-50}
+
+WORKDIR=$(mktemp -d)
+trap "rm -rf ${WORKDIR}" EXIT
+
+generate_module()
+{
+    local f=${WORKDIR}/big_module.f90
+
+    echo "MODULE BIG_MODULE" > $f
+    echo "    IMPLICIT NONE" >> $f
+    for i in $(seq 1 ${MEMBERS});
+    do
+        echo "    TYPE T_$i" >> $f
+        echo "        INTEGER :: X_$i" >> $f
+        echo "    END TYPE T_$i" >> $f
+        echo "    INTEGER, PARAMETER :: P_$i = $i" >> $f
+    done
+    echo "    CONTAINS" >> $f
+    for i in $(seq 1 ${MEMBERS});
+    do
+        echo "        SUBROUTINE S_$i(A)" >> $f
+        echo "            TYPE(T_$i) :: A" >> $f
+        echo "            A % X_$i = P_$i" >> $f
+        echo "        END SUBROUTINE S_$i" >> $f
+    done
+    echo "END MODULE BIG_MODULE" >> $f
+}
+
+generate_users()
+{
+    for n in $(seq 1 ${FILES});
+    do
+        local f=${WORKDIR}/user_$n.f90
+        local i=$(( (n * 37) % MEMBERS + 1 ))
+
+        echo "SUBROUTINE USER_$n()" > $f
+        echo "    USE BIG_MODULE, ONLY : T_$i, S_$i, P_$i" >> $f
+        echo "    IMPLICIT NONE" >> $f
+        echo "    TYPE(T_$i) :: A" >> $f
+        echo "    CALL S_$i(A)" >> $f
+        echo "    IF (A % X_$i /= P_$i) STOP 1" >> $f
+        echo "END SUBROUTINE USER_$n" >> $f
+    done
+}
+
+run()
+{
+    local format=$1
+    local dir=${WORKDIR}/$format
+
+    mkdir -p $dir
+    cd $dir
+
+    local start=$(date +%s.%N)
+    ${PLAINFC} --fortran-module-format=$format --do-not-wrap-modules -y \
+        -o /dev/null ${WORKDIR}/big_module.f90
+    local written=$(date +%s.%N)
+    for n in $(seq 1 ${FILES});
+    do
+        ${PLAINFC} --do-not-wrap-modules -y -o /dev/null ${WORKDIR}/user_$n.f90
+    done
+    local end=$(date +%s.%N)
+
+    printf "%-8s module size: %10d bytes  write: %7.3f s  %d USE files: %7.3f s\n" \
+        $format \
+        $(stat -c %s $dir/big_module.mf03) \
+        $(echo "$written - $start" | bc) \
+        ${FILES} \
+        $(echo "$end - $written" | bc)
+}
+
+run_single_invocation()
+{
+    local cache_flags=$1
+    local dir=${WORKDIR}/binary
+
+    cd $dir
+
+    local users=""
+    for n in $(seq 1 ${FILES});
+    do
+        users="$users ${WORKDIR}/user_$n.f90"
+    done
+
+    local start=$(date +%s.%N)
+    ${PLAINFC} --do-not-wrap-modules -y $cache_flags -c $users
+    local end=$(date +%s.%N)
+
+    printf "single invocation %-24s %d USE files: %7.3f s\n" \
+        "${cache_flags:-(module cache)}" \
+        ${FILES} \
+        $(echo "$end - $start" | bc)
+}
+
+generate_module
+generate_users
+
+run sqlite
+run binary
+
+run_single_invocation --disable-module-cache
+run_single_invocation
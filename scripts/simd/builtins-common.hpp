@@ -797,19 +797,18 @@ struct generate_type<R(T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13,
     }
 };
 
+// Emits an entry of a lazy builtin table (see cxx-lazybuiltins.h)
 template <typename T>
-void f(const std::string& str)
+void f(const std::string& str, const char* kind = "BUILTIN_FUNCTION")
 {
     std::cout 
-        << "{\n"
-        << "scope_entry_t* sym_" << str << " = new_symbol(decl_context, decl_context->current_scope, uniquestr(\"" << str << "\"));\n"
-        << "sym_" << str << "->kind = SK_FUNCTION;"
-        << "sym_" << str << "->do_not_print = 1;\n"
-        << "sym_" << str << "->locus = builtins_locus;\n"
-        << "sym_" << str << "->type_information = " << generate_type<T>::g() << ";\n"
-        << "symbol_entity_specs_set_is_builtin(sym_" << str << ", 1);\n"
-        << "}\n"
+        << kind << "(" << str << ", " << generate_type<T>::g() << ")\n"
         ;
 }
 
+static inline void do_alias(const char* newname, const char* existing)
+{
+    std::cout << "BUILTIN_ALIAS(" << newname << ", " << existing << ")\n";
+}
+
 #endif // BUILTINS_COMMON_HPP
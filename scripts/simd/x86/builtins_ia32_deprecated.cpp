@@ -119,9 +119,7 @@ int main(int, char**)
     f<__typeof__(X)>(#X);
 
 #define OVERLOADED_VECTOR_INTRIN(X) \
-    std::cout << "if (IS_CXX_LANGUAGE) {\n";  \
-        VECTOR_INTRIN(X) \
-    std::cout << "}\n";
+    f<__typeof__(X)>(#X, "BUILTIN_FUNCTION_CXX");
 
     VECTOR_INTRINSICS_LIST
 
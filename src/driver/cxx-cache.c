@@ -0,0 +1,775 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2014 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+
+  This file is part of Mercurium C/C++ source-to-source compiler.
+
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+  #include <config.h>
+#endif
+
+#include "cxx-cache.h"
+#include "cxx-driver-utils.h"
+#include "cxx-driver-build-info.h"
+#include "cxx-utils.h"
+#include "uniquestr.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <dirent.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+  #include <fcntl.h>
+  #include <utime.h>
+#endif
+#ifdef HAVE_DL_ITERATE_PHDR
+  #include <link.h>
+#endif
+
+#define CACHE_STATS_FILE "stats"
+#define CACHE_LOCK_FILE "lock"
+#define CACHE_OUTPUT_SUFFIX ".out"
+
+// When the size limit is exceeded the oldest entries are removed until the
+// cache is below this fraction of the limit
+#define CACHE_CLEANUP_FRACTION 0.9
+
+/*
+ * Hashing
+ *
+ * Two 64-bit hashes (FNV-1a and a multiply-xorshift one) are combined into a
+ * 128-bit key. This is not a cryptographic hash but it is more than enough
+ * for a local cache
+ */
+typedef
+struct cache_hash_tag
+{
+    uint64_t h1;
+    uint64_t h2;
+} cache_hash_t;
+
+static void cache_hash_init(cache_hash_t* hash)
+{
+    hash->h1 = 0xcbf29ce484222325ULL;
+    hash->h2 = 0x9e3779b97f4a7c15ULL;
+}
+
+static void cache_hash_bytes(cache_hash_t* hash, const void* data, size_t length)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    uint64_t h1 = hash->h1;
+    uint64_t h2 = hash->h2;
+
+    size_t i;
+    for (i = 0; i < length; i++)
+    {
+        h1 = (h1 ^ p[i]) * 0x100000001b3ULL;
+
+        h2 = (h2 ^ p[i]) * 0xff51afd7ed558ccdULL;
+        h2 ^= h2 >> 29;
+    }
+
+    hash->h1 = h1;
+    hash->h2 = h2;
+}
+
+static void cache_hash_uint(cache_hash_t* hash, uint64_t value)
+{
+    cache_hash_bytes(hash, &value, sizeof(value));
+}
+
+// The length is hashed too, so consecutive strings cannot be confused
+static void cache_hash_string(cache_hash_t* hash, const char* str)
+{
+    if (str == NULL)
+    {
+        cache_hash_uint(hash, (uint64_t)-1);
+        return;
+    }
+
+    size_t length = strlen(str);
+    cache_hash_uint(hash, length);
+    cache_hash_bytes(hash, str, length);
+}
+
+static void cache_hash_string_list(cache_hash_t* hash, const char** list)
+{
+    int num = count_null_ended_array((void**)list);
+    cache_hash_uint(hash, num);
+
+    int i;
+    for (i = 0; i < num; i++)
+    {
+        cache_hash_string(hash, list[i]);
+    }
+}
+
+static char cache_hash_file(cache_hash_t* hash, const char* filename)
+{
+    FILE* f = fopen(filename, "r");
+    if (f == NULL)
+        return 0;
+
+    char buffer[65536];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0)
+    {
+        cache_hash_bytes(hash, buffer, n);
+    }
+
+    char ok = !ferror(f);
+    fclose(f);
+
+    return ok;
+}
+
+static uint64_t cache_hash_mix(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+static const char* cache_hash_to_string(const cache_hash_t* hash)
+{
+    char c[33];
+    snprintf(c, sizeof(c), "%016llx%016llx",
+            (unsigned long long)cache_hash_mix(hash->h1),
+            (unsigned long long)cache_hash_mix(hash->h2));
+    c[32] = '\0';
+
+    return uniquestr(c);
+}
+
+#ifdef HAVE_DL_ITERATE_PHDR
+// The libraries loaded by the driver, compiler phases included, identify the
+// version of the compiler
+static int cache_hash_loaded_library(struct dl_phdr_info *info,
+        size_t size UNUSED_PARAMETER, void *data)
+{
+    cache_hash_t* hash = (cache_hash_t*)data;
+
+    if (info->dlpi_name == NULL
+            || info->dlpi_name[0] == '\0')
+        return 0;
+
+    struct stat s;
+    if (stat(info->dlpi_name, &s) != 0)
+        return 0;
+
+    cache_hash_string(hash, info->dlpi_name);
+    cache_hash_uint(hash, (uint64_t)s.st_size);
+    cache_hash_uint(hash, (uint64_t)s.st_mtime);
+
+    return 0;
+}
+#endif
+
+static char is_input_filename(const char* str)
+{
+    int i;
+    for (i = 0; i < compilation_process.num_translation_units; i++)
+    {
+        if (strcmp(str, compilation_process.translation_units[i]->translation_unit->input_filename) == 0)
+            return 1;
+    }
+    return 0;
+}
+
+// Options that only change how the driver works, not what it generates.
+// Returns how many arguments of argv are used by the option at i, or 0 if it
+// is not one of them
+static int driver_only_option(int i)
+{
+    const char* argument = compilation_process.argv[i];
+    const char* next = (i + 1 < compilation_process.argc) ? compilation_process.argv[i + 1] : NULL;
+
+    if (strcmp(argument, "-v") == 0
+            || strcmp(argument, "--verbose") == 0
+            || strcmp(argument, "--pipes") == 0)
+        return 1;
+
+    if (strncmp(argument, "-j", strlen("-j")) == 0)
+    {
+        if (argument[2] == '\0'
+                && next != NULL
+                && next[0] != '-')
+            return 2;
+        return 1;
+    }
+
+    static const char* options_with_argument[] =
+    {
+        "--native-jobs",
+        "--cache-dir",
+        "--cache-size",
+        "--debug-flags",
+        NULL
+    };
+
+    int j;
+    for (j = 0; options_with_argument[j] != NULL; j++)
+    {
+        int length = strlen(options_with_argument[j]);
+        if (strncmp(argument, options_with_argument[j], length) != 0)
+            continue;
+
+        if (argument[length] == '=')
+            return 1;
+        if (argument[length] == '\0')
+            return (next != NULL && next[0] != '-') ? 2 : 1;
+    }
+
+    return 0;
+}
+
+static char debug_information_requested(void)
+{
+    int i;
+    for (i = 1; i < compilation_process.argc; i++)
+    {
+        if (strncmp(compilation_process.argv[i], "-g", strlen("-g")) == 0)
+            return 1;
+    }
+
+    const char** native_options = CURRENT_CONFIGURATION->native_compiler_options;
+    for (i = 0; native_options != NULL && native_options[i] != NULL; i++)
+    {
+        if (strncmp(native_options[i], "-g", strlen("-g")) == 0)
+            return 1;
+    }
+
+    return 0;
+}
+
+static void cache_hash_configuration(cache_hash_t* hash)
+{
+    cache_hash_string(hash, PACKAGE " " VERSION " " MCXX_BUILD_VERSION);
+    cache_hash_string(hash, compilation_process.exec_basename);
+
+    // The command line, except for the files. Inputs are already hashed by
+    // their preprocessed contents and the name of the output does not
+    // change it
+    int i;
+    for (i = 1; i < compilation_process.argc; i++)
+    {
+        const char* argument = compilation_process.argv[i];
+        if (strcmp(argument, "-o") == 0)
+        {
+            i++;
+            continue;
+        }
+        if (is_input_filename(argument))
+            continue;
+
+        int num_driver_arguments = driver_only_option(i);
+        if (num_driver_arguments != 0)
+        {
+            i += num_driver_arguments - 1;
+            continue;
+        }
+
+        cache_hash_string(hash, argument);
+    }
+
+    // The committed configuration, which may come from configuration files
+    cache_hash_string(hash, CURRENT_CONFIGURATION->configuration_name);
+    cache_hash_uint(hash, CURRENT_CONFIGURATION->source_language);
+    cache_hash_uint(hash, CURRENT_CONFIGURATION->do_not_compile);
+    cache_hash_uint(hash, CURRENT_CONFIGURATION->generate_assembler);
+    cache_hash_uint(hash, CURRENT_CONFIGURATION->enable_cuda);
+    cache_hash_string(hash, CURRENT_CONFIGURATION->native_compiler_name);
+    cache_hash_string_list(hash, CURRENT_CONFIGURATION->native_compiler_options);
+
+    cache_hash_uint(hash, CURRENT_CONFIGURATION->num_compiler_phases);
+    for (i = 0; i < CURRENT_CONFIGURATION->num_compiler_phases; i++)
+    {
+        cache_hash_string(hash, CURRENT_CONFIGURATION->phase_loader[i]->data);
+    }
+
+    cache_hash_uint(hash, CURRENT_CONFIGURATION->num_external_vars);
+    for (i = 0; i < CURRENT_CONFIGURATION->num_external_vars; i++)
+    {
+        cache_hash_string(hash, CURRENT_CONFIGURATION->external_vars[i]->name);
+        cache_hash_string(hash, CURRENT_CONFIGURATION->external_vars[i]->value);
+    }
+
+    // Debug information of the output refers to it
+    char cwd[4096];
+    if (debug_information_requested()
+            && getcwd(cwd, sizeof(cwd)) != NULL)
+    {
+        cache_hash_string(hash, cwd);
+    }
+
+#ifdef HAVE_DL_ITERATE_PHDR
+    dl_iterate_phdr(cache_hash_loaded_library, hash);
+#endif
+}
+
+/*
+ * Cache directory
+ */
+typedef
+struct cache_stats_tag
+{
+    long long num_hits;
+    long long num_misses;
+    long long num_stores;
+    long long num_evictions;
+    long long size;
+} cache_stats_t;
+
+static int num_process_hits = 0;
+static int num_process_misses = 0;
+static int num_process_stores = 0;
+
+static const char* cache_path(const char* name)
+{
+    return strappend(compilation_process.cache_dir, strappend("/", name));
+}
+
+// Entries are spread in 256 subdirectories
+static const char* cache_entry_dir(const char* key)
+{
+    char c[3] = { key[0], key[1], '\0' };
+    return cache_path(c);
+}
+
+static const char* cache_entry_filename(const char* key)
+{
+    return strappend(cache_entry_dir(key), strappend("/", strappend(key + 2, CACHE_OUTPUT_SUFFIX)));
+}
+
+static char ensure_dir(const char* dir)
+{
+    if (mkdir(dir, 0777) != 0
+            && errno != EEXIST)
+    {
+        fprintf(stderr, "%s: warning: cannot create cache directory '%s' (%s)\n",
+                compilation_process.exec_basename,
+                dir,
+                strerror(errno));
+        return 0;
+    }
+    return 1;
+}
+
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+// Several compilers may use the same cache at the same time. The statistics
+// are only updated while holding this lock
+static int lock_cache(void)
+{
+    const char* lock_filename = cache_path(CACHE_LOCK_FILE);
+    int lock_fd = open(lock_filename, O_CREAT | O_RDWR, 0666);
+    if (lock_fd < 0)
+        return -1;
+
+    struct flock fl;
+    memset(&fl, 0, sizeof(fl));
+    fl.l_type = F_WRLCK;
+    fl.l_whence = SEEK_SET;
+
+    if (fcntl(lock_fd, F_SETLKW, &fl) < 0)
+    {
+        close(lock_fd);
+        return -1;
+    }
+
+    return lock_fd;
+}
+
+static void unlock_cache(int lock_fd)
+{
+    if (lock_fd < 0)
+        return;
+
+    struct flock fl;
+    memset(&fl, 0, sizeof(fl));
+    fl.l_type = F_UNLCK;
+    fl.l_whence = SEEK_SET;
+
+    fcntl(lock_fd, F_SETLK, &fl);
+    close(lock_fd);
+}
+#else
+static int lock_cache(void)
+{
+    return -1;
+}
+
+static void unlock_cache(int lock_fd UNUSED_PARAMETER)
+{
+}
+#endif
+
+static void read_stats(cache_stats_t* stats)
+{
+    memset(stats, 0, sizeof(*stats));
+
+    FILE* f = fopen(cache_path(CACHE_STATS_FILE), "r");
+    if (f == NULL)
+        return;
+
+    char name[64];
+    long long value;
+    while (fscanf(f, "%63s %lld", name, &value) == 2)
+    {
+        if (strcmp(name, "hits") == 0)
+            stats->num_hits = value;
+        else if (strcmp(name, "misses") == 0)
+            stats->num_misses = value;
+        else if (strcmp(name, "stores") == 0)
+            stats->num_stores = value;
+        else if (strcmp(name, "evictions") == 0)
+            stats->num_evictions = value;
+        else if (strcmp(name, "size") == 0)
+            stats->size = value;
+    }
+
+    fclose(f);
+}
+
+static void write_stats(const cache_stats_t* stats)
+{
+    const char* stats_filename = cache_path(CACHE_STATS_FILE);
+
+    const char* temporal_filename = NULL;
+    uniquestr_sprintf(&temporal_filename, "%s.%d", stats_filename, (int)getpid());
+
+    FILE* f = fopen(temporal_filename, "w");
+    if (f == NULL)
+        return;
+
+    fprintf(f, "hits %lld\n", stats->num_hits);
+    fprintf(f, "misses %lld\n", stats->num_misses);
+    fprintf(f, "stores %lld\n", stats->num_stores);
+    fprintf(f, "evictions %lld\n", stats->num_evictions);
+    fprintf(f, "size %lld\n", stats->size);
+    fclose(f);
+
+    rename(temporal_filename, stats_filename);
+}
+
+typedef
+struct cache_entry_info_tag
+{
+    const char* filename;
+    time_t mtime;
+    long long size;
+} cache_entry_info_t;
+
+static int compare_cache_entry_info(const void* p1, const void* p2)
+{
+    const cache_entry_info_t* e1 = (const cache_entry_info_t*)p1;
+    const cache_entry_info_t* e2 = (const cache_entry_info_t*)p2;
+
+    if (e1->mtime < e2->mtime)
+        return -1;
+    else if (e1->mtime > e2->mtime)
+        return 1;
+    return strcmp(e1->filename, e2->filename);
+}
+
+// Removes the least recently used entries until the cache fits in the limit.
+// The size of the cache is recomputed here, so it does not drift
+static void cleanup_cache(cache_stats_t* stats)
+{
+    int num_entries = 0;
+    cache_entry_info_t* entries = NULL;
+    long long size = 0;
+
+    int i;
+    for (i = 0; i < 256; i++)
+    {
+        char c[3];
+        snprintf(c, sizeof(c), "%02x", i);
+        const char* dir = cache_path(c);
+
+        DIR* d = opendir(dir);
+        if (d == NULL)
+            continue;
+
+        struct dirent* entry;
+        while ((entry = readdir(d)) != NULL)
+        {
+            size_t length = strlen(entry->d_name);
+            if (length <= strlen(CACHE_OUTPUT_SUFFIX)
+                    || strcmp(entry->d_name + length - strlen(CACHE_OUTPUT_SUFFIX), CACHE_OUTPUT_SUFFIX) != 0)
+                continue;
+
+            const char* filename = strappend(dir, strappend("/", entry->d_name));
+            struct stat s;
+            if (stat(filename, &s) != 0)
+                continue;
+
+            cache_entry_info_t info = { filename, s.st_mtime, (long long)s.st_size };
+            P_LIST_ADD(entries, num_entries, info);
+            size += info.size;
+        }
+        closedir(d);
+    }
+
+    qsort(entries, num_entries, sizeof(*entries), compare_cache_entry_info);
+
+    long long target = (long long)(compilation_process.cache_size * CACHE_CLEANUP_FRACTION);
+    for (i = 0; i < num_entries && size > target; i++)
+    {
+        if (remove(entries[i].filename) == 0)
+        {
+            size -= entries[i].size;
+            stats->num_evictions++;
+        }
+    }
+
+    DELETE(entries);
+
+    stats->size = size;
+}
+
+static void update_stats(int num_hits, int num_misses, int num_stores, long long size)
+{
+    int lock_fd = lock_cache();
+
+    cache_stats_t stats;
+    read_stats(&stats);
+
+    stats.num_hits += num_hits;
+    stats.num_misses += num_misses;
+    stats.num_stores += num_stores;
+    stats.size += size;
+
+    if (stats.size > (long long)compilation_process.cache_size)
+    {
+        cleanup_cache(&stats);
+    }
+
+    write_stats(&stats);
+
+    unlock_cache(lock_fd);
+}
+
+/*
+ * Lookups and stores
+ */
+typedef
+struct pending_store_tag
+{
+    const char* key;
+    const char* output_filename;
+} pending_store_t;
+
+static int num_pending_stores = 0;
+static pending_store_t* pending_stores = NULL;
+
+// Only regular files are cached, so outputs like /dev/null are not
+static char is_cacheable_output(const char* output_filename)
+{
+    struct stat s;
+    if (stat(output_filename, &s) != 0)
+        return (errno == ENOENT);
+
+    return S_ISREG(s.st_mode);
+}
+
+char compilation_cache_lookup(translation_unit_t* translation_unit,
+        const char* output_filename,
+        const char* preprocessed_filename,
+        const char* preprocessed_buffer,
+        size_t preprocessed_length)
+{
+    if (!is_cacheable_output(output_filename)
+            || !ensure_dir(compilation_process.cache_dir))
+        return 0;
+
+    cache_hash_t hash;
+    cache_hash_init(&hash);
+
+    cache_hash_configuration(&hash);
+
+    if (preprocessed_buffer != NULL)
+    {
+        cache_hash_bytes(&hash, preprocessed_buffer, preprocessed_length);
+    }
+    else if (!cache_hash_file(&hash, preprocessed_filename))
+    {
+        return 0;
+    }
+
+    const char* key = cache_hash_to_string(&hash);
+    const char* entry_filename = cache_entry_filename(key);
+
+    if (copy_file(entry_filename, output_filename) == 0)
+    {
+        if (CURRENT_CONFIGURATION->verbose)
+        {
+            fprintf(stderr, "File '%s' found in the compilation cache ('%s')\n",
+                    translation_unit->input_filename,
+                    entry_filename);
+        }
+
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+        // This entry is now the most recently used
+        utime(entry_filename, NULL);
+#endif
+
+        num_process_hits++;
+        update_stats(/* hits */ 1, /* misses */ 0, /* stores */ 0, /* size */ 0);
+
+        return 1;
+    }
+
+    // Neither a failed copy nor an output of a previous compilation can be
+    // stored in the cache if this compilation does not write it
+    remove(output_filename);
+
+    if (CURRENT_CONFIGURATION->verbose)
+    {
+        fprintf(stderr, "File '%s' not found in the compilation cache\n",
+                translation_unit->input_filename);
+    }
+
+    pending_store_t pending_store = { key, output_filename };
+    P_LIST_ADD(pending_stores, num_pending_stores, pending_store);
+
+    num_process_misses++;
+    update_stats(/* hits */ 0, /* misses */ 1, /* stores */ 0, /* size */ 0);
+
+    return 0;
+}
+
+void compilation_cache_store_pending(void)
+{
+    int i;
+    for (i = 0; i < num_pending_stores; i++)
+    {
+        const char* key = pending_stores[i].key;
+        const char* output_filename = pending_stores[i].output_filename;
+
+        struct stat s;
+        if (stat(output_filename, &s) != 0
+                || !S_ISREG(s.st_mode)
+                || !ensure_dir(cache_entry_dir(key)))
+            continue;
+
+        // Readers never see a partial entry
+        const char* entry_filename = cache_entry_filename(key);
+        const char* temporal_filename = NULL;
+        uniquestr_sprintf(&temporal_filename, "%s.%d", entry_filename, (int)getpid());
+
+        // A short copy, e.g. on a full disk, must not become an entry
+        struct stat copied;
+        if (copy_file(output_filename, temporal_filename) != 0
+                || stat(temporal_filename, &copied) != 0
+                || copied.st_size != s.st_size
+                || rename(temporal_filename, entry_filename) != 0)
+        {
+            remove(temporal_filename);
+            continue;
+        }
+
+        if (CURRENT_CONFIGURATION->verbose)
+        {
+            fprintf(stderr, "File '%s' stored in the compilation cache ('%s')\n",
+                    output_filename,
+                    entry_filename);
+        }
+
+        num_process_stores++;
+        update_stats(/* hits */ 0, /* misses */ 0, /* stores */ 1, (long long)s.st_size);
+    }
+
+    DELETE(pending_stores);
+    pending_stores = NULL;
+    num_pending_stores = 0;
+}
+
+unsigned long long compilation_cache_parse_size(const char* str)
+{
+    if (str == NULL)
+        return 0;
+
+    char* end = NULL;
+    double value = strtod(str, &end);
+    if (end == str
+            || value <= 0)
+        return 0;
+
+    unsigned long long multiplier = 1;
+    switch (*end)
+    {
+        case 'k': case 'K': multiplier = 1024ULL; end++; break;
+        case 'm': case 'M': multiplier = 1024ULL * 1024ULL; end++; break;
+        case 'g': case 'G': multiplier = 1024ULL * 1024ULL * 1024ULL; end++; break;
+        case 't': case 'T': multiplier = 1024ULL * 1024ULL * 1024ULL * 1024ULL; end++; break;
+        default: break;
+    }
+
+    if (*end != '\0')
+        return 0;
+
+    return (unsigned long long)(value * multiplier);
+}
+
+void compilation_cache_print_stats(void)
+{
+    if (compilation_process.cache_dir == NULL)
+    {
+        fprintf(stdout, "No compilation cache directory was specified (use --cache-dir=<dir>)\n");
+        return;
+    }
+
+    int lock_fd = lock_cache();
+    cache_stats_t stats;
+    read_stats(&stats);
+    unlock_cache(lock_fd);
+
+    long long num_lookups = stats.num_hits + stats.num_misses;
+
+    fprintf(stdout, "Compilation cache '%s'\n", compilation_process.cache_dir);
+    fprintf(stdout, "  Hits:       %lld (%.2f%%)\n",
+            stats.num_hits,
+            num_lookups > 0 ? 100.0 * stats.num_hits / num_lookups : 0.0);
+    fprintf(stdout, "  Misses:     %lld\n", stats.num_misses);
+    fprintf(stdout, "  Stores:     %lld\n", stats.num_stores);
+    fprintf(stdout, "  Evictions:  %lld\n", stats.num_evictions);
+    fprintf(stdout, "  Size:       %.2f MB of %.2f MB\n",
+            stats.size / (1024.0 * 1024.0),
+            compilation_process.cache_size / (1024.0 * 1024.0));
+}
+
+void compilation_cache_get_stats(int* num_hits, int* num_misses, int* num_stores)
+{
+    *num_hits = num_process_hits;
+    *num_misses = num_process_misses;
+    *num_stores = num_process_stores;
+}
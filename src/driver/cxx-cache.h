@@ -0,0 +1,74 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2014 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+
+  This file is part of Mercurium C/C++ source-to-source compiler.
+
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+#ifndef CXX_CACHE_H
+#define CXX_CACHE_H
+
+#include "cxx-macros.h"
+#include "cxx-driver-decls.h"
+
+#include <stddef.h>
+
+MCXX_BEGIN_DECLS
+
+// On-disk cache of compilations (--cache-dir)
+//
+// The key of a translation unit is a hash of its preprocessed contents, the
+// current configuration (profile, native compiler, compiler phases and their
+// parameters), the command line without the input and output files, the
+// working directory and the version of every loaded library. The value is
+// the output of the compilation (the object or the prettyprinted file) once
+// secondary translation units have been embedded in it.
+
+// Default size limit of the cache (--cache-size)
+#define COMPILATION_CACHE_DEFAULT_SIZE (1024ULL * 1024ULL * 1024ULL)
+
+// Looks up the translation unit being compiled, whose preprocessed contents
+// are either in preprocessed_filename or in preprocessed_buffer. On a hit the
+// cached output is copied to output_filename and 1 is returned. On a miss the
+// translation unit will be stored by compilation_cache_store_pending
+char compilation_cache_lookup(translation_unit_t* translation_unit,
+        const char* output_filename,
+        const char* preprocessed_filename,
+        const char* preprocessed_buffer,
+        size_t preprocessed_length);
+
+// Stores the outputs of the translation units that missed. Call it when they
+// are final, after embedding
+void compilation_cache_store_pending(void);
+
+// Parses a size like 500M or 2G for --cache-size. Returns 0 if invalid
+unsigned long long compilation_cache_parse_size(const char* str);
+
+// Prints the statistics kept in the cache directory (--cache-stats)
+void compilation_cache_print_stats(void);
+
+// Statistics of this process
+void compilation_cache_get_stats(int* num_hits, int* num_misses, int* num_stores);
+
+MCXX_END_DECLS
+
+#endif // CXX_CACHE_H
@@ -35,6 +35,7 @@
 #include "cxx-buildscope-decls.h"
 #include "cxx-nodecl-decls.h"
 #include "fortran03-typeenviron-decls.h"
+#include "mem_arena.h"
 #include <stddef.h>
 
 MCXX_BEGIN_DECLS
@@ -132,6 +133,11 @@ typedef struct translation_unit_tag
 
     // Opaque pointer used when running compiler phases
     void *dto;
+
+    // Arena of the AST and nodecl nodes of this translation unit (only
+    // if --ast-arena). Statistics are kept after the arena is released
+    mem_arena_t* ast_arena;
+    mem_arena_stats_t ast_arena_stats;
 } translation_unit_t;
 
 struct compilation_configuration_tag;
@@ -183,6 +189,9 @@ typedef struct debug_options_tag
     char show_template_packs;
     char vectorization_verbose;
     char stats_string_table;
+    char lexer_benchmark;
+    char disable_koenig_cache;
+    char disable_posix_spawn;
 } debug_options_t;
 
 extern debug_options_t debug_options;
@@ -277,6 +286,20 @@ typedef struct compilation_process_tag
 
     // Flags
     char parallel_process; // enables features allowing parallel compilation
+
+    // Maximum number of translation units compiled at the same time (-j)
+    int num_jobs;
+
+    // Maximum number of native compilations running at the same time
+    // (--native-jobs)
+    int num_native_jobs;
+
+    // Directory of the compilation cache (--cache-dir), NULL if disabled
+    const char* cache_dir;
+    // Size limit in bytes of the compilation cache (--cache-size)
+    unsigned long long cache_size;
+    // Print the statistics of the compilation cache and exit (--cache-stats)
+    char print_cache_stats;
 } compilation_process_t;
 
 typedef struct compilation_configuration_conditional_flags
@@ -412,6 +435,13 @@ typedef struct compilation_configuration_tag
     // Fortran module wrapping
     char do_not_wrap_fortran_modules;
 
+    // Write Fortran modules as memory-mapped images instead of in the
+    // SQLite format
+    char fortran_binary_modules;
+
+    // Share loaded Fortran modules between translation units
+    char fortran_module_cache;
+
     // Directories where we look for modules
     int num_module_dirs;
     const char** module_dirs;
@@ -589,6 +619,19 @@ typedef struct compilation_configuration_tag
 
     // Emit line markers in the output files
     char line_markers;
+
+    // Allocate AST and nodecl nodes in a per translation unit arena
+    char ast_arena;
+
+    // Declare implicit special members of C++ classes on demand
+    char lazy_implicit_members;
+
+    // Analyze inline functions of included files only if referenced
+    char lazy_inline_bodies;
+
+    // Read the output of the preprocessor and feed the native compiler
+    // through pipes instead of intermediate files
+    char use_pipes;
 } compilation_configuration_t;
 
 struct compiler_phase_loader_tag
@@ -36,6 +36,10 @@
 #include <errno.h>
 #if !defined(WIN32_BUILD) || defined(__CYGWIN__)
   #include <sys/wait.h>
+  #include <fcntl.h>
+  #ifdef HAVE_POSIX_SPAWNP
+    #include <spawn.h>
+  #endif
   #include <libgen.h>
   #include <limits.h>
 #else
@@ -123,6 +127,21 @@ void temporal_files_cleanup(void)
     temporal_file_list = NULL;
 }
 
+void temporal_files_forget(void)
+{
+    temporal_file_list_t iter = temporal_file_list;
+
+    while (iter != NULL)
+    {
+        temporal_file_list_t prev = iter;
+        iter = iter->next;
+        DELETE(prev->info);
+        DELETE(prev);
+    }
+
+    temporal_file_list = NULL;
+}
+
 static char name_is_in_temporal_files(const char* name)
 {
     temporal_file_list_t it = temporal_file_list;
@@ -339,56 +358,33 @@ const char* get_extension_filename(const char* filename)
     return strrchr(filename, '.');
 }
 
+// Time spent by the driver starting subprocesses
+static int num_spawned_programs = 0;
+static double time_spawning_programs = 0.0;
+
+void execute_program_get_stats(int* num_programs, double* spawn_time)
+{
+    *num_programs = num_spawned_programs;
+    *spawn_time = time_spawning_programs;
+}
+
 int execute_program(const char* program_name, const char** arguments)
 {
     return execute_program_flags(program_name, arguments, /* stdout_f */ NULL, /* stderr_f */ NULL);
 }
 
 #if !defined(WIN32_BUILD) || defined(__CYGWIN__)
-static int execute_program_flags_unix(const char* program_name, const char** arguments, const char* stdout_f, const char* stderr_f)
+// Spawns the program with fork (or vfork) and exec. Forking copies the page
+// tables of the driver, which may be big after compiling a large file
+static pid_t fork_program_unix(const char* program_name, const char** execvp_arguments,
+        const char* stdout_f, const char* stderr_f,
+        int stdin_fd, int stdout_fd)
 {
-    if (program_name == NULL)
-        program_name = "";
-
-    int num = count_null_ended_array((void**)arguments);
-
-    const char** execvp_arguments = NEW_VEC0(const char*, num + 1 + 1);
-
-    execvp_arguments[0] = program_name;
-
-    int i;
-    for (i = 0; i < num; i++)
-    {
-        execvp_arguments[i+1] = arguments[i];
-    }
-
-    execvp_arguments[i+1] = NULL;
-
-    if (CURRENT_CONFIGURATION->verbose)
-    {
-        int j = 0;
-        while (execvp_arguments[j] != NULL)
-        {
-            fprintf(stderr, "%s ", execvp_arguments[j]);
-            j++;
-        }
-
-        if (stdout_f != NULL)
-        {
-            fprintf(stderr, "1> %s ", stdout_f);
-        }
-        if (stderr_f != NULL)
-        {
-            fprintf(stderr, "2> %s ", stderr_f);
-        }
-
-        fprintf(stderr, "\n");
-    }
-
-    // This routine is UNIX-only
     pid_t spawned_process;
     if (stdout_f == NULL
-            && stderr_f == NULL)
+            && stderr_f == NULL
+            && stdin_fd < 0
+            && stdout_fd < 0)
     {
         // If no work previous to execvp is requested, vfork is fine
         spawned_process = vfork();
@@ -404,6 +400,26 @@ static int execute_program_flags_unix(const char* program_name, const char** arg
     }
     else if (spawned_process == 0) // I'm the spawned process
     {
+        // Connect the pipes as needed
+        if (stdin_fd >= 0)
+        {
+            if (dup2(stdin_fd, 0) < 0)
+            {
+                fatal_error("error: could not duplicate standard input");
+            }
+            if (stdin_fd != 0)
+                close(stdin_fd);
+        }
+        if (stdout_fd >= 0)
+        {
+            if (dup2(stdout_fd, 1) < 0)
+            {
+                fatal_error("error: could not duplicate standard output");
+            }
+            if (stdout_fd != 1)
+                close(stdout_fd);
+        }
+
         // Redirect output files as needed
         if (stdout_f != NULL)
         {
@@ -449,29 +465,177 @@ static int execute_program_flags_unix(const char* program_name, const char** arg
         // Execvp should not return
         fatal_error("error: execution of subprocess '%s' failed (%s)", program_name, strerror(errno));
     }
-    else // I'm the parent
+
+    return spawned_process;
+}
+
+#ifdef HAVE_POSIX_SPAWNP
+extern char** environ;
+
+// posix_spawnp does not duplicate the address space of the driver
+static pid_t posix_spawn_program_unix(const char* program_name, const char** execvp_arguments,
+        const char* stdout_f, const char* stderr_f,
+        int stdin_fd, int stdout_fd)
+{
+    posix_spawn_file_actions_t file_actions;
+    posix_spawn_file_actions_init(&file_actions);
+
+    if (stdin_fd >= 0)
+    {
+        posix_spawn_file_actions_adddup2(&file_actions, stdin_fd, 0);
+        if (stdin_fd != 0)
+            posix_spawn_file_actions_addclose(&file_actions, stdin_fd);
+    }
+    if (stdout_fd >= 0)
+    {
+        posix_spawn_file_actions_adddup2(&file_actions, stdout_fd, 1);
+        if (stdout_fd != 1)
+            posix_spawn_file_actions_addclose(&file_actions, stdout_fd);
+    }
+    if (stdout_f != NULL)
+    {
+        posix_spawn_file_actions_addopen(&file_actions, 1, stdout_f, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    }
+    if (stderr_f != NULL)
+    {
+        posix_spawn_file_actions_addopen(&file_actions, 2, stderr_f, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    }
+
+    pid_t spawned_process = -1;
+    // The cast is here because posix_spawnp prototype does not get
+    // 'const char* const*' but 'char *const*'
+    int error = posix_spawnp(&spawned_process, program_name, &file_actions,
+            /* attrp */ NULL, (char**)execvp_arguments, environ);
+
+    posix_spawn_file_actions_destroy(&file_actions);
+
+    if (error != 0)
+    {
+        // Like when execvp fails in the forked process, this is reported as
+        // a failure of the subprocess
+        fprintf(stderr, "error: execution of subprocess '%s' failed (%s)\n", program_name, strerror(error));
+        return -1;
+    }
+
+    return spawned_process;
+}
+#endif
+
+// stdin_fd and stdout_fd, when not -1, are the descriptors the spawned
+// process will use as its standard input and output
+static pid_t spawn_program_unix(const char* program_name, const char** arguments,
+        const char* stdout_f, const char* stderr_f,
+        int stdin_fd, int stdout_fd)
+{
+    int num = count_null_ended_array((void**)arguments);
+
+    const char** execvp_arguments = NEW_VEC0(const char*, num + 1 + 1);
+
+    execvp_arguments[0] = program_name;
+
+    int i;
+    for (i = 0; i < num; i++)
+    {
+        execvp_arguments[i+1] = arguments[i];
+    }
+
+    execvp_arguments[i+1] = NULL;
+
+    if (CURRENT_CONFIGURATION->verbose)
     {
-        // Wait for my son
-        int status;
-        wait(&status);
-        if (WIFEXITED(status))
+        int j = 0;
+        while (execvp_arguments[j] != NULL)
         {
-            return (WEXITSTATUS(status));
+            fprintf(stderr, "%s ", execvp_arguments[j]);
+            j++;
         }
-        else if (WIFSIGNALED(status))
-        {
-            fprintf(stderr, "Subprocess '%s' was ended with signal %d\n",
-                    program_name, WTERMSIG(status));
 
-            return 1;
+        if (stdout_f != NULL)
+        {
+            fprintf(stderr, "1> %s ", stdout_f);
         }
-        else
+        if (stderr_f != NULL)
         {
-            internal_error(
-                    "Subprocess '%s' ended but neither by normal exit nor signal", 
-                    program_name);
+            fprintf(stderr, "2> %s ", stderr_f);
         }
+
+        fprintf(stderr, "\n");
+    }
+
+    timing_t timing_spawn;
+    timing_start(&timing_spawn);
+
+    pid_t spawned_process;
+#ifdef HAVE_POSIX_SPAWNP
+    if (!debug_options.disable_posix_spawn)
+    {
+        spawned_process = posix_spawn_program_unix(program_name, execvp_arguments,
+                stdout_f, stderr_f, stdin_fd, stdout_fd);
+    }
+    else
+#endif
+    {
+        spawned_process = fork_program_unix(program_name, execvp_arguments,
+                stdout_f, stderr_f, stdin_fd, stdout_fd);
+    }
+
+    timing_end(&timing_spawn);
+    num_spawned_programs++;
+    time_spawning_programs += timing_elapsed(&timing_spawn);
+
+    DELETE(execvp_arguments);
+
+    return spawned_process;
+}
+
+static int wait_program_unix(pid_t spawned_process, const char* program_name)
+{
+    // The program could not be run
+    if (spawned_process < 0)
+        return 127;
+
+    // Wait for my son
+    int status;
+    waitpid(spawned_process, &status, 0);
+    if (WIFEXITED(status))
+    {
+        return (WEXITSTATUS(status));
+    }
+    else if (WIFSIGNALED(status))
+    {
+        fprintf(stderr, "Subprocess '%s' was ended with signal %d\n",
+                program_name, WTERMSIG(status));
+
+        return 1;
+    }
+    else
+    {
+        internal_error(
+                "Subprocess '%s' ended but neither by normal exit nor signal", 
+                program_name);
+    }
+}
+
+static int execute_program_flags_unix(const char* program_name, const char** arguments, const char* stdout_f, const char* stderr_f)
+{
+    if (program_name == NULL)
+        program_name = "";
+
+    pid_t spawned_process = spawn_program_unix(program_name, arguments, stdout_f, stderr_f,
+            /* stdin_fd */ -1, /* stdout_fd */ -1);
+
+    return wait_program_unix(spawned_process, program_name);
+}
+
+// Creates a pipe whose end kept by the driver is not inherited by other
+// spawned processes
+static void create_pipe(int pipe_fds[2], int driver_end)
+{
+    if (pipe(pipe_fds) != 0)
+    {
+        fatal_error("error: could not create a pipe (%s)", strerror(errno));
     }
+    fcntl(pipe_fds[driver_end], F_SETFD, FD_CLOEXEC);
 }
 #else
 
@@ -633,6 +797,126 @@ int execute_program_flags(const char* program_name, const char** arguments, cons
 #endif
 }
 
+struct running_program_tag
+{
+    const char* program_name;
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+    pid_t pid;
+#else
+    int result;
+#endif
+};
+
+running_program_t* start_program(const char* program_name, const char** arguments)
+{
+    if (program_name == NULL)
+        program_name = "";
+
+    running_program_t* result = NEW0(running_program_t);
+    result->program_name = uniquestr(program_name);
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+    result->pid = spawn_program_unix(program_name, arguments, /* stdout_f */ NULL, /* stderr_f */ NULL,
+            /* stdin_fd */ -1, /* stdout_fd */ -1);
+#else
+    // There is no asynchronous execution here, so just run it now
+    result->result = execute_program_flags_win32(program_name, arguments, /* stdout_f */ NULL, /* stderr_f */ NULL);
+#endif
+
+    return result;
+}
+
+int wait_program(running_program_t* running_program)
+{
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+    int result = wait_program_unix(running_program->pid, running_program->program_name);
+#else
+    int result = running_program->result;
+#endif
+    DELETE(running_program);
+
+    return result;
+}
+
+running_program_t* start_program_with_input(const char* program_name, const char** arguments,
+        FILE** stdin_file)
+{
+    if (program_name == NULL)
+        program_name = "";
+
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+    int pipe_fds[2];
+    create_pipe(pipe_fds, /* driver_end */ 1);
+
+    running_program_t* result = NEW0(running_program_t);
+    result->program_name = uniquestr(program_name);
+    result->pid = spawn_program_unix(program_name, arguments, /* stdout_f */ NULL, /* stderr_f */ NULL,
+            /* stdin_fd */ pipe_fds[0], /* stdout_fd */ -1);
+    close(pipe_fds[0]);
+
+    *stdin_file = fdopen(pipe_fds[1], "w");
+    if (*stdin_file == NULL)
+    {
+        fatal_error("error: could not open the standard input of '%s' (%s)", program_name, strerror(errno));
+    }
+
+    return result;
+#else
+    fatal_error("error: pipes are not supported in this platform");
+#endif
+}
+
+int execute_program_output(const char* program_name, const char** arguments,
+        char** output, size_t* output_length)
+{
+    if (program_name == NULL)
+        program_name = "";
+
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+    int pipe_fds[2];
+    create_pipe(pipe_fds, /* driver_end */ 0);
+
+    pid_t spawned_process = spawn_program_unix(program_name, arguments, /* stdout_f */ NULL, /* stderr_f */ NULL,
+            /* stdin_fd */ -1, /* stdout_fd */ pipe_fds[1]);
+    close(pipe_fds[1]);
+
+    size_t capacity = 64 * 1024;
+    size_t length = 0;
+    char* buffer = NEW_VEC(char, capacity);
+    for (;;)
+    {
+        // Keep room for the two spare bytes
+        if (capacity - length < 4096 + 2)
+        {
+            capacity *= 2;
+            buffer = NEW_REALLOC(char, buffer, capacity);
+        }
+
+        ssize_t n = read(pipe_fds[0], buffer + length, capacity - length - 2);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            fatal_error("error: could not read the output of '%s' (%s)", program_name, strerror(errno));
+        }
+        else if (n == 0)
+            break;
+
+        length += n;
+    }
+    close(pipe_fds[0]);
+
+    buffer[length] = '\0';
+    buffer[length + 1] = '\0';
+
+    *output = buffer;
+    *output_length = length;
+
+    return wait_program_unix(spawned_process, program_name);
+#else
+    fatal_error("error: pipes are not supported in this platform");
+#endif
+}
+
 int count_null_ended_array(void** v)
 {
     int result = 0;
@@ -824,7 +1108,9 @@ char copy_file(const char* source, const char* dest)
     }
 
     fclose(orig_file);
-    fclose(dest_file);
+    // Buffered data is written here
+    if (fclose(dest_file) != 0)
+        return -1;
     return 0;
 }
 
@@ -75,12 +75,36 @@ temporal_file_t new_temporal_file_extension(const char* extension);
 // file is closed and erased.
 void temporal_files_cleanup(void);
 
+// Forgets every temporal file without removing it. A forked process uses this
+// so it does not remove the temporal files of its parent
+void temporal_files_forget(void);
+
 const char* get_extension_filename(const char* filename);
 
 int execute_program(const char* program_name, const char** arguments);
 int execute_program_flags(const char* program_name, const char** arguments, 
         const char *stdout_f, const char *stderr_f);
 
+// Number of subprocesses started and seconds spent starting them
+void execute_program_get_stats(int* num_programs, double* spawn_time);
+
+// Runs a program without waiting for it to end. wait_program waits for it
+// and returns its exit status, like execute_program. Every started program
+// must be waited exactly once
+typedef struct running_program_tag running_program_t;
+running_program_t* start_program(const char* program_name, const char** arguments);
+int wait_program(running_program_t* running_program);
+
+// Like start_program but the standard input of the program is read from
+// *stdin_file, which the caller must fclose before waiting the program
+running_program_t* start_program_with_input(const char* program_name, const char** arguments,
+        FILE** stdin_file);
+
+// Runs a program and returns in *output everything it writes to its standard
+// output, followed by two spare bytes. *output must be released with DELETE
+int execute_program_output(const char* program_name, const char** arguments,
+        char** output, size_t* output_length);
+
 // char** routines
 int count_null_ended_array(void** v);
 void remove_string_from_null_ended_string_array(const char** string_arr, const char* to_remove);
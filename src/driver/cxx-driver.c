@@ -44,6 +44,8 @@
 
 #if !defined(WIN32_BUILD) || defined(__CYGWIN__)
 #include <signal.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
 #endif
 
 #ifdef HAVE_MALLINFO
@@ -64,6 +66,7 @@
 #include "cxx-html.h"
 #include "cxx-prettyprint.h"
 #include "cxx-scope.h"
+#include "cxx-koenig.h"
 #include "cxx-buildscope.h"
 #include "cxx-typeenviron.h"
 #include "cxx-lexer.h"
@@ -83,6 +86,8 @@
 #include "cxx-nodecl-checker.h"
 #include "cxx-limits.h"
 #include "cxx-diagnostic.h"
+#include "cxx-lazybuiltins.h"
+#include "cxx-instantiation.h"
 // It does not include any C++ code in the header
 #include "cxx-compilerphases.hpp"
 #include "cxx-codegen.h"
@@ -100,6 +105,7 @@
 #include "fortran03-mangling.h"
 #include "cxx-driver-fortran.h"
 #include "cxx-driver-build-info.h"
+#include "cxx-cache.h"
 
 /* ------------------------------------------------------------------ */
 #define HELP_STRING \
@@ -111,6 +117,9 @@
 "  -o, --output=<file>      Sets <file> as the output file\n" \
 "  -c                       Does not link, just compile\n" \
 "  -E                       Does not compile, just preprocess\n" \
+"  -j <n>, --jobs=<n>       EXPERIMENTAL: compiles up to <n> files\n" \
+"                           at the same time, each one in its own\n" \
+"                           process\n" \
 "  -I <dir>                 Adds <dir> into the searched include\n" \
 "                           directories\n" \
 "  -L <dir>                 Adds <dir> into the searched library\n" \
@@ -273,6 +282,17 @@
 "                           a 'x.mod' files wrapping 'x.mf03' and the\n" \
 "                           native Fortran compiler 'x.mod' file.\n" \
 "                           Instead, keep 'x.mf03' and native 'x.mod'.\n" \
+"  --fortran-module-format=<format>\n" \
+"                           Format used when writing Mercurium Fortran\n" \
+"                           modules. Valid formats are 'sqlite' (the\n" \
+"                           default) and 'binary' (a memory mapped\n" \
+"                           image, EXPERIMENTAL). Modules are read in\n" \
+"                           both formats but versions of Mercurium\n" \
+"                           without this option cannot read 'binary'\n" \
+"  --module-cache           EXPERIMENTAL: keeps Fortran modules\n" \
+"                           loaded in a file for the next files\n" \
+"                           compiled by this same invocation. They\n" \
+"                           share the symbols of the modules\n" \
 "  --do-not-warn-config     Do not warn about wrong configuration\n" \
 "                           file names\n" \
 "  --vector-flavor=<name>   When emitting vector types use given\n" \
@@ -306,6 +326,32 @@
 "  --ifort-compat           Enables some compatibility features\n" \
 "                           required by Intel Fortran\n" \
 "  --line-markers           Adds line markers to the generated file\n" \
+"  --ast-arena              EXPERIMENTAL: allocates the trees of each\n" \
+"                           file in an arena that is released at once\n" \
+"                           when the file has been processed\n" \
+"  --cache-dir=<dir>        EXPERIMENTAL: keeps the outputs of C and\n" \
+"                           C++ files in <dir> and reuses them when\n" \
+"                           the preprocessed file and the\n" \
+"                           configuration have not changed\n" \
+"  --cache-size=<n>[K|M|G]  EXPERIMENTAL: size limit of the cache of\n" \
+"                           --cache-dir. Default is 1G\n" \
+"  --cache-stats            EXPERIMENTAL: prints the statistics of the\n" \
+"                           cache of --cache-dir and exits\n" \
+"  --lazy-implicit-members  EXPERIMENTAL: declares the implicit\n" \
+"                           special members of C++ classes only\n" \
+"                           when they are looked up\n" \
+"  --lazy-inline-bodies     EXPERIMENTAL: analyzes the bodies of\n" \
+"                           inline functions of included files only\n" \
+"                           if the file references them\n" \
+"  --native-jobs=<n>        EXPERIMENTAL: runs up to <n> native\n" \
+"                           compilations in the background while\n" \
+"                           the next files are processed\n" \
+"  --pipes                  EXPERIMENTAL: reads the output of the\n" \
+"                           preprocessor and feeds the native\n" \
+"                           compiler through pipes instead of\n" \
+"                           intermediate files. Only for C and C++.\n" \
+"                           The native compiler must understand\n" \
+"                           '-x <language> -'. Ignored with -k\n" \
 "  --parallel               EXPERIMENTAL: behave in a way that \n" \
 "                           allows parallel compilation of the same\n" \
 "                           source codes without reusing intermediate\n" \
@@ -372,12 +418,19 @@ typedef enum
     OPTION_UNDEFINED = 1024,
     // Keep the following options sorted (but leave OPTION_UNDEFINED as is)
     OPTION_ALWAYS_PREPROCESS,
+    OPTION_AST_ARENA,
+    OPTION_CACHE_DIR,
+    OPTION_CACHE_SIZE,
+    OPTION_CACHE_STATS,
+    OPTION_LAZY_IMPLICIT_MEMBERS,
+    OPTION_LAZY_INLINE_BODIES,
     OPTION_CONFIG_DIR,
     OPTION_CUDA,
     OPTION_DEBUG_FLAG,
     OPTION_DISABLE_FILE_LOCKING,
     OPTION_DISABLE_GXX_TRAITS,
     OPTION_DISABLE_INTRINSICS,
+    OPTION_MODULE_CACHE,
     OPTION_DISABLE_SIZEOF,
     OPTION_DO_NOT_PROCESS_FILE,
     OPTION_DO_NOT_UNLOAD_PHASES,
@@ -399,6 +452,7 @@ typedef enum
     OPTION_FORTRAN_FREE,
     OPTION_FORTRAN_INTEGER_KIND,
     OPTION_FORTRAN_LOGICAL_KIND,
+    OPTION_FORTRAN_MODULE_FORMAT,
     OPTION_FORTRAN_NAME_MANGLING,
     OPTION_FORTRAN_PREPROCESSOR,
     OPTION_FORTRAN_PRESCANNER,
@@ -415,6 +469,7 @@ typedef enum
     OPTION_LIST_VECTOR_FLAVORS,
     OPTION_MODULE_OUT_PATTERN,
     OPTION_NATIVE_COMPILER_NAME,
+    OPTION_NATIVE_JOBS,
     OPTION_NO_CUDA,
     OPTION_NO_OPENCL,
     OPTION_NO_WHOLE_FILE,
@@ -423,6 +478,7 @@ typedef enum
     OPTION_OUTPUT_DIRECTORY,
     OPTION_PARALLEL,
     OPTION_PASS_THROUGH,
+    OPTION_PIPES,
     OPTION_PREPROCESSOR_NAME,
     OPTION_PREPROCESSOR_USES_STDOUT,
     OPTION_PRINT_CONFIG_DIR,
@@ -440,7 +496,7 @@ typedef enum
 
 
 // It mimics getopt
-#define SHORT_OPTIONS_STRING "vVkKcho:EyI:J:L:l:gD:U:x:"
+#define SHORT_OPTIONS_STRING "vVkKcho:EyI:J:L:l:gD:U:x:j:"
 // This one mimics getopt_long but with one less field (the third one is not given)
 struct command_line_long_options command_line_long_options[] =
 {
@@ -451,6 +507,7 @@ struct command_line_long_options command_line_long_options[] =
     {"keep-files",  CLP_NO_ARGUMENT, 'k'},
     {"keep-all-files", CLP_NO_ARGUMENT, 'K'},
     {"output",      CLP_REQUIRED_ARGUMENT, 'o'},
+    {"jobs",        CLP_REQUIRED_ARGUMENT, 'j'},
 
     // This option has a chicken-and-egg problem. If we delay till getopt_long
     // to open the configuration file we overwrite variables defined in the
@@ -508,6 +565,8 @@ struct command_line_long_options command_line_long_options[] =
     {"module-out-pattern", CLP_REQUIRED_ARGUMENT, OPTION_MODULE_OUT_PATTERN},
     {"do-not-warn-config", CLP_NO_ARGUMENT, OPTION_DO_NOT_WARN_BAD_CONFIG_FILENAMES},
     {"do-not-wrap-modules", CLP_NO_ARGUMENT, OPTION_DO_NOT_WRAP_FORTRAN_MODULES },
+    {"fortran-module-format", CLP_REQUIRED_ARGUMENT, OPTION_FORTRAN_MODULE_FORMAT },
+    {"module-cache", CLP_NO_ARGUMENT, OPTION_MODULE_CACHE },
     {"vector-flavor", CLP_REQUIRED_ARGUMENT, OPTION_VECTOR_FLAVOR},
     {"vector-flavour", CLP_REQUIRED_ARGUMENT, OPTION_VECTOR_FLAVOR},
     {"list-vector-flavors", CLP_NO_ARGUMENT, OPTION_LIST_VECTOR_FLAVORS},
@@ -522,7 +581,15 @@ struct command_line_long_options command_line_long_options[] =
     {"xl-compat", CLP_NO_ARGUMENT, OPTION_XL_COMPATIBILITY },
     {"ifort-compat", CLP_NO_ARGUMENT, OPTION_IFORT_COMPATIBILITY },
     {"line-markers", CLP_NO_ARGUMENT, OPTION_LINE_MARKERS },
+    {"ast-arena", CLP_NO_ARGUMENT, OPTION_AST_ARENA },
+    {"lazy-implicit-members", CLP_NO_ARGUMENT, OPTION_LAZY_IMPLICIT_MEMBERS },
+    {"lazy-inline-bodies", CLP_NO_ARGUMENT, OPTION_LAZY_INLINE_BODIES },
+    {"native-jobs", CLP_REQUIRED_ARGUMENT, OPTION_NATIVE_JOBS },
+    {"cache-dir", CLP_REQUIRED_ARGUMENT, OPTION_CACHE_DIR },
+    {"cache-size", CLP_REQUIRED_ARGUMENT, OPTION_CACHE_SIZE },
+    {"cache-stats", CLP_NO_ARGUMENT, OPTION_CACHE_STATS },
     {"parallel", CLP_NO_ARGUMENT, OPTION_PARALLEL },
+    {"pipes", CLP_NO_ARGUMENT, OPTION_PIPES },
     {"Xcompiler", CLP_REQUIRED_ARGUMENT, OPTION_XCOMPILER },
     // sentinel
     {NULL, 0, 0}
@@ -561,13 +628,23 @@ static void compiler_phases_pre_execution(
         compilation_configuration_t* config,
         translation_unit_t* translation_unit,
         const char* parsed_filename);
-static const char* preprocess_translation_unit(translation_unit_t* translation_unit, const char* input_filename);
+static const char* preprocess_translation_unit(translation_unit_t* translation_unit, const char* input_filename,
+        char** preprocessed_buffer, size_t* preprocessed_length);
+static char use_pipes(void);
 static void parse_translation_unit(translation_unit_t* translation_unit, const char* parsed_filename);
+static void lexer_benchmark(translation_unit_t* translation_unit, const char* parsed_filename);
+static void lexer_benchmark_print_totals(void);
 static void initialize_semantic_analysis(translation_unit_t* translation_unit, const char* parsed_filename);
 static void semantic_analysis(translation_unit_t* translation_unit, const char* parsed_filename);
+static void release_ast_arena(translation_unit_t* translation_unit);
 static const char* codegen_translation_unit(translation_unit_t* translation_unit, const char* parsed_filename);
+static void codegen_translation_unit_into_file(translation_unit_t* translation_unit,
+        FILE* prettyprint_file, const char* output_filename);
 static void native_compilation(translation_unit_t* translation_unit, 
-        const char* prettyprinted_filename, char remove_input);
+        const char* prettyprinted_filename, char remove_input,
+        char codegen_into_stdin);
+static const char* native_compilation_output_filename(translation_unit_t* translation_unit);
+static void wait_native_compilations(void);
 
 #if !defined(WIN32_BUILD) || defined(__CYGWIN__)
 static void terminating_signal_handler(int sig);
@@ -666,11 +743,22 @@ int main(int argc, char* argv[])
     // Compilation of every specified translation unit
     compile_every_translation_unit();
 
-    // Embed files
-    embed_files();
+    if (debug_options.lexer_benchmark)
+    {
+        // Files have only been scanned, there is nothing to embed or link
+        lexer_benchmark_print_totals();
+    }
+    else
+    {
+        // Embed files
+        embed_files();
 
-    // Link all generated objects
-    link_objects();
+        // Outputs are final once embedded
+        compilation_cache_store_pending();
+
+        // Link all generated objects
+        link_objects();
+    }
 
     // Unload phases
     if (!do_not_unload_phases)
@@ -1154,6 +1242,27 @@ int parse_arguments(int argc, const char* argv[],
                         // and ignored here
                         break;
                     }
+                case 'j' : // -j || --jobs
+                    {
+                        int num_jobs = 0;
+                        if (parameter_info.argument != NULL)
+                            num_jobs = atoi(parameter_info.argument);
+
+                        if (num_jobs <= 0)
+                        {
+                            fprintf(stderr, "%s: invalid number of jobs '%s'\n",
+                                    compilation_process.exec_basename,
+                                    parameter_info.argument != NULL ? parameter_info.argument : "");
+                            return 1;
+                        }
+                        compilation_process.num_jobs = num_jobs;
+                        if (num_jobs > 1)
+                        {
+                            // Workers must not reuse intermediate filenames
+                            compilation_process.parallel_process = 1;
+                        }
+                        break;
+                    }
                 case 'o' :
                     {
                         if (output_file != NULL)
@@ -1506,6 +1615,30 @@ int parse_arguments(int argc, const char* argv[],
                         CURRENT_CONFIGURATION->do_not_wrap_fortran_modules = 1;
                         break;
                     }
+                case OPTION_FORTRAN_MODULE_FORMAT:
+                    {
+                        if (strcmp(parameter_info.argument, "sqlite") == 0)
+                        {
+                            CURRENT_CONFIGURATION->fortran_binary_modules = 0;
+                        }
+                        else if (strcmp(parameter_info.argument, "binary") == 0)
+                        {
+                            CURRENT_CONFIGURATION->fortran_binary_modules = 1;
+                        }
+                        else
+                        {
+                            fprintf(stderr, "%s: invalid Fortran module format '%s'. Valid formats are 'sqlite' and 'binary'\n",
+                                    compilation_process.exec_basename,
+                                    parameter_info.argument);
+                            return 1;
+                        }
+                        break;
+                    }
+                case OPTION_MODULE_CACHE:
+                    {
+                        CURRENT_CONFIGURATION->fortran_module_cache = 1;
+                        break;
+                    }
                 case OPTION_INSTANTIATE_TEMPLATES:
                     {
                         CURRENT_CONFIGURATION->explicit_instantiation = 1;
@@ -1656,11 +1789,67 @@ int parse_arguments(int argc, const char* argv[],
                         CURRENT_CONFIGURATION->line_markers = 1;
                         break;
                     }
+                case OPTION_AST_ARENA:
+                    {
+                        CURRENT_CONFIGURATION->ast_arena = 1;
+                        break;
+                    }
+                case OPTION_LAZY_IMPLICIT_MEMBERS:
+                    {
+                        CURRENT_CONFIGURATION->lazy_implicit_members = 1;
+                        break;
+                    }
+                case OPTION_LAZY_INLINE_BODIES:
+                    {
+                        CURRENT_CONFIGURATION->lazy_inline_bodies = 1;
+                        break;
+                    }
+                case OPTION_CACHE_DIR:
+                    {
+                        compilation_process.cache_dir = uniquestr(parameter_info.argument);
+                        break;
+                    }
+                case OPTION_CACHE_SIZE:
+                    {
+                        unsigned long long cache_size = compilation_cache_parse_size(parameter_info.argument);
+                        if (cache_size == 0)
+                        {
+                            fprintf(stderr, "%s: invalid cache size '%s'\n",
+                                    compilation_process.exec_basename,
+                                    parameter_info.argument);
+                            return 1;
+                        }
+                        compilation_process.cache_size = cache_size;
+                        break;
+                    }
+                case OPTION_CACHE_STATS:
+                    {
+                        compilation_process.print_cache_stats = 1;
+                        break;
+                    }
+                case OPTION_NATIVE_JOBS:
+                    {
+                        int num_native_jobs = atoi(parameter_info.argument);
+                        if (num_native_jobs <= 0)
+                        {
+                            fprintf(stderr, "%s: invalid number of native jobs '%s'\n",
+                                    compilation_process.exec_basename,
+                                    parameter_info.argument);
+                            return 1;
+                        }
+                        compilation_process.num_native_jobs = num_native_jobs;
+                        break;
+                    }
                 case OPTION_PARALLEL:
                     {
                         compilation_process.parallel_process = 1;
                         break;
                     }
+                case OPTION_PIPES:
+                    {
+                        CURRENT_CONFIGURATION->use_pipes = 1;
+                        break;
+                    }
                 case OPTION_XCOMPILER:
                     {
                         const char * parameter[] = { uniquestr(parameter_info.argument) };
@@ -1696,6 +1885,13 @@ int parse_arguments(int argc, const char* argv[],
         return 0;
     }
 
+    if (compilation_process.print_cache_stats)
+    {
+        // --cache-stats has been given, --cache-dir may follow it
+        compilation_cache_print_stats();
+        exit(EXIT_SUCCESS);
+    }
+
     if (num_input_files == 0
             && !linker_files_seen
             && !v_specified
@@ -2675,6 +2871,7 @@ static void initialize_default_values(void)
     // Initialize here all default values
     compilation_process.config_dir = strappend(compilation_process.home_directory, DIR_CONFIG_RELATIVE_PATH);
     compilation_process.num_translation_units = 0;
+    compilation_process.cache_size = COMPILATION_CACHE_DEFAULT_SIZE;
 
     // The minimal default configuration
     memset(&minimal_default_configuration, 0, sizeof(minimal_default_configuration));
@@ -3049,6 +3246,51 @@ static void register_upc_pragmae(compilation_configuration_t* configuration)
     register_new_directive(configuration, "distributed", "", /* is_construct */ 0, /* bound_to_single_stmt */ 0);
 }
 
+// Returns the output of the translation unit that the compilation cache
+// (--cache-dir) can provide, or NULL if it cannot be cached. Only files given
+// in the command line are cached, their secondary translation units are
+// embedded in the cached output. Fortran is not cached because compiling it
+// has side effects, like module files
+static const char* compilation_cache_output_filename(compilation_file_process_t* file_process,
+        struct extensions_table_t* current_extension,
+        char file_not_processed)
+{
+    if (compilation_process.cache_dir == NULL
+            || file_not_processed
+            || CURRENT_CONFIGURATION->pass_through
+            || CURRENT_CONFIGURATION->do_not_parse
+            || CURRENT_CONFIGURATION->do_not_prettyprint
+            || debug_options.do_not_codegen
+            || debug_options.binary_check
+            || IS_FORTRAN_LANGUAGE)
+        return NULL;
+
+    char is_primary = 0;
+    int i;
+    for (i = 0; i < compilation_process.num_translation_units && !is_primary; i++)
+    {
+        is_primary = (compilation_process.translation_units[i] == file_process);
+    }
+    if (!is_primary)
+        return NULL;
+
+    translation_unit_t* translation_unit = file_process->translation_unit;
+    if (!CURRENT_CONFIGURATION->do_not_compile
+            && !BITMAP_TEST(current_extension->source_kind, SOURCE_KIND_DO_NOT_COMPILE))
+    {
+        return native_compilation_output_filename(translation_unit);
+    }
+    else if (CURRENT_CONFIGURATION->do_not_compile
+            && CURRENT_CONFIGURATION->do_not_link
+            && translation_unit->output_filename != NULL
+            && strcmp(translation_unit->output_filename, "-") != 0)
+    {
+        return translation_unit->output_filename;
+    }
+
+    return NULL;
+}
+
 static void compile_every_translation_unit_aux_(int num_translation_units,
         compilation_file_process_t** translation_units)
 {
@@ -3127,6 +3369,9 @@ static void compile_every_translation_unit_aux_(int num_translation_units,
         }
 
         const char* parsed_filename = translation_unit->input_filename;
+        // Output of the preprocessor when it is read through a pipe
+        char* preprocessed_buffer = NULL;
+        size_t preprocessed_length = 0;
         // If the file is not preprocessed or we've ben told to preprocess it
         if (((BITMAP_TEST(current_extension->source_kind, SOURCE_KIND_NOT_PREPROCESSED)
                     || BITMAP_TEST(CURRENT_CONFIGURATION->force_source_kind, SOURCE_KIND_NOT_PREPROCESSED))
@@ -3145,7 +3390,9 @@ static void compile_every_translation_unit_aux_(int num_translation_units,
             }
 
             timing_start(&timing_preprocessing);
-            parsed_filename = preprocess_translation_unit(translation_unit, translation_unit->input_filename);
+            // Files not processed are not scanned, so they do not use a pipe
+            parsed_filename = preprocess_translation_unit(translation_unit, translation_unit->input_filename,
+                    file_not_processed ? NULL : &preprocessed_buffer, &preprocessed_length);
             timing_end(&timing_preprocessing);
 
             FORTRAN_LANGUAGE()
@@ -3168,6 +3415,25 @@ static void compile_every_translation_unit_aux_(int num_translation_units,
             }
         }
 
+        // * Look up the output in the compilation cache
+        const char* cached_output_filename = compilation_cache_output_filename(file_process,
+                current_extension, file_not_processed);
+        if (cached_output_filename != NULL)
+        {
+            // The loaded libraries are part of the key, so codegen must be
+            // loaded like the compiler phases, which already are
+            ensure_codegen_is_loaded();
+        }
+        if (cached_output_filename != NULL
+                && compilation_cache_lookup(translation_unit, cached_output_filename,
+                    parsed_filename, preprocessed_buffer, preprocessed_length))
+        {
+            DELETE(preprocessed_buffer);
+            CURRENT_CONFIGURATION->enable_cuda = old_cuda_flag;
+            file_process->already_compiled = 1;
+            continue;
+        }
+
         char is_fixed_form  = (current_extension->source_language == SOURCE_LANGUAGE_FORTRAN
                 // We prescan from fixed to free if 
                 //  - the file is fixed form OR we are forced to be fixed for (--fixed)
@@ -3198,28 +3464,57 @@ static void compile_every_translation_unit_aux_(int num_translation_units,
                 initialize_semantic_analysis(translation_unit, parsed_filename);
 
                 // * Open file
-                CXX_LANGUAGE()
+                if (preprocessed_buffer != NULL)
                 {
-                    if (mcxx_open_file_for_scanning(parsed_filename, translation_unit->input_filename) != 0)
+                    // The scanner releases the buffer
+                    CXX_LANGUAGE()
                     {
-                        fatal_error("Could not open file '%s'", parsed_filename);
+                        mcxx_open_buffer_for_scanning(preprocessed_buffer, preprocessed_length,
+                                parsed_filename, translation_unit->input_filename);
                     }
+                    C_LANGUAGE()
+                    {
+                        mc99_open_buffer_for_scanning(preprocessed_buffer, preprocessed_length,
+                                parsed_filename, translation_unit->input_filename);
+                    }
+                    preprocessed_buffer = NULL;
                 }
-
-                C_LANGUAGE()
+                else
                 {
-                    if (mc99_open_file_for_scanning(parsed_filename, translation_unit->input_filename) != 0)
+                    CXX_LANGUAGE()
                     {
-                        fatal_error("Could not open file '%s'", parsed_filename);
+                        if (mcxx_open_file_for_scanning(parsed_filename, translation_unit->input_filename) != 0)
+                        {
+                            fatal_error("Could not open file '%s'", parsed_filename);
+                        }
                     }
-                }
 
-                FORTRAN_LANGUAGE()
-                {
-                    if (mf03_open_file_for_scanning(parsed_filename, translation_unit->input_filename, is_fixed_form) != 0)
+                    C_LANGUAGE()
                     {
-                        fatal_error("Could not open file '%s'", parsed_filename);
+                        if (mc99_open_file_for_scanning(parsed_filename, translation_unit->input_filename) != 0)
+                        {
+                            fatal_error("Could not open file '%s'", parsed_filename);
+                        }
                     }
+
+                    FORTRAN_LANGUAGE()
+                    {
+                        if (mf03_open_file_for_scanning(parsed_filename, translation_unit->input_filename, is_fixed_form) != 0)
+                        {
+                            fatal_error("Could not open file '%s'", parsed_filename);
+                        }
+                    }
+                }
+
+                if (debug_options.lexer_benchmark
+                        && !IS_FORTRAN_LANGUAGE)
+                {
+                    // The file is only scanned, nothing else is done with it
+                    lexer_benchmark(translation_unit, parsed_filename);
+
+                    CURRENT_CONFIGURATION->enable_cuda = old_cuda_flag;
+                    file_process->already_compiled = 1;
+                    continue;
                 }
 
                 // * Parse file
@@ -3266,6 +3561,9 @@ static void compile_every_translation_unit_aux_(int num_translation_units,
                 // * TL::run and TL::phase_cleanup
                 compiler_phases_execution(CURRENT_CONFIGURATION, translation_unit, parsed_filename);
 
+                // * Define the deferred functions referenced by the phases
+                build_scope_define_referenced_deferred_functions(translation_unit);
+
                 // * print ast if requested
                 if (debug_options.print_nodecl_graphviz)
                 {
@@ -3290,11 +3588,32 @@ static void compile_every_translation_unit_aux_(int num_translation_units,
 
             // * Codegen
             const char* prettyprinted_filename = NULL;
+            char codegen_into_native_compiler = 0;
             if (!file_not_processed
                     && !debug_options.do_not_codegen)
             {
-                prettyprinted_filename
-                    = codegen_translation_unit(translation_unit, parsed_filename);
+                // Secondary translation units are compiled before this
+                // one, so in that case the prettyprinted file is kept
+                codegen_into_native_compiler = use_pipes()
+                    && file_process->num_secondary_translation_units == 0
+                    && !CURRENT_CONFIGURATION->do_not_prettyprint
+                    && !CURRENT_CONFIGURATION->do_not_compile
+                    && !CURRENT_CONFIGURATION->pass_through
+                    && !debug_options.binary_check
+                    && !BITMAP_TEST(current_extension->source_kind, SOURCE_KIND_DO_NOT_COMPILE);
+
+                if (codegen_into_native_compiler)
+                {
+                    // The native compiler reads the prettyprinted file
+                    // from a pipe, so it is compiled right now
+                    native_compilation(translation_unit, "-", /* remove_input */ 0,
+                            /* codegen_into_stdin */ 1);
+                }
+                else
+                {
+                    prettyprinted_filename
+                        = codegen_translation_unit(translation_unit, parsed_filename);
+                }
             }
 
             timing_t timing_free_tree;
@@ -3306,7 +3625,15 @@ static void compile_every_translation_unit_aux_(int num_translation_units,
                 }
             }
             timing_start(&timing_free_tree);
-            nodecl_free(translation_unit->nodecl);
+            build_scope_release_deferred_functions();
+            if (translation_unit->ast_arena != NULL)
+            {
+                release_ast_arena(translation_unit);
+            }
+            else
+            {
+                nodecl_free(translation_unit->nodecl);
+            }
             timing_end(&timing_free_tree);
             if (CURRENT_CONFIGURATION->verbose)
             {
@@ -3345,14 +3672,20 @@ static void compile_every_translation_unit_aux_(int num_translation_units,
             if (!BITMAP_TEST(current_extension->source_kind, SOURCE_KIND_DO_NOT_COMPILE))
             {
                 // * Native compilation
-                if (!file_not_processed)
+                if (codegen_into_native_compiler)
                 {
-                    native_compilation(translation_unit, prettyprinted_filename, /* remove_input */ 1);
+                    // Already done when prettyprinting
+                }
+                else if (!file_not_processed)
+                {
+                    native_compilation(translation_unit, prettyprinted_filename, /* remove_input */ 1,
+                            /* codegen_into_stdin */ 0);
                 }
                 else
                 {
                     // Do not process
-                    native_compilation(translation_unit, translation_unit->input_filename, /* remove_input */ 0);
+                    native_compilation(translation_unit, translation_unit->input_filename, /* remove_input */ 0,
+                            /* codegen_into_stdin */ 0);
                 }
             }
 
@@ -3397,8 +3730,266 @@ static void compile_every_translation_unit_aux_(int num_translation_units,
 #undef return
 }
 
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+/*
+ * Parallel compilation (-j)
+ *
+ * Every translation unit is compiled in its own worker process, a fork of the
+ * driver, and at most compilation_process.num_jobs workers run at the same
+ * time. A worker writes its standard output and error to temporal files that
+ * the driver prints, in the order of the translation units, once the worker
+ * ends. This way diagnostics do not depend on the scheduling of the workers.
+ *
+ * A Fortran translation unit may use the modules of the previous ones, so
+ * Fortran workers are run one after the other in the original order.
+ */
+typedef
+struct translation_unit_worker_tag
+{
+    pid_t pid;
+    char is_fortran;
+    char finished;
+    temporal_file_t stdout_file;
+    temporal_file_t stderr_file;
+} translation_unit_worker_t;
+
+typedef
+struct parallel_compilation_tag
+{
+    int num_translation_units;
+    compilation_file_process_t** translation_units;
+    translation_unit_worker_t* workers;
+
+    int num_running;
+    char fortran_running;
+    char failed;
+
+    // Output of workers before this one has already been printed
+    int next_to_flush;
+} parallel_compilation_t;
+
+static void copy_worker_output(temporal_file_t file, FILE* out)
+{
+    if (file == NULL)
+        return;
+
+    FILE* f = fopen(file->name, "r");
+    if (f == NULL)
+        return;
+
+    char buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0)
+    {
+        fwrite(buffer, 1, n, out);
+    }
+    fclose(f);
+
+    fflush(out);
+}
+
+static void flush_translation_unit_workers(parallel_compilation_t* parallel)
+{
+    while (parallel->next_to_flush < parallel->num_translation_units
+            && parallel->workers[parallel->next_to_flush].finished)
+    {
+        translation_unit_worker_t* worker = &parallel->workers[parallel->next_to_flush];
+
+        copy_worker_output(worker->stdout_file, stdout);
+        copy_worker_output(worker->stderr_file, stderr);
+
+        parallel->next_to_flush++;
+    }
+}
+
+static void wait_for_translation_unit_worker(parallel_compilation_t* parallel)
+{
+    int status = 0;
+    pid_t pid = waitpid(-1, &status, 0);
+
+    if (pid < 0)
+    {
+        fatal_error("error: waiting for a compilation process failed (%s)", strerror(errno));
+    }
+
+    int i;
+    for (i = 0; i < parallel->num_translation_units; i++)
+    {
+        translation_unit_worker_t* worker = &parallel->workers[i];
+        if (worker->pid != pid
+                || worker->finished)
+            continue;
+
+        worker->finished = 1;
+        parallel->translation_units[i]->already_compiled = 1;
+
+        parallel->num_running--;
+        if (worker->is_fortran)
+            parallel->fortran_running = 0;
+
+        if (WIFSIGNALED(status))
+        {
+            fprintf(stderr, "%s: compilation of '%s' was ended with signal %d\n",
+                    compilation_process.exec_basename,
+                    parallel->translation_units[i]->translation_unit->input_filename,
+                    WTERMSIG(status));
+            parallel->failed = 1;
+        }
+        else if (!WIFEXITED(status)
+                || WEXITSTATUS(status) != 0)
+        {
+            parallel->failed = 1;
+        }
+        break;
+    }
+
+    flush_translation_unit_workers(parallel);
+}
+
+static void start_translation_unit_worker(parallel_compilation_t* parallel, int num)
+{
+    compilation_file_process_t* file_process = parallel->translation_units[num];
+    translation_unit_worker_t* worker = &parallel->workers[num];
+
+    worker->stdout_file = new_temporal_file();
+    worker->stderr_file = new_temporal_file();
+
+    // The object filenames are needed by the driver when linking
+    const char* extension = get_extension_filename(file_process->translation_unit->input_filename);
+    struct extensions_table_t* current_extension = fileextensions_lookup(extension, strlen(extension));
+
+    compilation_configuration_t* saved_configuration = CURRENT_CONFIGURATION;
+    SET_CURRENT_CONFIGURATION(file_process->compilation_configuration);
+    if (!CURRENT_CONFIGURATION->do_not_link
+            && !CURRENT_CONFIGURATION->do_not_compile
+            && !debug_options.do_not_codegen
+            && !BITMAP_TEST(current_extension->source_kind, SOURCE_KIND_DO_NOT_COMPILE))
+    {
+        native_compilation_output_filename(file_process->translation_unit);
+    }
+    SET_CURRENT_CONFIGURATION(saved_configuration);
+
+    // Do not duplicate pending output in the worker
+    fflush(stdout);
+    fflush(stderr);
+
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        fatal_error("error: could not fork to compile '%s' (%s)",
+                file_process->translation_unit->input_filename,
+                strerror(errno));
+    }
+    else if (pid == 0) // I'm the worker
+    {
+        if (freopen(worker->stdout_file->name, "w", stdout) == NULL
+                || freopen(worker->stderr_file->name, "w", stderr) == NULL)
+        {
+            _exit(EXIT_FAILURE);
+        }
+
+        // The temporal files known so far belong to the driver
+        temporal_files_forget();
+
+        // Secondary translation units are compiled serially by this worker
+        compilation_process.num_jobs = 1;
+
+        compile_every_translation_unit_aux_(1, &parallel->translation_units[num]);
+
+        // Only this translation unit may have secondary ones here
+        embed_files();
+
+        compilation_cache_store_pending();
+
+        exit(compilation_process.execution_result);
+    }
+
+    worker->pid = pid;
+    parallel->num_running++;
+    if (worker->is_fortran)
+        parallel->fortran_running = 1;
+}
+
+static void compile_every_translation_unit_in_parallel(int num_translation_units,
+        compilation_file_process_t** translation_units)
+{
+    parallel_compilation_t parallel;
+    memset(&parallel, 0, sizeof(parallel));
+
+    parallel.num_translation_units = num_translation_units;
+    parallel.translation_units = translation_units;
+    parallel.workers = NEW_VEC0(translation_unit_worker_t, num_translation_units);
+
+    int i;
+    for (i = 0; i < num_translation_units && !parallel.failed; i++)
+    {
+        compilation_file_process_t* file_process = translation_units[i];
+        translation_unit_worker_t* worker = &parallel.workers[i];
+
+        const char* extension = get_extension_filename(file_process->translation_unit->input_filename);
+        struct extensions_table_t* current_extension = fileextensions_lookup(extension, strlen(extension));
+
+        if (file_process->already_compiled
+                || current_extension->source_language == SOURCE_LANGUAGE_LINKER_DATA)
+        {
+            // Nothing to compile here
+            file_process->already_compiled = 1;
+            worker->finished = 1;
+            flush_translation_unit_workers(&parallel);
+            continue;
+        }
+
+        worker->is_fortran = (current_extension->source_language == SOURCE_LANGUAGE_FORTRAN
+                || file_process->compilation_configuration->source_language == SOURCE_LANGUAGE_FORTRAN);
+
+        while (!parallel.failed
+                && (parallel.num_running == compilation_process.num_jobs
+                    || (worker->is_fortran && parallel.fortran_running)))
+        {
+            wait_for_translation_unit_worker(&parallel);
+        }
+
+        // Like the serial compilation, stop at the first failure
+        if (parallel.failed)
+            break;
+
+        start_translation_unit_worker(&parallel, i);
+    }
+
+    while (parallel.num_running > 0)
+    {
+        wait_for_translation_unit_worker(&parallel);
+    }
+
+    // Translation units not compiled after a failure do not have output
+    for (i = parallel.next_to_flush; i < num_translation_units; i++)
+    {
+        parallel.workers[i].finished = 1;
+    }
+    flush_translation_unit_workers(&parallel);
+
+    DELETE(parallel.workers);
+
+    if (parallel.failed)
+    {
+        exit(EXIT_FAILURE);
+    }
+}
+#endif
+
 static void compile_every_translation_unit(void)
 {
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+    if (compilation_process.num_jobs > 1
+            && compilation_process.num_translation_units > 1
+            // Totals of the lexer benchmark are kept by this process
+            && !debug_options.lexer_benchmark)
+    {
+        compile_every_translation_unit_in_parallel(compilation_process.num_translation_units,
+                compilation_process.translation_units);
+        return;
+    }
+#endif
     compile_every_translation_unit_aux_(compilation_process.num_translation_units,
             compilation_process.translation_units);
 }
@@ -3439,6 +4030,51 @@ static void compiler_phases_execution(
     }
 }
 
+// Totals of every file scanned with the lexer_benchmark debug flag
+static int lexer_benchmark_num_files = 0;
+static long long lexer_benchmark_num_tokens = 0;
+static double lexer_benchmark_elapsed = 0.0;
+
+static void lexer_benchmark(translation_unit_t* translation_unit, const char* parsed_filename)
+{
+    timing_t timing_lexing;
+    timing_start(&timing_lexing);
+
+    int num_tokens = 0;
+    CXX_LANGUAGE()
+    {
+        num_tokens = mcxx_lex_all_tokens();
+    }
+
+    C_LANGUAGE()
+    {
+        num_tokens = mc99_lex_all_tokens();
+    }
+
+    timing_end(&timing_lexing);
+
+    double elapsed = timing_elapsed(&timing_lexing);
+    fprintf(stderr, "File '%s' ('%s') scanned: %d tokens in %.3f seconds (%.0f tokens per second)\n",
+            translation_unit->input_filename,
+            parsed_filename,
+            num_tokens,
+            elapsed,
+            elapsed > 0 ? num_tokens / elapsed : 0.0);
+
+    lexer_benchmark_num_files++;
+    lexer_benchmark_num_tokens += num_tokens;
+    lexer_benchmark_elapsed += elapsed;
+}
+
+static void lexer_benchmark_print_totals(void)
+{
+    fprintf(stderr, "%d files scanned: %lld tokens in %.3f seconds (%.0f tokens per second)\n",
+            lexer_benchmark_num_files,
+            lexer_benchmark_num_tokens,
+            lexer_benchmark_elapsed,
+            lexer_benchmark_elapsed > 0 ? lexer_benchmark_num_tokens / lexer_benchmark_elapsed : 0.0);
+}
+
 static void parse_translation_unit(translation_unit_t* translation_unit, const char* parsed_filename)
 {
     timing_t timing_parsing;
@@ -3501,6 +4137,12 @@ static AST get_translation_unit_node(void)
 static void initialize_semantic_analysis(translation_unit_t* translation_unit, 
         const char* parsed_filename UNUSED_PARAMETER)
 {
+    if (CURRENT_CONFIGURATION->ast_arena)
+    {
+        translation_unit->ast_arena = mem_arena_new(/* default chunk size */ 0);
+        ast_set_current_arena(translation_unit->ast_arena);
+    }
+
     translation_unit->parsed_tree = get_translation_unit_node();
     if (IS_C_LANGUAGE
             || IS_CXX_LANGUAGE)
@@ -3554,6 +4196,14 @@ static void semantic_analysis(translation_unit_t* translation_unit, const char*
                 translation_unit->input_filename,
                 parsed_filename,
                 timing_elapsed(&timing_semantic));
+
+        if (IS_CXX_LANGUAGE)
+        {
+            int num_hits = 0, num_misses = 0;
+            overload_get_stats(&num_hits, &num_misses);
+            fprintf(stderr, "Overload resolutions: %d memoized, %d solved\n",
+                    num_hits, num_misses);
+        }
     }
 
     char there_were_errors = (diagnostics_get_error_count() != 0);
@@ -3594,7 +4244,9 @@ static void semantic_analysis(translation_unit_t* translation_unit, const char*
         fprintf(stderr, "Freeing parse tree\n");
     }
     timing_start(&timing_free_tree);
-    ast_free(translation_unit->parsed_tree);
+    // Nodes in the arena are released at the end of the translation unit
+    if (translation_unit->ast_arena == NULL)
+        ast_free(translation_unit->parsed_tree);
     translation_unit->parsed_tree = NULL;
     timing_end(&timing_free_tree);
     if (CURRENT_CONFIGURATION->verbose)
@@ -3603,6 +4255,18 @@ static void semantic_analysis(translation_unit_t* translation_unit, const char*
     }
 }
 
+static void release_ast_arena(translation_unit_t* translation_unit)
+{
+    if (ast_get_current_arena() == translation_unit->ast_arena)
+        ast_set_current_arena(NULL);
+
+    mem_arena_get_stats(translation_unit->ast_arena, &translation_unit->ast_arena_stats);
+    mem_arena_destroy(translation_unit->ast_arena);
+
+    translation_unit->ast_arena = NULL;
+    translation_unit->nodecl = nodecl_null();
+}
+
 static const char* codegen_translation_unit(translation_unit_t* translation_unit, 
         const char* parsed_filename UNUSED_PARAMETER)
 {
@@ -3703,6 +4367,20 @@ static const char* codegen_translation_unit(translation_unit_t* translation_unit
                 strerror(errno));
     }
 
+    codegen_translation_unit_into_file(translation_unit, prettyprint_file, output_filename);
+
+    if (prettyprint_file != stdout)
+    {
+        fclose(prettyprint_file);
+    }
+
+    return output_filename;
+}
+
+static void codegen_translation_unit_into_file(translation_unit_t* translation_unit,
+        FILE* prettyprint_file,
+        const char* output_filename)
+{
     timing_t time_print;
     timing_start(&time_print);
 
@@ -3750,13 +4428,6 @@ static const char* codegen_translation_unit(translation_unit_t* translation_unit
     {
         fprintf(stderr, "Prettyprinted into file '%s' in %.2f seconds\n", output_filename, timing_elapsed(&time_print));
     }
-
-    if (prettyprint_file != stdout)
-    {
-        fclose(prettyprint_file);
-    }
-
-    return output_filename;
 }
 
 static char str_ends_with(const char* str, const char* name)
@@ -3950,7 +4621,23 @@ static void warn_preprocessor_flags(
     }
 }
 
-static const char* preprocess_single_file(const char* input_filename, const char* output_filename)
+// Pipes are only used for C and C++ because the Fortran scanner and the
+// handling of Fortran modules need files. Files are always kept with -k
+static char use_pipes(void)
+{
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+    return CURRENT_CONFIGURATION->use_pipes
+        && !CURRENT_CONFIGURATION->keep_files
+        && (IS_C_LANGUAGE || IS_CXX_LANGUAGE);
+#else
+    return 0;
+#endif
+}
+
+// If preprocessed_buffer is not NULL and pipes are used, the output of the
+// preprocessor is returned in *preprocessed_buffer instead of a file
+static const char* preprocess_single_file(const char* input_filename, const char* output_filename,
+        char** preprocessed_buffer, size_t* preprocessed_length)
 {
     int num_arguments = count_null_ended_array((void**)CURRENT_CONFIGURATION->preprocessor_options);
 
@@ -4007,6 +4694,33 @@ static const char* preprocess_single_file(const char* input_filename, const char
     preprocessor_options[i] = "-D_MERCURIUM";
     i++;
 
+    if (preprocessed_buffer != NULL
+            && use_pipes()
+            && !CURRENT_CONFIGURATION->do_not_parse
+            && !CURRENT_CONFIGURATION->pass_through)
+    {
+        // Without -o the preprocessor writes to its standard output
+        preprocessor_options[i] = input_filename;
+        i++;
+
+        int result_preprocess = execute_program_output(CURRENT_CONFIGURATION->preprocessor_name,
+                preprocessor_options, preprocessed_buffer, preprocessed_length);
+
+        if (result_preprocess == 0)
+        {
+            return uniquestr("(pipe)");
+        }
+        else
+        {
+            DELETE(*preprocessed_buffer);
+            *preprocessed_buffer = NULL;
+
+            fprintf(stderr, "Preprocessing failed. Returned code %d\n",
+                    result_preprocess);
+            return NULL;
+        }
+    }
+
     const char *preprocessed_filename = NULL;
 
     if (!CURRENT_CONFIGURATION->do_not_parse)
@@ -4072,32 +4786,24 @@ static const char* preprocess_single_file(const char* input_filename, const char
 }
 
 static const char* preprocess_translation_unit(translation_unit_t* translation_unit,
-        const char* input_filename)
+        const char* input_filename,
+        char** preprocessed_buffer, size_t* preprocessed_length)
 {
-    return preprocess_single_file(input_filename, translation_unit->output_filename);
+    return preprocess_single_file(input_filename, translation_unit->output_filename,
+            preprocessed_buffer, preprocessed_length);
 }
 
 // This one is meant to be used outside the driver. Some phases may need it
 const char* preprocess_file(const char* input_filename)
 {
-    return preprocess_single_file(input_filename, NULL);
+    return preprocess_single_file(input_filename, NULL,
+            /* preprocessed_buffer */ NULL, /* preprocessed_length */ NULL);
 }
 
-static void native_compilation(translation_unit_t* translation_unit, 
-        const char* prettyprinted_filename, 
-        char remove_input)
+// Sets the name of the file generated by the native compiler for
+// translation_unit, unless we do not link and it was given by the user
+static const char* native_compilation_output_filename(translation_unit_t* translation_unit)
 {
-    if (CURRENT_CONFIGURATION->do_not_compile
-            || debug_options.do_not_codegen)
-        return;
-
-    if (remove_input)
-    {
-        mark_file_for_cleanup(prettyprinted_filename);
-    }
-
-    const char* output_object_filename = NULL;
-
     if (translation_unit->output_filename == NULL
             || !CURRENT_CONFIGURATION->do_not_link)
     {
@@ -4112,20 +4818,155 @@ static void native_compilation(translation_unit_t* translation_unit,
 
         if (!CURRENT_CONFIGURATION->generate_assembler)
         {
-            output_object_filename = strappend(temp, ".o");
+            translation_unit->output_filename = strappend(temp, ".o");
         }
         else
         {
-            output_object_filename = strappend(temp, ".s");
+            translation_unit->output_filename = strappend(temp, ".s");
         }
+    }
 
-        translation_unit->output_filename = output_object_filename;
+    return translation_unit->output_filename;
+}
+
+/*
+ * Native compilations in the background (--native-jobs)
+ *
+ * The native compiler is started as soon as the translation unit has been
+ * prettyprinted and the driver goes on with the next translation unit. At
+ * most compilation_process.num_native_jobs native compilations run at the
+ * same time. They are waited in the order they were started, always before
+ * embedding and linking.
+ */
+typedef
+struct running_native_compilation_tag
+{
+    translation_unit_t* translation_unit;
+    const char* prettyprinted_filename;
+    running_program_t* running_program;
+    timing_t timing_compilation;
+    char verbose;
+} running_native_compilation_t;
+
+static running_native_compilation_t* running_native_compilations = NULL;
+static int num_running_native_compilations = 0;
+
+static void wait_oldest_native_compilation(void)
+{
+    ERROR_CONDITION(num_running_native_compilations == 0,
+            "There are not native compilations running", 0);
+
+    running_native_compilation_t native = running_native_compilations[0];
+
+    num_running_native_compilations--;
+    memmove(&running_native_compilations[0], &running_native_compilations[1],
+            num_running_native_compilations * sizeof(*running_native_compilations));
+
+    if (wait_program(native.running_program) != 0)
+    {
+        // Wait for the remaining ones before aborting
+        while (num_running_native_compilations > 0)
+        {
+            wait_oldest_native_compilation();
+        }
+        fatal_error("Native compilation failed for file '%s'", native.translation_unit->input_filename);
     }
-    else
+    timing_end(&native.timing_compilation);
+
+    if (native.verbose)
+    {
+        fprintf(stderr, "File '%s' ('%s') natively compiled in %.2f seconds\n", 
+                native.translation_unit->input_filename,
+                native.prettyprinted_filename,
+                timing_elapsed(&native.timing_compilation));
+    }
+}
+
+static void wait_native_compilations(void)
+{
+    while (num_running_native_compilations > 0)
+    {
+        wait_oldest_native_compilation();
+    }
+}
+
+// When codegen_into_stdin the translation unit is prettyprinted straight
+// into the standard input of the native compiler
+static running_program_t* start_native_compiler(translation_unit_t* translation_unit,
+        const char** native_compilation_args,
+        char codegen_into_stdin)
+{
+    if (!codegen_into_stdin)
+    {
+        return start_program(CURRENT_CONFIGURATION->native_compiler_name, native_compilation_args);
+    }
+
+    FILE* native_compiler_stdin = NULL;
+    running_program_t* running_program = start_program_with_input(CURRENT_CONFIGURATION->native_compiler_name,
+            native_compilation_args, &native_compiler_stdin);
+
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+    // If the native compiler ends early we will know it when waiting for it,
+    // do not let the driver be killed meanwhile
+    void (*old_sigpipe_handler)(int) = signal(SIGPIPE, SIG_IGN);
+#endif
+
+    codegen_translation_unit_into_file(translation_unit, native_compiler_stdin, "(pipe)");
+    fclose(native_compiler_stdin);
+
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+    signal(SIGPIPE, old_sigpipe_handler);
+#endif
+
+    return running_program;
+}
+
+static void start_native_compilation(translation_unit_t* translation_unit,
+        const char* prettyprinted_filename,
+        const char** native_compilation_args,
+        char codegen_into_stdin)
+{
+    if (running_native_compilations == NULL)
     {
-        output_object_filename = translation_unit->output_filename;
+        running_native_compilations = NEW_VEC0(running_native_compilation_t,
+                compilation_process.num_native_jobs);
     }
 
+    if (num_running_native_compilations == compilation_process.num_native_jobs)
+    {
+        wait_oldest_native_compilation();
+    }
+
+    running_native_compilation_t* native = &running_native_compilations[num_running_native_compilations];
+    num_running_native_compilations++;
+
+    native->translation_unit = translation_unit;
+    native->prettyprinted_filename = prettyprinted_filename;
+    native->verbose = CURRENT_CONFIGURATION->verbose;
+
+    timing_start(&native->timing_compilation);
+    native->running_program = start_native_compiler(translation_unit,
+            native_compilation_args, codegen_into_stdin);
+}
+
+// If codegen_into_stdin, prettyprinted_filename is "-" and the native compiler
+// reads the translation unit from a pipe
+static void native_compilation(translation_unit_t* translation_unit, 
+        const char* prettyprinted_filename, 
+        char remove_input,
+        char codegen_into_stdin)
+{
+    if (CURRENT_CONFIGURATION->do_not_compile
+            || debug_options.do_not_codegen)
+        return;
+
+    if (remove_input)
+    {
+        mark_file_for_cleanup(prettyprinted_filename);
+    }
+
+    const char* output_object_filename = native_compilation_output_filename(translation_unit);
+
     int num_args_compiler = count_null_ended_array((void**)CURRENT_CONFIGURATION->native_compiler_options);
 
     int num_arguments = num_args_compiler;
@@ -4154,6 +4995,8 @@ static void native_compilation(translation_unit_t* translation_unit,
 
     // -c -o output input
     num_arguments += 4;
+    // -x language
+    num_arguments += 2;
     // NULL
     num_arguments += 1;
 
@@ -4236,6 +5079,14 @@ static void native_compilation(translation_unit_t* translation_unit,
     int output_object_filename_index = ipos;
     native_compilation_args[ipos] = output_object_filename;
     ipos++;
+    if (codegen_into_stdin)
+    {
+        // The language cannot be known from the extension of the input
+        native_compilation_args[ipos] = uniquestr("-x");
+        ipos++;
+        native_compilation_args[ipos] = IS_CXX_LANGUAGE ? uniquestr("c++") : uniquestr("c");
+        ipos++;
+    }
     int prettyprinted_filename_index = ipos;
     native_compilation_args[ipos] = prettyprinted_filename;
     ipos++;
@@ -4246,10 +5097,21 @@ static void native_compilation(translation_unit_t* translation_unit,
                 prettyprinted_filename, output_object_filename);
     }
 
+    // Fortran modules are wrapped right after the native compilation and the
+    // binary check needs the object, so these are never run in the background
+    if (compilation_process.num_native_jobs > 0
+            && CURRENT_CONFIGURATION->source_language != SOURCE_LANGUAGE_FORTRAN
+            && !debug_options.binary_check)
+    {
+        start_native_compilation(translation_unit, prettyprinted_filename, native_compilation_args,
+                codegen_into_stdin);
+        return;
+    }
+
     timing_t timing_compilation;
     timing_start(&timing_compilation);
 
-    if (execute_program(CURRENT_CONFIGURATION->native_compiler_name, native_compilation_args) != 0)
+    if (wait_program(start_native_compiler(translation_unit, native_compilation_args, codegen_into_stdin)) != 0)
     {
         // Clean things up if they go wrong here before aborting
         if (CURRENT_CONFIGURATION->source_language == SOURCE_LANGUAGE_FORTRAN)
@@ -4327,6 +5189,9 @@ static void native_compilation(translation_unit_t* translation_unit,
 
 static void embed_files(void)
 {
+    // Objects being embedded may still be being compiled
+    wait_native_compilations();
+
     if (CURRENT_CONFIGURATION->do_not_compile)
         return;
 
@@ -4937,6 +5802,8 @@ static void extend_file_list_with_static_libraries(
 
 static void link_objects(void)
 {
+    wait_native_compilations();
+
     if (CURRENT_CONFIGURATION->do_not_link
             || debug_options.do_not_codegen)
         return;
@@ -5114,7 +5981,6 @@ static compilation_configuration_t* get_sublanguage_configuration(
     return fallback_config;
 }
 
-#ifdef HAVE_MALLINFO
 static char* power_suffixes[9] = 
 {
     "",
@@ -5155,7 +6021,6 @@ static void print_human(char *dest, unsigned long long num_bytes_)
         }
     }
 }
-#endif
 
 static void compute_tree_breakdown(AST a, int breakdown[MCXX_MAX_AST_CHILDREN + 1], int breakdown_real[MCXX_MAX_AST_CHILDREN + 1], int *num_nodes)
 {
@@ -5228,6 +6093,41 @@ static void print_memory_report(void)
     fprintf(stderr, "\n");
 #endif
 
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+    {
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) == 0)
+        {
+            char max_rss[256];
+            // ru_maxrss is in kilobytes
+            print_human(max_rss, (unsigned long long)usage.ru_maxrss * 1024);
+            fprintf(stderr, " - Maximum resident set size: %s\n", max_rss);
+        }
+    }
+#endif
+
+    // -- Subprocesses
+    int num_spawned_programs = 0;
+    double time_spawning_programs = 0.0;
+    execute_program_get_stats(&num_spawned_programs, &time_spawning_programs);
+    if (num_spawned_programs > 0)
+    {
+        fprintf(stderr, " - Subprocesses started: %d in %.3f seconds (%.3f ms each)\n",
+                num_spawned_programs, time_spawning_programs,
+                1000.0 * time_spawning_programs / num_spawned_programs);
+        fprintf(stderr, "\n");
+    }
+
+    // -- Compilation cache
+    if (compilation_process.cache_dir != NULL)
+    {
+        int num_cache_hits = 0, num_cache_misses = 0, num_cache_stores = 0;
+        compilation_cache_get_stats(&num_cache_hits, &num_cache_misses, &num_cache_stores);
+        fprintf(stderr, " - Compilation cache: %d hits, %d misses, %d stored\n",
+                num_cache_hits, num_cache_misses, num_cache_stores);
+        fprintf(stderr, "\n");
+    }
+
     fprintf(stderr, "Size of a symbol (bytes): %zd\n",
             sizeof(scope_entry_t));
     fprintf(stderr, "Size of entity specifiers (bytes): %zd\n",
@@ -5237,6 +6137,22 @@ static void print_memory_report(void)
     fprintf(stderr, "Size of a type (bytes): %zd\n",
             get_type_t_size());
 
+    // -- Hash-consed types
+    fprintf(stderr, "\n");
+    int type_kind;
+    for (type_kind = 0; type_kind < type_intern_get_num_kinds(); type_kind++)
+    {
+        const char* kind_name = NULL;
+        int num_lookups = 0, num_hits = 0;
+        type_intern_get_stats(type_kind, &kind_name, &num_lookups, &num_hits);
+
+        if (num_lookups == 0)
+            continue;
+
+        fprintf(stderr, " - Hash-consed %s: %d (%d lookups, %d hits)\n",
+                kind_name, num_lookups - num_hits, num_lookups, num_hits);
+    }
+
     // -- AST
     fprintf(stderr, "\n");
     fprintf(stderr, "Abstract Syntax Tree(s) breakdown\n");
@@ -5276,6 +6192,111 @@ static void print_memory_report(void)
         fprintf(stderr, " - Nodes with %d real children: %d\n", i, children_real_count[i]);
     }
 
+    // -- AST arenas
+    mem_arena_stats_t arena_stats;
+    memset(&arena_stats, 0, sizeof(arena_stats));
+    int num_arenas = 0;
+    for (i = 0; i < compilation_process.num_translation_units; i++)
+    {
+        translation_unit_t* translation_unit = compilation_process.translation_units[i]->translation_unit;
+
+        mem_arena_stats_t current_stats = translation_unit->ast_arena_stats;
+        if (translation_unit->ast_arena != NULL)
+            mem_arena_get_stats(translation_unit->ast_arena, &current_stats);
+
+        if (current_stats.num_chunks == 0)
+            continue;
+
+        num_arenas++;
+        arena_stats.num_allocations += current_stats.num_allocations;
+        arena_stats.bytes_requested += current_stats.bytes_requested;
+        arena_stats.bytes_reserved += current_stats.bytes_reserved;
+        arena_stats.num_chunks += current_stats.num_chunks;
+    }
+
+    if (num_arenas > 0)
+    {
+        char c[256];
+
+        fprintf(stderr, "\n");
+        fprintf(stderr, " - Number of AST arenas: %d\n", num_arenas);
+        fprintf(stderr, " - Allocations in AST arenas: %llu\n",
+                arena_stats.num_allocations);
+        print_human(c, arena_stats.bytes_requested);
+        fprintf(stderr, " - Total size of memory requested to AST arenas: %s\n", c);
+        print_human(c, arena_stats.bytes_reserved);
+        fprintf(stderr, " - Total size of memory reserved by AST arenas: %s (%llu chunks)\n",
+                c, arena_stats.num_chunks);
+    }
+
+    // -- Target builtins
+    int num_builtins_available = 0, num_builtins_signed_in = 0;
+    lazy_builtins_get_stats(&num_builtins_available, &num_builtins_signed_in);
+    if (num_builtins_available > 0)
+    {
+        fprintf(stderr, "\n");
+        fprintf(stderr, " - Target builtins signed in on demand: %d of %d\n",
+                num_builtins_signed_in, num_builtins_available);
+    }
+
+    // -- Pending function instantiations
+    int num_requested = 0, num_queued = 0, num_instantiated = 0, max_pending = 0;
+    double instantiation_seconds = 0.0;
+    instantiation_get_stats(&num_requested, &num_queued, &num_instantiated,
+            &max_pending, &instantiation_seconds);
+    if (num_requested > 0)
+    {
+        fprintf(stderr, "\n");
+        fprintf(stderr, " - Function instantiations requested: %d (%d queued, %d duplicated)\n",
+                num_requested, num_queued, num_requested - num_queued);
+        fprintf(stderr, " - Pending function instantiations done: %d in %.2f seconds (at most %d pending)\n",
+                num_instantiated, instantiation_seconds, max_pending);
+    }
+
+    // -- Class scope lookups
+    int num_class_lookup_hits = 0, num_class_lookup_misses = 0, num_class_lookup_invalidations = 0;
+    class_scope_lookup_get_stats(&num_class_lookup_hits, &num_class_lookup_misses,
+            &num_class_lookup_invalidations);
+    if (num_class_lookup_hits + num_class_lookup_misses > 0)
+    {
+        fprintf(stderr, "\n");
+        fprintf(stderr, " - Class scope lookups cached: %d hits, %d misses (%.2f%% hit rate)\n",
+                num_class_lookup_hits, num_class_lookup_misses,
+                (100.0 * num_class_lookup_hits) / (num_class_lookup_hits + num_class_lookup_misses));
+        fprintf(stderr, " - Class scope lookup cache invalidations: %d\n",
+                num_class_lookup_invalidations);
+    }
+
+    // -- Argument dependent lookup
+    int num_koenig_hits = 0, num_koenig_misses = 0;
+    koenig_get_stats(&num_koenig_hits, &num_koenig_misses);
+    if (num_koenig_hits + num_koenig_misses > 0)
+    {
+        fprintf(stderr, "\n");
+        fprintf(stderr, " - Associated namespaces of argument types: %d computed, %d reused\n",
+                num_koenig_misses, num_koenig_hits);
+    }
+
+    // -- Implicit special members
+    int num_lazy_classes = 0, num_declared_classes = 0;
+    build_scope_get_implicit_members_stats(&num_lazy_classes, &num_declared_classes);
+    if (num_lazy_classes > 0)
+    {
+        fprintf(stderr, "\n");
+        fprintf(stderr, " - Classes with implicit members declared lazily: %d (%d eventually declared)\n",
+                num_lazy_classes, num_declared_classes);
+    }
+
+    // -- Deferred inline function definitions
+    int num_deferred_functions = 0, num_built_functions = 0;
+    build_scope_get_deferred_function_stats(&num_deferred_functions, &num_built_functions);
+    if (num_deferred_functions > 0)
+    {
+        fprintf(stderr, "\n");
+        fprintf(stderr, " - Inline function definitions deferred: %d (%d eventually analyzed)\n",
+                num_deferred_functions, num_built_functions);
+    }
+
     fprintf(stderr, "\n");
 }
 
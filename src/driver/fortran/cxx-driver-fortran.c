@@ -669,6 +669,32 @@ void driver_fortran_retrieve_module(const char* module_name,
     unlock_modules(lock_fd, lock_filename);
 }
 
+void driver_fortran_locate_module(const char* module_name,
+        const char **filename,
+        char *is_wrap)
+{
+    DEBUG_CODE()
+    {
+        fprintf(stderr, "DRIVER-FORTRAN: Locating module '%s'\n", module_name);
+    }
+    *filename = NULL;
+    *is_wrap = 0;
+
+    *filename = get_path_of_mercurium_nonwrapped_module(module_name);
+    if (*filename != NULL)
+        return;
+
+    if (CURRENT_CONFIGURATION->do_not_wrap_fortran_modules)
+        return;
+
+    int lock_fd = 0;
+    const char* lock_filename = NULL;
+    lock_modules(&lock_fd, &lock_filename);
+    *filename = get_path_of_mercurium_wrap_module(module_name);
+    *is_wrap = (*filename != NULL);
+    unlock_modules(lock_fd, lock_filename);
+}
+
 void driver_fortran_register_module(const char* module_name, 
         const char **mf03_filename,
         char is_intrinsic)
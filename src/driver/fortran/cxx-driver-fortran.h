@@ -33,6 +33,11 @@
 // too the wrap file itself
 void driver_fortran_retrieve_module(const char* module_name, const char **mf03_filename, const char **wrap_filename);
 
+// This function returns the file that driver_fortran_retrieve_module would use
+// for module 'module_name' without unwrapping it. If the file is a wrap
+// module, is_wrap is set to nonzero
+void driver_fortran_locate_module(const char* module_name, const char **filename, char *is_wrap);
+
 // This function states to the driver that we are going to create the module 'module_name'
 // it returns the path where the mf03 specific module will be created
 // The driver will ensure that the native module is properly wrapped along with mf03_filename
@@ -26,27 +26,27 @@
 /*!if GRAMMAR_RULES*/
 unary_expression : UPC_LOCALSIZEOF unary_expression
 {
-    $$ = ASTMake1(AST_UPC_LOCALSIZEOF, $2, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake1(AST_UPC_LOCALSIZEOF, $2, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 | UPC_LOCALSIZEOF '(' type_id ')'
 {
-    $$ = ASTMake1(AST_UPC_LOCALSIZEOF_TYPEID, $3, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake1(AST_UPC_LOCALSIZEOF_TYPEID, $3, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 | UPC_BLOCKSIZEOF unary_expression
 {
-    $$ = ASTMake1(AST_UPC_BLOCKSIZEOF, $2, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake1(AST_UPC_BLOCKSIZEOF, $2, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 | UPC_BLOCKSIZEOF '(' type_id ')'
 {
-    $$ = ASTMake1(AST_UPC_BLOCKSIZEOF_TYPEID, $3, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake1(AST_UPC_BLOCKSIZEOF_TYPEID, $3, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 | UPC_ELEMSIZEOF unary_expression
 {
-    $$ = ASTMake1(AST_UPC_ELEMSIZEOF, $2, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake1(AST_UPC_ELEMSIZEOF, $2, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 | UPC_ELEMSIZEOF '(' type_id ')'
 {
-    $$ = ASTMake1(AST_UPC_ELEMSIZEOF_TYPEID, $3, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake1(AST_UPC_ELEMSIZEOF_TYPEID, $3, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 ;
 
@@ -62,21 +62,21 @@ cv_qualifier : upc_shared_type_qualifier
 
 upc_shared_type_qualifier : UPC_SHARED
 {
-    $$ = ASTMake1(AST_UPC_SHARED, NULL, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake1(AST_UPC_SHARED, NULL, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 | UPC_SHARED upc_layout_qualifier
 {
-    $$ = ASTMake1(AST_UPC_SHARED, $2, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake1(AST_UPC_SHARED, $2, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 ;
 
 upc_reference_type_qualifier : UPC_RELAXED
 {
-    $$ = ASTLeaf(AST_UPC_RELAXED, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTLeaf(AST_UPC_RELAXED, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 | UPC_STRICT
 {
-    $$ = ASTLeaf(AST_UPC_STRICT, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTLeaf(AST_UPC_STRICT, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 ;
 
@@ -93,17 +93,17 @@ upc_layout_qualifier: upc_layout_qualifier_element
 
 upc_layout_qualifier_element : '[' ']'
 {
-    $$ = ASTMake1(AST_UPC_LAYOUT_QUALIFIER, NULL, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake1(AST_UPC_LAYOUT_QUALIFIER, NULL, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 | '[' constant_expression ']'
 {
-    $$ = ASTMake1(AST_UPC_LAYOUT_QUALIFIER, $2, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake1(AST_UPC_LAYOUT_QUALIFIER, $2, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 | '[' '*' ']'
 {
     $$ = ASTMake1(AST_UPC_LAYOUT_QUALIFIER, 
-            ASTLeaf(AST_UPC_LAYOUT_UNDEF, make_locus(@2.first_filename, @2.first_line, @2.first_column), NULL), 
-            make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+            ASTLeaf(AST_UPC_LAYOUT_UNDEF, make_locus_file_id(@2.first_file_id, @2.first_line, @2.first_column), NULL), 
+            make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 ;
 
@@ -115,19 +115,19 @@ nondeclarating_statement : upc_synchronization_statement
 
 upc_synchronization_statement : UPC_NOTIFY upc_expression_opt ';'
 {
-    $$ = ASTMake1(AST_UPC_NOTIFY, $2, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake1(AST_UPC_NOTIFY, $2, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 | UPC_WAIT upc_expression_opt ';'
 {
-    $$ = ASTMake1(AST_UPC_WAIT, $2, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake1(AST_UPC_WAIT, $2, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 | UPC_BARRIER upc_expression_opt ';'
 {
-    $$ = ASTMake1(AST_UPC_BARRIER, $2, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake1(AST_UPC_BARRIER, $2, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 | UPC_FENCE ';'
 {
-    $$ = ASTLeaf(AST_UPC_FENCE, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTLeaf(AST_UPC_FENCE, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 ;
 
@@ -144,9 +144,9 @@ upc_expression_opt : expression
 iteration_statement : UPC_FORALL '(' for_init_statement upc_expression_opt ';' upc_expression_opt ';' upc_affinity_opt ')' statement
 {
     AST upc_forall_header =
-        ASTMake4(AST_UPC_FORALL_HEADER, $3, $4, $6, $8, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+        ASTMake4(AST_UPC_FORALL_HEADER, $3, $4, $6, $8, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 
-    $$ = ASTMake2(AST_UPC_FORALL, upc_forall_header, $10, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake2(AST_UPC_FORALL, upc_forall_header, $10, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 ;
 
@@ -165,7 +165,7 @@ upc_affinity : expression
 }
 | CONTINUE
 {
-    $$ = ASTLeaf(AST_UPC_CONTINUE, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTLeaf(AST_UPC_CONTINUE, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 ;
 
@@ -29,6 +29,7 @@
 #define CXX_AST_INLINE_H
 
 #include "mem.h"
+#include "mem_arena.h"
 #include "cxx-process.h"
 #include <stdint.h>
 
@@ -44,23 +45,32 @@ struct AST_tag
     // This is a bitmap for the sons
     unsigned int bitmap_sons:MCXX_MAX_AST_CHILDREN;
 
-    // Number of ambiguities of this node
-    int num_ambig;
+    // Storage of the node itself, its ambiguities and its expr_info. When
+    // set, the memory belongs to an arena and must not be freed (see
+    // ast_set_current_arena)
+    unsigned int node_in_arena:1;
+    unsigned int ambig_in_arena:1;
+    unsigned int expr_info_in_arena:1;
+
+    // Number of ambiguities of this node (see MCXX_MAX_AST_AMBIGUITIES)
+    unsigned int num_ambig:14;
+
+    // Node locus, see locus_from_id
+    locus_id_t locus_id;
 
     // Parent node
     struct AST_tag* parent;
 
-    // Node locus
-    const locus_t* locus;
-
     // Textual information linked to the node
     // normally the symbol or the literal
     const char* text;
 
     union
     {
-        // The children of this tree (except for AST_AMBIGUITY)
-        struct AST_tag** children;
+        // The children of this tree (except for AST_AMBIGUITY). They are
+        // stored inline, so a node never reallocates them and fits in a
+        // cache line in LP64
+        struct AST_tag* children[MCXX_MAX_AST_CHILDREN];
         // When type == AST_AMBIGUITY, all intepretations are here
         struct AST_tag** ambig;
     };
@@ -69,6 +79,70 @@ struct AST_tag
     struct nodecl_expr_info_tag* expr_info;
 } AST_node_t;
 
+// Arena where new nodes are allocated, NULL means the heap
+LIBMCXX_EXTERN mem_arena_t* _ast_current_arena;
+
+static inline AST ast_alloc_node(void)
+{
+    AST result;
+    if (_ast_current_arena != NULL)
+    {
+        result = (AST)mem_arena_alloc(_ast_current_arena, sizeof(AST_node_t));
+        result->node_in_arena = 1;
+    }
+    else
+    {
+        result = NEW(AST_node_t);
+        result->node_in_arena = 0;
+    }
+    result->ambig_in_arena = 0;
+    result->expr_info_in_arena = 0;
+    return result;
+}
+
+// Extra storage of a node is taken from the arena only if the node itself
+// lives in an arena. This way heap nodes never point to arena memory
+static inline char ast_use_arena_for(const_AST a)
+{
+    return a->node_in_arena && _ast_current_arena != NULL;
+}
+
+// Allocates a new vector of ambiguities for 'a'. It does not release the
+// previous one
+static inline struct AST_tag** ast_alloc_ambiguities(AST a, int n)
+{
+    if (ast_use_arena_for(a))
+    {
+        a->ambig_in_arena = 1;
+        return (struct AST_tag**)mem_arena_alloc(_ast_current_arena, n * sizeof(struct AST_tag*));
+    }
+    else
+    {
+        a->ambig_in_arena = 0;
+        return NEW_VEC(struct AST_tag*, n);
+    }
+}
+
+static inline void ast_free_ambiguities(struct AST_tag** ambig, char in_arena)
+{
+    if (!in_arena)
+        DELETE(ambig);
+}
+
+static inline void* ast_alloc_expr_info(AST a, size_t size)
+{
+    if (ast_use_arena_for(a))
+    {
+        a->expr_info_in_arena = 1;
+        return mem_arena_alloc(_ast_current_arena, size);
+    }
+    else
+    {
+        a->expr_info_in_arena = 0;
+        return xmalloc(size);
+    }
+}
+
 
 static inline node_t ast_get_kind(const_AST a)
 {
@@ -105,31 +179,6 @@ static inline void ast_set_kind(AST a, node_t node_type)
     a->node_type = node_type;
 }
 
-static inline int ast_bitmap_to_index(unsigned int bitmap, int num)
-{
-    ERROR_CONDITION(((1 << num) & bitmap) == 0,
-            "Invalid bitmap!", 0);
-#if HAVE__BUILTIN_POPCOUNT
-    bitmap = bitmap & (~(~0U << num));
-    return __builtin_popcount(bitmap);
-#else
-    int i;
-    int s = 0;
-    for (i = 0; i < num; i++)
-    {
-        s += bitmap & 1;
-        bitmap = bitmap >> 1;
-    }
-
-    return s;
-#endif
-}
-
-ALWAYS_INLINE static inline int ast_son_num_to_son_index(const_AST a, int num_son)
-{
-    return ast_bitmap_to_index(a->bitmap_sons, num_son);
-}
-
 ALWAYS_INLINE static inline char ast_has_son(const_AST a, int son)
 {
     return (((1 << son) & a->bitmap_sons) != 0);
@@ -137,9 +186,10 @@ ALWAYS_INLINE static inline char ast_has_son(const_AST a, int son)
 
 ALWAYS_INLINE static inline AST ast_get_child(const_AST a, int num_child)
 {
+    // Checking the bitmap is needed because of ambiguity nodes
     if (ast_has_son(a, num_child))
     {
-        return a->children[ast_son_num_to_son_index(a, num_child)];
+        return a->children[num_child];
     }
     else
     {
@@ -173,37 +223,27 @@ static inline AST ast_make(node_t type, int __num_children UNUSED_PARAMETER,
         AST child0, AST child1, AST child2, AST child3, 
         const locus_t* location, const char *text)
 {
-    AST result = NEW(AST_node_t);
+    AST result = ast_alloc_node();
     // ERROR_CONDITION(result & 0x1 != 0, "Invalid pointer for AST", 0);
 
     result->node_type = type;
 
-    int num_children = 0;
-    unsigned int bitmap_sons = 0;
-
-    result->bitmap_sons = bitmap_sons;
     result->parent = NULL;
-    result->locus = location;
+    result->locus_id = locus_get_id(location);
 
     result->text = text;
 
-    bitmap_sons =
+    result->bitmap_sons =
         (!!child0)
         | (!!child1 << 1)
         | (!!child2 << 2)
         | (!!child3 << 3);
-    num_children = ast_count_bitmap(bitmap_sons);
-
-    result->bitmap_sons = bitmap_sons;
-    result->children = NEW_VEC(AST, num_children);
 
-    int idx = 0;
 #define ADD_SON(n) \
+    result->children[n] = child##n; \
     if (child##n != NULL) \
     { \
-        result->children[idx] = child##n; \
         child##n->parent = result; \
-        idx++; \
     }
 
     ADD_SON(0);
@@ -217,16 +257,9 @@ static inline AST ast_make(node_t type, int __num_children UNUSED_PARAMETER,
     return result;
 }
 
-// This function works both for shrinking or widening
-static inline void ast_reallocate_children(AST a, int num_child, AST new_child)
+static inline void ast_set_child_but_parent(AST a, int num_child, AST new_child)
 {
-    // Reallocate childrens
-    // Save the old children array
-    AST* old_children = a->children;
-    // And the old children bitmap
-    unsigned int old_bitmap = a->bitmap_sons;
-
-    // Enable or disable this new son depending on it being null
+    a->children[num_child] = new_child;
     if (new_child != NULL)
     {
         a->bitmap_sons = (a->bitmap_sons | (1 << num_child));
@@ -235,58 +268,6 @@ static inline void ast_reallocate_children(AST a, int num_child, AST new_child)
     {
         a->bitmap_sons = (a->bitmap_sons & (~(1 << num_child)));
     }
-
-    a->children = NEW_VEC(AST, ast_count_bitmap(a->bitmap_sons));
-
-    // Now for every old son, update the new children
-    int i;
-    for (i = 0; i < MCXX_MAX_AST_CHILDREN; i++)
-    {
-        // Note that when shrinking the node ast_has_son
-        // will always return false for num_child.
-        if (ast_has_son(a, i))
-        {
-            if (i == num_child)
-            {
-                // The new son
-                a->children[ast_son_num_to_son_index(a, i)] = new_child;
-            }
-            else
-            {
-                // Old sons that are updated their position
-                a->children[ast_son_num_to_son_index(a, i)] = 
-                    old_children[ast_bitmap_to_index(old_bitmap, i)];
-            }
-        }
-    }
-
-    // Now DELETE the old children (if any)
-    if (old_children != NULL)
-        DELETE(old_children);
-}
-
-static inline void ast_set_child_but_parent(AST a, int num_child, AST new_child)
-{
-    if (new_child == NULL)
-    {
-        if (ast_has_son(a, num_child))
-        {
-            // Shrink the node if we have it
-            ast_reallocate_children(a, num_child, new_child);
-        }
-    }
-    else
-    {
-        if (ast_has_son(a, num_child))
-        {
-            a->children[ast_son_num_to_son_index(a, num_child)] = new_child;
-        }
-        else
-        {
-            // This will widen the node
-            ast_reallocate_children(a, num_child, new_child);
-        }
-    }
 }
 
 static inline void ast_set_child(AST a, int num_child, AST new_child)
@@ -401,6 +382,23 @@ int ast_num_of_given_child(const_AST parent, const_AST child)
     return -1;
 }
 
+static inline void ast_grow_ambiguities(AST a, int num_ambig)
+{
+    ERROR_CONDITION(num_ambig > MCXX_MAX_AST_AMBIGUITIES,
+            "Too many ambiguities (%d) in node", num_ambig);
+
+    AST* old_ambig = a->ambig;
+    char old_ambig_in_arena = a->ambig_in_arena;
+
+    a->ambig = ast_alloc_ambiguities(a, num_ambig);
+    if (old_ambig != NULL)
+    {
+        memcpy(a->ambig, old_ambig, a->num_ambig * sizeof(*old_ambig));
+        ast_free_ambiguities(old_ambig, old_ambig_in_arena);
+    }
+    a->num_ambig = num_ambig;
+}
+
 // Be careful when handling ambiguity nodes, the set of interpretations may not
 // be an actual tree but a DAG
 static inline AST ast_make_ambiguous(AST son0, AST son1)
@@ -411,8 +409,7 @@ static inline AST ast_make_ambiguous(AST son0, AST son1)
         {
             int original_son0 = son0->num_ambig;
 
-            son0->num_ambig += son1->num_ambig;
-            son0->ambig = NEW_REALLOC(AST, son0->ambig, son0->num_ambig);
+            ast_grow_ambiguities(son0, son0->num_ambig + son1->num_ambig);
 
             int i;
             for (i = 0; i < son1->num_ambig; i++)
@@ -424,8 +421,7 @@ static inline AST ast_make_ambiguous(AST son0, AST son1)
         }
         else
         {
-            son0->num_ambig++;
-            son0->ambig = NEW_REALLOC(AST, son0->ambig, son0->num_ambig);
+            ast_grow_ambiguities(son0, son0->num_ambig + 1);
             son0->ambig[son0->num_ambig-1] = son1;
 
             return son0;
@@ -433,8 +429,7 @@ static inline AST ast_make_ambiguous(AST son0, AST son1)
     }
     else if (ASTKind(son1) == AST_AMBIGUITY)
     {
-        son1->num_ambig++;
-        son1->ambig = NEW_REALLOC(AST, son1->ambig, son1->num_ambig);
+        ast_grow_ambiguities(son1, son1->num_ambig + 1);
         son1->ambig[son1->num_ambig-1] = son0;
 
         return son1;
@@ -444,10 +439,10 @@ static inline AST ast_make_ambiguous(AST son0, AST son1)
         AST result = ASTLeaf(AST_AMBIGUITY, make_locus("", 0, 0), NULL);
 
         result->num_ambig = 2;
-        result->ambig = NEW_VEC(AST, result->num_ambig);
+        result->ambig = ast_alloc_ambiguities(result, result->num_ambig);
         result->ambig[0] = son0;
         result->ambig[1] = son1;
-        result->locus = son0->locus;
+        result->locus_id = son0->locus_id;
 
         return result;
     }
@@ -455,7 +450,10 @@ static inline AST ast_make_ambiguous(AST son0, AST son1)
 
 static inline void ast_replace(AST dest, const_AST src)
 {
+    // The storage of dest does not change
+    char node_in_arena = dest->node_in_arena;
     *dest = *src;
+    dest->node_in_arena = node_in_arena;
 }
 
 static inline void ast_free(AST a)
@@ -479,6 +477,7 @@ static inline void ast_free(AST a)
         {
             ast_free(ast_get_ambiguity(a, i));
         }
+        ast_free_ambiguities(a->ambig, a->ambig_in_arena);
     }
     else
     {
@@ -489,11 +488,13 @@ static inline void ast_free(AST a)
         }
     }
 
-    DELETE(a->expr_info);
-    DELETE(a->children);
+    if (!a->expr_info_in_arena)
+        DELETE(a->expr_info);
     // Clear the node for safety
     // __builtin_memset(a, 0, sizeof(*a));
-    DELETE(a);
+    // Nodes in an arena are released along with it
+    if (!a->node_in_arena)
+        DELETE(a);
 }
 
 static inline void ast_replace_with_ambiguity(AST a, int n)
@@ -530,7 +531,7 @@ static inline const locus_t* ast_get_locus(const_AST a)
     if (a == NULL)
         return NULL;
     else if (ASTKind(a) != AST_NODE_LIST)
-        return a->locus;
+        return locus_from_id(a->locus_id);
     else
         return ast_get_locus(
                 ASTSon1(ast_list_head(a))
@@ -541,7 +542,7 @@ static inline void ast_set_locus(AST a, const locus_t* locus)
 {
     ERROR_CONDITION(ASTKind(a) == AST_NODE_LIST,
             "list nodes do not have locus", 0);
-    a->locus = locus;
+    a->locus_id = locus_get_id(locus);
 }
 
 static inline const char *ast_get_filename(const_AST a)
@@ -46,6 +46,18 @@
 
 #include "cxx-nodecl-decls.h"
 
+mem_arena_t* _ast_current_arena = NULL;
+
+void ast_set_current_arena(mem_arena_t* arena)
+{
+    _ast_current_arena = arena;
+}
+
+mem_arena_t* ast_get_current_arena(void)
+{
+    return _ast_current_arena;
+}
+
 /**
   Checks that nodes are really doubly-linked.
 
@@ -216,9 +228,12 @@ char ast_check_list_tree(const_AST a)
 
 static void ast_copy_one_node(AST dest, AST orig)
 {
+    char node_in_arena = dest->node_in_arena;
     *dest = *orig;
+    dest->node_in_arena = node_in_arena;
     dest->bitmap_sons = 0;
-    dest->children = 0;
+    memset(dest->children, 0, sizeof(dest->children));
+    dest->ambig_in_arena = 0;
 }
 
 AST ast_duplicate_one_node(AST orig)
@@ -234,7 +249,7 @@ AST ast_copy(const_AST a)
     if (a == NULL)
         return NULL;
 
-    AST result = NEW0(AST_node_t);
+    AST result = ast_alloc_node();
 
     ast_copy_one_node(result, (AST)a);
 
@@ -243,7 +258,7 @@ AST ast_copy(const_AST a)
             && a->num_ambig > 0)
     {
         result->num_ambig = a->num_ambig;
-        result->ambig = NEW_VEC(AST, a->num_ambig);
+        result->ambig = ast_alloc_ambiguities(result, a->num_ambig);
         for (i = 0; i < a->num_ambig; i++)
         {
             result->ambig[i] = ast_copy(a->ambig[i]);
@@ -251,11 +266,6 @@ AST ast_copy(const_AST a)
     }
     else
     {
-        result->bitmap_sons = a->bitmap_sons;
-        int num_children = ast_count_bitmap(result->bitmap_sons);
-
-        result->children = NEW_VEC(AST, num_children);
-
         for (i = 0; i < MCXX_MAX_AST_CHILDREN; i++)
         {
             AST c = ast_copy(ast_get_child(a, i));
@@ -42,6 +42,7 @@
 #include "cxx-asttype.h"
 #include "cxx-type-decls.h"
 #include "cxx-limits.h"
+#include "mem_arena.h"
 
 
 MCXX_BEGIN_DECLS
@@ -133,6 +134,13 @@ LIBMCXX_EXTERN char ast_check_list_tree(const_AST a);
 
 static inline void ast_free(AST a);
 
+// Nodes created from now on (and their children vectors and expression
+// information) are allocated in the given arena. A NULL arena means the heap.
+// Nodes in an arena are not released by ast_free but when the arena is
+// destroyed
+LIBMCXX_EXTERN void ast_set_current_arena(mem_arena_t* arena);
+LIBMCXX_EXTERN mem_arena_t* ast_get_current_arena(void);
+
 // Gives a copy of all the tree but extended data is the same as original trees
 LIBMCXX_EXTERN AST ast_copy(const_AST a);
 
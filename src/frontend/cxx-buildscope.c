@@ -63,6 +63,7 @@
 #include "cxx-codegen.h"
 #include "cxx-placeholders.h"
 #include "cxx-driver-utils.h"
+#include "dhash_ptr.h"
 
 #ifdef EXTRAE_ENABLED
 #include "extrae_user_events.h"
@@ -543,6 +544,10 @@ void extrae_declaration_locus_walk(const char* key,
 }
 #endif
 
+static void deferred_function_defs_init(void);
+static void deferred_function_defs_finish(void);
+static void define_referenced_deferred_functions(nodecl_t* nodecl_output);
+
 static void build_scope_translation_unit_pre(translation_unit_t* translation_unit UNUSED_PARAMETER)
 {
     C_LANGUAGE()
@@ -552,7 +557,10 @@ static void build_scope_translation_unit_pre(translation_unit_t* translation_uni
     CXX_LANGUAGE()
     {
         instantiation_init();
+        overload_init();
+        koenig_init();
     }
+    deferred_function_defs_init();
 #ifdef EXTRAE_ENABLED
     extrae_declaration_locus_value_set = dhash_ptr_new(5);
 #endif // EXTRAE_ENABLED
@@ -563,13 +571,17 @@ static void build_scope_translation_unit_post(
         translation_unit_t* translation_unit UNUSED_PARAMETER,
         nodecl_t* nodecl_output)
 {
+    define_referenced_deferred_functions(nodecl_output);
     CXX_LANGUAGE()
     {
         if (CURRENT_CONFIGURATION->explicit_instantiation)
         {
             instantiation_instantiate_pending_functions(nodecl_output);
+            // Instantiated functions may reference more deferred definitions
+            define_referenced_deferred_functions(nodecl_output);
         }
     }
+    deferred_function_defs_finish();
     C_LANGUAGE()
     {
         linkage_pop();
@@ -7751,6 +7763,16 @@ static void declare_inherited_constructors(
     entry_list_free(current_class_constructors);
 }
 
+// Statistics of --lazy-implicit-members, see build_scope_get_implicit_members_stats
+static int num_classes_with_lazy_implicit_members = 0;
+static int num_classes_with_implicit_members_declared = 0;
+
+void build_scope_get_implicit_members_stats(int* num_lazy_classes, int* num_declared_classes)
+{
+    *num_lazy_classes = num_classes_with_lazy_implicit_members;
+    *num_declared_classes = num_classes_with_implicit_members_declared;
+}
+
 // See gather_type_spec_from_class_specifier to know what are class_type and type_info
 // This function is only for C++
 //
@@ -8014,6 +8036,49 @@ static void finish_class_type_cxx(type_t* class_type,
         entry_list_free(member_functions);
     }
 
+    entry_list_free(all_bases);
+    entry_list_free(nonstatic_data_members);
+    entry_list_free(direct_base_classes);
+    entry_list_free(virtual_base_classes);
+
+    if (CURRENT_CONFIGURATION->lazy_implicit_members)
+    {
+        // They will be declared when the class is queried for its special
+        // members, see class_type_declare_pending_implicit_members
+        class_type_set_pending_implicit_members(class_type, type_info, decl_context, locus);
+        num_classes_with_lazy_implicit_members++;
+    }
+    else
+    {
+        build_scope_declare_implicit_members(class_type, type_info, decl_context, locus);
+    }
+
+    DEBUG_CODE()
+    {
+        fprintf(stderr, "BUILDSCOPE: Ended class finalization\n");
+    }
+}
+
+// Declares the implicit special members and the inherited constructors of a
+// class that has been finished by finish_class_type_cxx
+void build_scope_declare_implicit_members(type_t* class_type,
+        type_t* type_info,
+        const decl_context_t* decl_context,
+        const locus_t* locus)
+{
+    DEBUG_CODE()
+    {
+        fprintf(stderr, "BUILDSCOPE: Declaring implicit members of class\n");
+    }
+
+    if (CURRENT_CONFIGURATION->lazy_implicit_members)
+        num_classes_with_implicit_members_declared++;
+
+    scope_entry_list_t* virtual_base_classes = class_type_get_virtual_base_classes(class_type);
+    scope_entry_list_t* direct_base_classes = class_type_get_direct_base_classes(class_type);
+    scope_entry_list_t* nonstatic_data_members = class_type_get_nonstatic_data_members(class_type);
+    scope_entry_list_t* all_bases = entry_list_merge(direct_base_classes, virtual_base_classes);
+
     scope_entry_list_t* virtual_functions = class_type_get_virtual_functions(class_type);
     char has_virtual_functions = virtual_functions != NULL;
     char has_virtual_bases = virtual_base_classes != NULL;
@@ -9152,11 +9217,6 @@ static void finish_class_type_cxx(type_t* class_type,
     entry_list_free(user_declared_copy_assignment_operators);
 
     declare_inherited_constructors(class_type, type_info, decl_context, locus);
-
-    DEBUG_CODE()
-    {
-        fprintf(stderr, "BUILDSCOPE: Ended class finalization\n");
-    }
 }
 
 void finish_class_type(type_t* class_type, type_t* type_info, const decl_context_t* decl_context,
@@ -9376,6 +9436,310 @@ static void build_scope_function_definition_body(
         gather_decl_spec_t* gather_info,
         nodecl_t *nodecl_output);
 
+// Deferred inline function definitions (--lazy-inline-bodies)
+//
+// Bodies of inline functions coming from included files are not analyzed
+// when they are found but only once the translation unit references them
+typedef
+struct deferred_function_def_tag
+{
+    AST function_definition;
+    scope_entry_t* entry;
+    const decl_context_t* decl_context;
+    const decl_context_t* block_context;
+    gather_decl_spec_t* gather_info;
+} deferred_function_def_t;
+
+static dhash_ptr_t* _deferred_function_defs = NULL;
+static int _num_deferred_function_defs = 0;
+// Once the translation unit has been analyzed deferred definitions are
+// directly added to its tree
+static char _deferred_function_defs_tu_finished = 0;
+
+// Statistics of the whole process, see build_scope_get_deferred_function_stats
+static int num_function_defs_deferred = 0;
+static int num_function_defs_deferred_built = 0;
+
+void build_scope_get_deferred_function_stats(int* num_deferred, int* num_built)
+{
+    *num_deferred = num_function_defs_deferred;
+    *num_built = num_function_defs_deferred_built;
+}
+
+static void release_deferred_function_definition(deferred_function_def_t* deferred)
+{
+    // It was detached from the parse tree of the translation unit
+    ast_free(deferred->function_definition);
+    DELETE(deferred->gather_info);
+    DELETE(deferred);
+}
+
+static void deferred_function_defs_init(void)
+{
+    // Definitions not referenced by the previous translation unit are
+    // normally released by the driver before its tree
+    build_scope_release_deferred_functions();
+    _deferred_function_defs_tu_finished = 0;
+}
+
+static void deferred_function_defs_finish(void)
+{
+    _deferred_function_defs_tu_finished = 1;
+}
+
+static char function_definition_can_be_deferred(scope_entry_t* entry,
+        const decl_context_t* decl_context,
+        gather_decl_spec_t* gather_info)
+{
+    if (!IS_CXX_LANGUAGE
+            || !CURRENT_CONFIGURATION->lazy_inline_bodies
+            || CURRENT_CONFIGURATION->enable_cuda)
+        return 0;
+
+    if (!symbol_entity_specs_get_is_inline(entry)
+            // Their body is required to evaluate them
+            || symbol_entity_specs_get_is_constexpr(entry)
+            // These are odr-used by the virtual table
+            || symbol_entity_specs_get_is_virtual(entry)
+            // Calls to destructors are implicit and are not in the tree
+            || symbol_entity_specs_get_is_destructor(entry)
+            || gather_info->is_template
+            || is_dependent_function(entry)
+            || is_template_specialized_type(entry->type_information)
+            || decl_context->current_scope->kind == BLOCK_SCOPE)
+        return 0;
+
+    type_t* return_type = function_type_get_return_type(entry->type_information);
+    if (return_type != NULL
+            && (type_is_derived_from_auto(return_type)
+                || is_decltype_auto_type(return_type)))
+        return 0;
+
+    // Only functions of included files
+    return locus_get_file_id(entry->locus)
+        != locus_file_id(CURRENT_COMPILED_FILE->input_filename);
+}
+
+static void defer_function_definition(AST function_definition,
+        scope_entry_t* entry,
+        const decl_context_t* decl_context,
+        const decl_context_t* block_context,
+        gather_decl_spec_t* gather_info)
+{
+    DEBUG_CODE()
+    {
+        fprintf(stderr, "BUILDSCOPE: Deferring definition of inline function '%s' at '%s'\n",
+                get_qualified_symbol_name(entry, entry->decl_context),
+                ast_location(function_definition));
+    }
+
+    if (_deferred_function_defs == NULL)
+        _deferred_function_defs = dhash_ptr_new(5);
+
+    // Detach the tree so it is not released along with the parse tree of
+    // the translation unit
+    AST parent = ASTParent(function_definition);
+    if (parent != NULL)
+    {
+        ast_set_child(parent, ast_num_of_given_child(parent, function_definition), NULL);
+        ast_set_parent(function_definition, NULL);
+    }
+
+    deferred_function_def_t* deferred = NEW(deferred_function_def_t);
+    deferred->function_definition = function_definition;
+    deferred->entry = entry;
+    deferred->decl_context = decl_context;
+    deferred->block_context = block_context;
+    deferred->gather_info = gather_info;
+
+    dhash_ptr_insert(_deferred_function_defs, (const char*)entry, deferred);
+    _num_deferred_function_defs++;
+    num_function_defs_deferred++;
+}
+
+static nodecl_t define_deferred_function(scope_entry_t* entry)
+{
+    if (_deferred_function_defs == NULL)
+        return nodecl_null();
+
+    deferred_function_def_t* deferred = (deferred_function_def_t*)dhash_ptr_query(
+            _deferred_function_defs, (const char*)entry);
+    if (deferred == NULL)
+        return nodecl_null();
+
+    dhash_ptr_remove(_deferred_function_defs, (const char*)entry);
+    _num_deferred_function_defs--;
+    num_function_defs_deferred_built++;
+
+    DEBUG_CODE()
+    {
+        fprintf(stderr, "=== Deferred function definition at '%s' ===\n",
+                ast_location(deferred->function_definition));
+    }
+
+    nodecl_t nodecl_function_definition = nodecl_null();
+    build_scope_function_definition_body(
+            deferred->function_definition,
+            deferred->entry,
+            deferred->decl_context,
+            deferred->block_context,
+            deferred->gather_info,
+            &nodecl_function_definition);
+
+    release_deferred_function_definition(deferred);
+
+    return nodecl_function_definition;
+}
+
+static void define_referenced_deferred_functions_rec(nodecl_t n,
+        dhash_ptr_t* visited,
+        nodecl_t* nodecl_output);
+
+static void define_referenced_deferred_functions_of_symbol(scope_entry_t* entry,
+        dhash_ptr_t* visited,
+        nodecl_t* nodecl_output)
+{
+    if (dhash_ptr_query(visited, (const char*)entry) != NULL)
+        return;
+    dhash_ptr_insert(visited, (const char*)entry, entry);
+
+    if (entry->kind == SK_FUNCTION)
+    {
+        nodecl_t nodecl_function_definition = define_deferred_function(entry);
+        if (!nodecl_is_null(nodecl_function_definition))
+        {
+            *nodecl_output = nodecl_concat_lists(*nodecl_output, nodecl_function_definition);
+            define_referenced_deferred_functions_rec(nodecl_function_definition, visited, nodecl_output);
+        }
+        else if (symbol_entity_specs_get_is_defaulted(entry))
+        {
+            // Implicitly defined functions are not in the tree
+            define_referenced_deferred_functions_rec(symbol_entity_specs_get_function_code(entry),
+                    visited, nodecl_output);
+        }
+    }
+    else if (entry->kind == SK_VARIABLE)
+    {
+        // Initializers are not in the tree either
+        define_referenced_deferred_functions_rec(entry->value, visited, nodecl_output);
+    }
+}
+
+static void define_referenced_deferred_functions_rec(nodecl_t n,
+        dhash_ptr_t* visited,
+        nodecl_t* nodecl_output)
+{
+    if (nodecl_is_null(n))
+        return;
+
+    if (nodecl_is_list(n))
+    {
+        int num_items = 0;
+        nodecl_t* list = nodecl_unpack_list(n, &num_items);
+        int i;
+        for (i = 0; i < num_items; i++)
+            define_referenced_deferred_functions_rec(list[i], visited, nodecl_output);
+        DELETE(list);
+        return;
+    }
+
+    // An object declaration references the functions called by its
+    // initializer, like the constructor. Its destructor is not deferred
+    if (nodecl_get_kind(n) == NODECL_SYMBOL
+            || nodecl_get_kind(n) == NODECL_OBJECT_INIT)
+        define_referenced_deferred_functions_of_symbol(nodecl_get_symbol(n), visited, nodecl_output);
+
+    int i;
+    for (i = 0; i < MCXX_MAX_AST_CHILDREN; i++)
+        define_referenced_deferred_functions_rec(nodecl_get_child(n, i), visited, nodecl_output);
+}
+
+// Analyzes the deferred definitions referenced in the translation unit and
+// adds them at its end
+static void define_referenced_deferred_functions(nodecl_t* nodecl_output)
+{
+    if (_num_deferred_function_defs == 0)
+        return;
+
+    timing_t timing_deferred;
+    timing_start(&timing_deferred);
+
+    int num_built = num_function_defs_deferred_built;
+    int num_pending = _num_deferred_function_defs;
+
+    dhash_ptr_t* visited = dhash_ptr_new(5);
+    nodecl_t nodecl_deferred = nodecl_null();
+    define_referenced_deferred_functions_rec(*nodecl_output, visited, &nodecl_deferred);
+    dhash_ptr_destroy(visited);
+
+    *nodecl_output = nodecl_concat_lists(*nodecl_output, nodecl_deferred);
+
+    timing_end(&timing_deferred);
+
+    if (CURRENT_CONFIGURATION->verbose)
+    {
+        fprintf(stderr, "%d out of %d deferred function definitions analyzed in %.2f seconds\n",
+                num_function_defs_deferred_built - num_built,
+                num_pending,
+                timing_elapsed(&timing_deferred));
+    }
+}
+
+nodecl_t build_scope_define_deferred_function(scope_entry_t* entry)
+{
+    nodecl_t nodecl_function_definition = define_deferred_function(entry);
+    if (nodecl_is_null(nodecl_function_definition))
+        return nodecl_null();
+
+    if (_deferred_function_defs_tu_finished)
+    {
+        // Referenced after the analysis (e.g. by a compiler phase). The new
+        // body may reference more deferred definitions
+        dhash_ptr_t* visited = dhash_ptr_new(5);
+        dhash_ptr_insert(visited, (const char*)entry, entry);
+        nodecl_t nodecl_deferred = nodecl_null();
+        define_referenced_deferred_functions_rec(nodecl_function_definition, visited, &nodecl_deferred);
+        dhash_ptr_destroy(visited);
+
+        nodecl_t nodecl_top_level = CURRENT_COMPILED_FILE->nodecl;
+        nodecl_set_child(nodecl_top_level, 0,
+                nodecl_concat_lists(nodecl_get_child(nodecl_top_level, 0),
+                    nodecl_concat_lists(nodecl_function_definition, nodecl_deferred)));
+    }
+
+    return nodecl_function_definition;
+}
+
+void build_scope_define_referenced_deferred_functions(translation_unit_t* translation_unit)
+{
+    nodecl_t nodecl_top_level = translation_unit->nodecl;
+    if (nodecl_is_null(nodecl_top_level))
+        return;
+
+    nodecl_t nodecl_list = nodecl_get_child(nodecl_top_level, 0);
+    define_referenced_deferred_functions(&nodecl_list);
+    nodecl_set_child(nodecl_top_level, 0, nodecl_list);
+}
+
+static void release_deferred_function_definition_walk(const char* key UNUSED_PARAMETER,
+        void* info,
+        void* walk_info UNUSED_PARAMETER)
+{
+    release_deferred_function_definition((deferred_function_def_t*)info);
+}
+
+void build_scope_release_deferred_functions(void)
+{
+    if (_deferred_function_defs == NULL)
+        return;
+
+    dhash_ptr_walk(_deferred_function_defs, release_deferred_function_definition_walk, NULL);
+    dhash_ptr_destroy(_deferred_function_defs);
+
+    _deferred_function_defs = NULL;
+    _num_deferred_function_defs = 0;
+}
+
 static void build_scope_delayed_function_def(nodecl_t* nodecl_output)
 {
     int i;
@@ -9395,6 +9759,12 @@ static void build_scope_delayed_function_def(nodecl_t* nodecl_output)
                     ast_location(function_definition));
         }
 
+        if (function_definition_can_be_deferred(entry, decl_context, gather_info))
+        {
+            defer_function_definition(function_definition, entry, decl_context, block_context, gather_info);
+            continue;
+        }
+
         nodecl_t nodecl_function_definition = nodecl_null();
 
         build_scope_function_definition_body(
@@ -17407,13 +17777,22 @@ static scope_entry_t* build_scope_function_definition(
     if (entry == NULL)
         return NULL;
 
-    build_scope_function_definition_body(
-            function_definition,
-            entry,
-            decl_context,
-            block_context,
-            &gather_info,
-            nodecl_output);
+    if (function_definition_can_be_deferred(entry, decl_context, &gather_info))
+    {
+        gather_decl_spec_t* deferred_gather_info = NEW(gather_decl_spec_t);
+        *deferred_gather_info = gather_info;
+        defer_function_definition(function_definition, entry, decl_context, block_context, deferred_gather_info);
+    }
+    else
+    {
+        build_scope_function_definition_body(
+                function_definition,
+                entry,
+                decl_context,
+                block_context,
+                &gather_info,
+                nodecl_output);
+    }
 
     // This field may have been set during instantiation
     symbol_entity_specs_set_is_defined_inside_class_specifier(entry, 0);
@@ -109,6 +109,22 @@ LIBMCXX_EXTERN void hide_using_declarations(type_t* class_info, scope_entry_t* c
 
 LIBMCXX_EXTERN void finish_class_type(struct type_tag* class_type, struct type_tag* type_info, const decl_context_t* decl_context,
         const locus_t* locus, nodecl_t* nodecl_output);
+LIBMCXX_EXTERN void build_scope_declare_implicit_members(struct type_tag* class_type, struct type_tag* type_info,
+        const decl_context_t* decl_context, const locus_t* locus);
+LIBMCXX_EXTERN void build_scope_get_implicit_members_stats(int* num_lazy_classes, int* num_declared_classes);
+
+// Analyzes the body of an inline function deferred by --lazy-inline-bodies.
+// Returns a null nodecl if the function was not deferred or it has already
+// been analyzed. Once the translation unit has been analyzed the definition,
+// and those it references, are added at the end of its tree
+LIBMCXX_EXTERN nodecl_t build_scope_define_deferred_function(scope_entry_t* entry);
+// Analyzes the deferred definitions referenced by the tree of the translation
+// unit, which the compiler phases may have changed
+LIBMCXX_EXTERN void build_scope_define_referenced_deferred_functions(translation_unit_t* translation_unit);
+// Releases the deferred definitions never referenced. Must be called before
+// the trees of the translation unit are released
+LIBMCXX_EXTERN void build_scope_release_deferred_functions(void);
+LIBMCXX_EXTERN void build_scope_get_deferred_function_stats(int* num_deferred, int* num_built);
 
 LIBMCXX_EXTERN scope_entry_t* finish_anonymous_class(scope_entry_t* class_symbol, const decl_context_t* decl_context);
 
@@ -1739,10 +1739,25 @@ nodecl_t const_value_to_nodecl_with_basic_type(const_value_t* v,
     return const_value_to_nodecl_(v, basic_type, /* cached */ 0);
 }
 
+// Cached trees are shared by all translation units so they cannot be
+// allocated in the arena of the current one
+static nodecl_t const_value_to_nodecl_cached_(const_value_t* v,
+        type_t* basic_type)
+{
+    mem_arena_t* current_arena = ast_get_current_arena();
+    ast_set_current_arena(NULL);
+
+    nodecl_t result = const_value_to_nodecl_(v, basic_type, /* cached */ 1);
+
+    ast_set_current_arena(current_arena);
+
+    return result;
+}
+
 nodecl_t const_value_to_nodecl_with_basic_type_cached(const_value_t* v, 
         type_t* basic_type)
 {
-    return const_value_to_nodecl_(v, basic_type, /* cached */ 1);
+    return const_value_to_nodecl_cached_(v, basic_type);
 }
 
 nodecl_t const_value_to_nodecl(const_value_t* v)
@@ -1752,7 +1767,7 @@ nodecl_t const_value_to_nodecl(const_value_t* v)
 
 nodecl_t const_value_to_nodecl_cached(const_value_t* v)
 {
-    return const_value_to_nodecl_(v, /* basic_type */ NULL, /* cached */ 1);
+    return const_value_to_nodecl_cached_(v, /* basic_type */ NULL);
 }
 
 char const_value_is_integer(const_value_t* v)
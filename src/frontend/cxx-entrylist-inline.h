@@ -0,0 +1,75 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2014 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+#ifndef CXX_ENTRYLIST_INLINE_H
+#define CXX_ENTRYLIST_INLINE_H
+
+#include "cxx-entrylist.h"
+
+enum { ENTRY_LIST_NUM_IMMEDIATE = 4 };
+
+// A small vector of entries. Up to ENTRY_LIST_NUM_IMMEDIATE entries are
+// stored in the list itself, items points to immediate in this case
+struct scope_entry_list_tag
+{
+    int num_items;
+    int capacity;
+    scope_entry_t** items;
+    scope_entry_t* immediate[ENTRY_LIST_NUM_IMMEDIATE];
+};
+
+// Like scope_entry_list_iterator_t but it lives in the stack and need not be
+// freed. It is fine to add elements to the list while iterating
+struct scope_entry_list_stack_iterator_tag
+{
+    const scope_entry_list_t* list;
+    int pos;
+};
+
+static inline scope_entry_list_stack_iterator_t entry_list_stack_iterator_begin(const scope_entry_list_t* list)
+{
+    scope_entry_list_stack_iterator_t result = { list, 0 };
+    return result;
+}
+
+static inline char entry_list_stack_iterator_end(const scope_entry_list_stack_iterator_t* it)
+{
+    return it->list == NULL
+        || it->pos >= it->list->num_items;
+}
+
+static inline void entry_list_stack_iterator_next(scope_entry_list_stack_iterator_t* it)
+{
+    it->pos++;
+}
+
+static inline scope_entry_t* entry_list_stack_iterator_current(const scope_entry_list_stack_iterator_t* it)
+{
+    return it->list->items[it->pos];
+}
+
+#endif // CXX_ENTRYLIST_INLINE_H
@@ -31,282 +31,141 @@
 #include <string.h>
 #include <stdint.h>
 
-#define NUM_IMMEDIATE 4
-
 unsigned long long _bytes_entry_lists;
 
-struct scope_entry_list_node_tag
-{
-    scope_entry_t* list[NUM_IMMEDIATE];
-    scope_entry_list_node_t* next;
-};
-
-struct scope_entry_list_tag
-{
-    int num_items_list;
-    scope_entry_list_node_t* next;
-};
-
-static scope_entry_list_node_t* entry_list_node_allocate(void)
-{
-    return NEW0(scope_entry_list_node_t);
-}
+// Lists are created and freed very often (e.g. in every lookup) so freed
+// lists are kept here to be reused. The items field links them
+static scope_entry_list_t* free_lists = NULL;
 
 static scope_entry_list_t* entry_list_allocate(void)
 {
-    scope_entry_list_t* new_entry_list = NEW0(scope_entry_list_t);
-
-    new_entry_list->next = entry_list_node_allocate();
-
-    return new_entry_list;
-}
-
-scope_entry_list_t* entry_list_new(scope_entry_t* entry)
-{
-    scope_entry_list_t* result = entry_list_allocate();
-    result->num_items_list = 1;
-    result->next->list[0] = entry;
-
-    return result;
-}
-
-static void entry_list_add_to_pos_rec(scope_entry_list_node_t* list,
-        scope_entry_t* entry, int num_pos)
-{
-    if (num_pos < NUM_IMMEDIATE)
+    scope_entry_list_t* result;
+    if (free_lists != NULL)
     {
-        list->list[num_pos] = entry;
+        result = free_lists;
+        free_lists = (scope_entry_list_t*)result->items;
     }
     else
     {
-        if (list->next != NULL)
-        {
-            entry_list_add_to_pos_rec(list->next, entry, num_pos - NUM_IMMEDIATE);
-        }
-        else
-        {
-            // We need to create a new entry_list_node
-            scope_entry_list_node_t* new_node = entry_list_node_allocate();
-            list->next = new_node;
-            entry_list_add_to_pos_rec(list->next, entry, num_pos - NUM_IMMEDIATE);
-        }
+        result = NEW(scope_entry_list_t);
     }
-}
 
-static scope_entry_list_node_t* entry_list_prepend_rec(scope_entry_list_node_t* list,
-        scope_entry_t* entry,
-        int num_items)
-{
-    if (list == NULL)
-    {
-        scope_entry_list_node_t* new_entry_list = entry_list_node_allocate();
-        new_entry_list->list[0] = entry;
-        return new_entry_list;
-    }
-    else
-    {
-        scope_entry_t* last = list->list[NUM_IMMEDIATE - 1];
-        int i;
-        // -2 because we do not want to write past the last element
-        for (i = NUM_IMMEDIATE - 2; i >= 0; i--)
-        {
-            list->list[i+1] = list->list[i];
-        }
-        list->list[0] = entry;
+    result->num_items = 0;
+    result->capacity = ENTRY_LIST_NUM_IMMEDIATE;
+    result->items = result->immediate;
+    memset(result->immediate, 0, sizeof(result->immediate));
 
-        if (num_items >= NUM_IMMEDIATE)
-        {
-            list->next = entry_list_prepend_rec(list->next, last, num_items - NUM_IMMEDIATE);
-        }
-        return list;
-    }
+    return result;
 }
 
-scope_entry_list_t* entry_list_prepend(scope_entry_list_t* list,
-        scope_entry_t* entry)
+static void entry_list_reserve(scope_entry_list_t* list, int num_items)
 {
-    scope_entry_list_t* result = NULL;
-    if (list == NULL)
+    if (num_items <= list->capacity)
+        return;
+
+    int new_capacity = 2 * list->capacity;
+    if (new_capacity < num_items)
+        new_capacity = num_items;
+
+    if (list->items == list->immediate)
     {
-        result = entry_list_allocate();
-        result->next->list[0] = entry;
-        result->num_items_list = 1;
-        return result;
+        list->items = NEW_VEC(scope_entry_t*, new_capacity);
+        memcpy(list->items, list->immediate, list->num_items * sizeof(*list->items));
     }
     else
     {
-        list->next = entry_list_prepend_rec(list->next, entry, list->num_items_list);
-        list->num_items_list++;
-        return list;
+        list->items = NEW_REALLOC(scope_entry_t*, list->items, new_capacity);
     }
+    list->capacity = new_capacity;
 }
 
-scope_entry_list_t* entry_list_add(scope_entry_list_t* list,
-        scope_entry_t* entry)
+// Makes room for one entry at position pos
+static void entry_list_insert_at(scope_entry_list_t* list, int pos, scope_entry_t* entry)
 {
-    if (list == NULL)
-    {
-        return entry_list_new(entry);
-    }
-    else
-    {
-        entry_list_add_to_pos_rec(list->next, entry, list->num_items_list);
-        list->num_items_list++;
+    entry_list_reserve(list, list->num_items + 1);
 
-        return list;
-    }
+    memmove(&list->items[pos + 1], &list->items[pos],
+            (list->num_items - pos) * sizeof(*list->items));
+    list->items[pos] = entry;
+    list->num_items++;
 }
 
-scope_entry_list_t* entry_list_add_once(scope_entry_list_t* list,
-        scope_entry_t* entry)
+static int entry_list_find(const scope_entry_list_t* list, scope_entry_t* entry)
 {
-    scope_entry_list_iterator_t* it = NULL;
-    for (it = entry_list_iterator_begin(list);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
+    int i;
+    for (i = 0; i < list->num_items; i++)
     {
-        scope_entry_t* current = entry_list_iterator_current(it);
-
-        if (current == entry)
-        {
-            entry_list_iterator_free(it);
-            return list;
-        }
+        if (list->items[i] == entry)
+            return i;
     }
-    entry_list_iterator_free(it);
-
-    return entry_list_add(list, entry);
+    return -1;
 }
 
-static void insert_and_shift_right(scope_entry_list_node_t* entry_list, int pos,
-        scope_entry_t* new_entry)
+scope_entry_list_t* entry_list_new(scope_entry_t* entry)
 {
-    if (entry_list == NULL)
-        return;
-
-    scope_entry_t* keep = entry_list->list[NUM_IMMEDIATE-1];
-
-    int j;
-    for (j = NUM_IMMEDIATE - 2; j >= pos; j--)
-    {
-        entry_list->list[j + 1] = entry_list->list[j];
-    }
-
-    entry_list->list[pos] = new_entry;
+    scope_entry_list_t* result = entry_list_allocate();
+    result->items[0] = entry;
+    result->num_items = 1;
 
-    if (entry_list->next != NULL)
-    {
-        insert_and_shift_right(entry_list->next, 0, keep);
-    }
-    else if (entry_list->next == NULL && keep != NULL)
-    {
-        entry_list->next = entry_list_node_allocate();
-        entry_list_add_to_pos_rec(entry_list->next, keep, 0);
-    }
+    return result;
 }
 
-static char entry_list_add_after_rec(scope_entry_list_node_t* list,
-        scope_entry_t* position,
+scope_entry_list_t* entry_list_prepend(scope_entry_list_t* list,
         scope_entry_t* entry)
 {
     if (list == NULL)
-        return 0;
+        return entry_list_new(entry);
 
-    char found = 0;
-    int j;
-    for (j = 0; j < NUM_IMMEDIATE; j++)
-    {
-        if (list->next->list[j] == position)
-        {
-            found = 1;
-            break;
-        }
-    }
+    entry_list_insert_at(list, 0, entry);
+    return list;
+}
 
-    if (!found)
-    {
-        // The current node does not contain the symbol 'position'.
-        // Try with the next node.
-        return entry_list_add_after_rec(list->next, position, entry);
-    }
+scope_entry_list_t* entry_list_add(scope_entry_list_t* list,
+        scope_entry_t* entry)
+{
+    if (list == NULL)
+        return entry_list_new(entry);
 
-    // The symbol 'position' has been found
+    entry_list_reserve(list, list->num_items + 1);
+    list->items[list->num_items] = entry;
+    list->num_items++;
 
-    // If this symbol is not in the last position of the current node we add
-    // entry in the current node
-    if (j < (NUM_IMMEDIATE-1))
-    {
-        insert_and_shift_right(list, j+1, entry);
-    }
-    // Otherwise, the symbol should be added in the next node
-    else
-    {
-        //if the next node exists, we add the 'entry' symbol to its list
-        if (list->next != NULL)
-        {
-            insert_and_shift_right(list->next, 0, entry);
-        }
-        // Otherwise, we create a new node and add 'entry' symbol to its list
-        else
-        {
-            list->next = entry_list_node_allocate();
-            entry_list_add_to_pos_rec(list->next, entry, 0);
-        }
-    }
-    return 1;
+    return list;
 }
 
-scope_entry_list_t* entry_list_add_after(scope_entry_list_t* list,
-        scope_entry_t* position,
+scope_entry_list_t* entry_list_add_once(scope_entry_list_t* list,
         scope_entry_t* entry)
 {
-    char added_an_element = entry_list_add_after_rec(list->next, position, entry);
-
-    if (added_an_element)
-        list->num_items_list++;
+    if (entry_list_contains(list, entry))
+        return list;
 
-    return list;
+    return entry_list_add(list, entry);
 }
 
-static char entry_list_add_before_rec(
-        scope_entry_list_node_t* list,
+scope_entry_list_t* entry_list_add_after(scope_entry_list_t* list,
         scope_entry_t* position,
         scope_entry_t* entry)
 {
     if (list == NULL)
-        return 0;
-
-    char found = 0;
-    int j;
-    for (j = 0; j < NUM_IMMEDIATE; j++)
-    {
-        if (list->list[j] == position)
-        {
-            found = 1;
-            break;
-        }
-    }
-
-    if (!found)
-    {
-        return entry_list_add_before_rec(list->next, position, entry);
-    }
-
-    // The symbol 'position' has been found
+        return list;
 
-    insert_and_shift_right(list, j, entry);
+    int pos = entry_list_find(list, position);
+    if (pos >= 0)
+        entry_list_insert_at(list, pos + 1, entry);
 
-    return 1;
+    return list;
 }
 
 scope_entry_list_t* entry_list_add_before(scope_entry_list_t* list,
         scope_entry_t* position,
         scope_entry_t* entry)
 {
-    char added_an_element = entry_list_add_before_rec(list->next, position, entry);
+    if (list == NULL)
+        return list;
 
-    if (added_an_element)
-        list->num_items_list++;
+    int pos = entry_list_find(list, position);
+    if (pos >= 0)
+        entry_list_insert_at(list, pos, entry);
 
     return list;
 }
@@ -316,44 +175,27 @@ scope_entry_list_t* entry_list_copy(const scope_entry_list_t* list)
     if (list == NULL)
         return NULL;
 
-    scope_entry_list_t* result = NEW0(scope_entry_list_t);
+    scope_entry_list_t* result = entry_list_allocate();
+    entry_list_reserve(result, list->num_items);
 
-    result->num_items_list = list->num_items_list;
-    scope_entry_list_node_t* it = list->next;
-    scope_entry_list_node_t** current = &(result->next);
-
-    while (it != NULL)
-    {
-        *current = NEW0(scope_entry_list_node_t);
-        int i;
-        for (i = 0; i < NUM_IMMEDIATE; i++)
-        {
-            (*current)->list[i] = it->list[i];
-        }
-        current = &((*current)->next);
-        it = it->next;
-    }
+    memcpy(result->items, list->items, list->num_items * sizeof(*list->items));
+    result->num_items = list->num_items;
 
     return result;
 }
-static void entry_list_node_free(scope_entry_list_node_t* list)
-{
-    if (list == NULL)
-        return;
-
-    entry_list_node_free(list->next);
-    memset(list, 0, sizeof(*list));
-    DELETE(list);
-}
 
 void entry_list_free(scope_entry_list_t* list)
 {
     if (list == NULL)
         return;
 
-    entry_list_node_free(list->next);
-    memset(list, 0, sizeof(*list));
-    DELETE(list);
+    if (list->items != list->immediate)
+        DELETE(list->items);
+
+    list->num_items = 0;
+    list->capacity = 0;
+    list->items = (scope_entry_t**)free_lists;
+    free_lists = list;
 }
 
 // -
@@ -361,62 +203,44 @@ void entry_list_free(scope_entry_list_t* list)
 int entry_list_size(const scope_entry_list_t* list)
 {
     if (list != NULL)
-        return list->num_items_list;
+        return list->num_items;
     else
         return 0;
 }
 
 scope_entry_t* entry_list_head(const scope_entry_list_t* list)
 {
-    return list->next->list[0];
+    return list->items[0];
 }
 
 // -
 
 struct scope_entry_list_iterator_tag
 {
-    int current_pos;
-    int total_pos;
-    const scope_entry_list_node_t* current_list;
-    const scope_entry_list_t* first_list;
+    scope_entry_list_stack_iterator_t it;
 };
 
-static scope_entry_list_iterator_t* entry_list_iterator_allocate(void)
-{
-    return NEW0(scope_entry_list_iterator_t);
-}
-
 scope_entry_list_iterator_t* entry_list_iterator_begin(const scope_entry_list_t* list)
 {
-    scope_entry_list_iterator_t* result = entry_list_iterator_allocate();
-    result->first_list = list;
-    result->current_list = (list != NULL) ? list->next : NULL;
-    result->current_pos = 0;
-    result->total_pos = 0;
+    scope_entry_list_iterator_t* result = NEW(scope_entry_list_iterator_t);
+    result->it = entry_list_stack_iterator_begin(list);
 
     return result;
 }
 
 scope_entry_t* entry_list_iterator_current(scope_entry_list_iterator_t* it)
 {
-    return it->current_list->list[it->current_pos];
+    return entry_list_stack_iterator_current(&it->it);
 }
 
 void entry_list_iterator_next(scope_entry_list_iterator_t* it)
 {
-    it->current_pos++;
-    it->total_pos++;
-    if (it->current_pos == NUM_IMMEDIATE)
-    {
-        it->current_pos = 0;
-        it->current_list = it->current_list->next;
-    }
+    entry_list_stack_iterator_next(&it->it);
 }
 
 char entry_list_iterator_end(scope_entry_list_iterator_t* it)
 {
-    return (it->first_list == NULL
-            || (it->total_pos >= it->first_list->num_items_list));
+    return entry_list_stack_iterator_end(&it->it);
 }
 
 void entry_list_iterator_free(scope_entry_list_iterator_t* it)
@@ -446,41 +270,23 @@ scope_entry_list_t* entry_list_merge(const scope_entry_list_t* list1,
 {
     int size1 = (list1 != NULL ? entry_list_size(list1) : 0);
     scope_entry_t** elems1 = NEW_VEC0(scope_entry_t*, size1 + 1);
-    scope_entry_t** p = elems1;
 
-    scope_entry_list_iterator_t* it = NULL;
-    for (it = entry_list_iterator_begin(list1);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
-    {
-        scope_entry_t* entry = entry_list_iterator_current(it);
-        *p = entry;
-        p++;
-    }
-    entry_list_iterator_free(it);
+    if (size1 > 0)
+        memcpy(elems1, list1->items, size1 * sizeof(*elems1));
 
     int size2 = (list2 != NULL ? entry_list_size(list2) : 0);
     scope_entry_t** elems2 = NEW_VEC0(scope_entry_t*, size2 + 1);
 
-    scope_entry_t** q = elems2;
-
-    for (it = entry_list_iterator_begin(list2);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
-    {
-        scope_entry_t* entry = entry_list_iterator_current(it);
-        *q = entry;
-        q++;
-    }
-    entry_list_iterator_free(it);
+    if (size2 > 0)
+        memcpy(elems2, list2->items, size2 * sizeof(*elems2));
 
     //   void qsort(void *base, size_t nmemb, size_t size,
     //  int(*compar)(const void *, const void *));
     qsort(elems1, size1, sizeof(*elems1), ptr_comp);
     qsort(elems2, size2, sizeof(*elems2), ptr_comp);
 
-    p = elems1;
-    q = elems2;
+    scope_entry_t** p = elems1;
+    scope_entry_t** q = elems2;
 
     scope_entry_list_t* result = NULL;
 
@@ -536,68 +342,27 @@ char entry_list_contains(const scope_entry_list_t* list,
     if (list == NULL)
         return 0;
 
-    char result = 0;
-
-    scope_entry_list_iterator_t* it = NULL;
-    for (it = entry_list_iterator_begin(list);
-            !entry_list_iterator_end(it) && !result;
-            entry_list_iterator_next(it))
-    {
-        if (entry_list_iterator_current(it) == entry)
-        {
-            result = 1;
-        }
-    }
-    entry_list_iterator_free(it);
-
-    return result;
-}
-
-static scope_entry_t* shift_left_all_elements_from_pos(scope_entry_list_node_t* entry_list, int pos)
-{
-    if (entry_list == NULL)
-        return NULL;
-
-    int j;
-    scope_entry_t* first_element = entry_list->list[0];
-    for (j = pos + 1; j < NUM_IMMEDIATE; j++)
-    {
-        entry_list->list[j - 1] = entry_list->list[j];
-    }
-
-    entry_list->list[NUM_IMMEDIATE - 1] = shift_left_all_elements_from_pos(entry_list->next, 0);
-
-    return first_element;
+    return entry_list_find(list, entry) >= 0;
 }
 
-
-static int entry_list_remove_rec(scope_entry_list_node_t* entry_list, scope_entry_t* entry)
+scope_entry_list_t* entry_list_remove(scope_entry_list_t* entry_list, scope_entry_t* entry)
 {
     if (entry_list == NULL)
-        return 0;
+        return entry_list;
 
-    int i;
-    int number_of_matches = 0;
-    for (i = 0; i < NUM_IMMEDIATE; i++)
+    int i, j = 0;
+    for (i = 0; i < entry_list->num_items; i++)
     {
-        if (entry_list->list[i] == entry)
+        if (entry_list->items[i] != entry)
         {
-            number_of_matches++;
-            shift_left_all_elements_from_pos(entry_list, i);
+            entry_list->items[j] = entry_list->items[i];
+            j++;
         }
     }
+    for (i = j; i < entry_list->num_items; i++)
+        entry_list->items[i] = NULL;
 
-    return (entry_list_remove_rec(entry_list->next, entry) + number_of_matches);
-}
-
-scope_entry_list_t* entry_list_remove(scope_entry_list_t* entry_list, scope_entry_t* entry)
-{
-    if (entry_list == NULL)
-        return entry_list;
-
-    int number_of_matches = entry_list_remove_rec(entry_list->next, entry);
-
-    entry_list->num_items_list -= number_of_matches;
+    entry_list->num_items = j;
     return entry_list;
 }
 
@@ -606,14 +371,9 @@ void entry_list_to_symbol_array(scope_entry_list_t* list, scope_entry_t*** array
     int size = entry_list_size(list);
     *array = NEW_VEC0(scope_entry_t*, size);
 
-    *num_items = 0;
-    scope_entry_list_iterator_t* it = NULL;
-    for (it = entry_list_iterator_begin(list); !entry_list_iterator_end(it); entry_list_iterator_next(it))
-    {
-        (*array)[*num_items] = entry_list_iterator_current(it);
-        (*num_items)++;
-    }
-    entry_list_iterator_free(it);
+    if (size > 0)
+        memcpy(*array, list->items, size * sizeof(**array));
+    *num_items = size;
 }
 
 scope_entry_list_t* entry_list_from_symbol_array(int num_items, scope_entry_t** list)
@@ -624,34 +384,29 @@ scope_entry_list_t* entry_list_from_symbol_array(int num_items, scope_entry_t**
     }
 
     scope_entry_list_t* result = entry_list_allocate();
-    int ind;
-    for (ind = 0; ind < num_items; ++ind)
-    {
-        result = entry_list_add(result, list[ind]);
-    }
+    entry_list_reserve(result, num_items);
+
+    memcpy(result->items, list, num_items * sizeof(*list));
+    result->num_items = num_items;
+
     return result;
 }
 
 scope_entry_list_t* entry_list_concat(const scope_entry_list_t* a, const scope_entry_list_t* b)
 {
-    scope_entry_list_t* result = NULL;
+    int size_a = entry_list_size(a);
+    int size_b = entry_list_size(b);
+    if (size_a + size_b == 0)
+        return NULL;
 
-    scope_entry_list_iterator_t* it = NULL;
-    for (it = entry_list_iterator_begin(a);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
-    {
-        result = entry_list_add(result, entry_list_iterator_current(it));
-    }
-    entry_list_iterator_free(it);
+    scope_entry_list_t* result = entry_list_allocate();
+    entry_list_reserve(result, size_a + size_b);
 
-    for (it = entry_list_iterator_begin(b);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
-    {
-        result = entry_list_add(result, entry_list_iterator_current(it));
-    }
-    entry_list_iterator_free(it);
+    if (size_a > 0)
+        memcpy(result->items, a->items, size_a * sizeof(*a->items));
+    if (size_b > 0)
+        memcpy(result->items + size_a, b->items, size_b * sizeof(*b->items));
+    result->num_items = size_a + size_b;
 
     return result;
 }
@@ -78,6 +78,12 @@ LIBMCXX_EXTERN char entry_list_iterator_end(scope_entry_list_iterator_t* it);
 
 LIBMCXX_EXTERN void entry_list_iterator_free(scope_entry_list_iterator_t* it);
 
+// Stack iterator, prefer it in new code
+static inline scope_entry_list_stack_iterator_t entry_list_stack_iterator_begin(const scope_entry_list_t* list);
+static inline scope_entry_t* entry_list_stack_iterator_current(const scope_entry_list_stack_iterator_t* it);
+static inline void entry_list_stack_iterator_next(scope_entry_list_stack_iterator_t* it);
+static inline char entry_list_stack_iterator_end(const scope_entry_list_stack_iterator_t* it);
+
 // Other ops
 LIBMCXX_EXTERN scope_entry_list_t* entry_list_merge(const scope_entry_list_t* list1, 
         const scope_entry_list_t* list2);
@@ -91,6 +97,8 @@ LIBMCXX_EXTERN WARN_UNUSED scope_entry_list_t* entry_list_from_symbol_array(int
 
 LIBMCXX_EXTERN WARN_UNUSED scope_entry_list_t* entry_list_concat(const scope_entry_list_t*, const scope_entry_list_t*);
 
+#include "cxx-entrylist-inline.h"
+
 MCXX_END_DECLS
 
 #endif // CXX_ENTRYLIST_H
@@ -24,11 +24,11 @@
 
 primary_expression : MCC_ARRAY_SUBSCRIPT_CHECK '(' assignment_expression ',' constant_expression ')'
 {
-    $$ = ASTMake2(AST_MCC_ARRAY_SUBSCRIPT_CHECK, $3, $5, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake2(AST_MCC_ARRAY_SUBSCRIPT_CHECK, $3, $5, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 | MCC_CONST_VALUE_CHECK '(' assignment_expression ')'
 {
-    $$ = ASTMake1(AST_MCC_CONSTANT_VALUE_CHECK, $3, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    $$ = ASTMake1(AST_MCC_CONSTANT_VALUE_CHECK, $3, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 ;
 
@@ -56,7 +56,7 @@ noshape_cast_expression : unary_expression %merge<ambiguityHandler>
 }
 | '(' type_id ')' cast_expression %merge<ambiguityHandler>
 {
-	$$ = ASTMake2(AST_CAST, $2, $4, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+	$$ = ASTMake2(AST_CAST, $2, $4, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 }
 ;
 
@@ -84,8 +84,8 @@ shape: '[' expression ']'
 
 iteration_statement : FOR '[' symbol_literal_ref ']' '(' for_init_statement condition_opt ';' expression_opt ')' statement
 {
-    AST loop_control = ASTMake3(AST_LOOP_CONTROL, $6, $7, $9, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
-	$$ = ASTMake4(AST_FOR_STATEMENT, loop_control, $11, NULL, $3, make_locus(@1.first_filename, @1.first_line, @1.first_column), NULL);
+    AST loop_control = ASTMake3(AST_LOOP_CONTROL, $6, $7, $9, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
+	$$ = ASTMake4(AST_FOR_STATEMENT, loop_control, $11, NULL, $3, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), NULL);
 
 }
 ;
@@ -108,11 +108,11 @@ type_specifier_SUSL : mercurium_extended_type_specifiers
 
 mercurium_extended_type_specifiers : MCC_BOOL
 {
-	$$ = ASTLeaf(AST_MCC_BOOL, make_locus(@1.first_filename, @1.first_line, @1.first_column), $1.token_text);
+	$$ = ASTLeaf(AST_MCC_BOOL, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), $1.token_text);
 }
 | MCC_MASK
 {
-	$$ = ASTLeaf(AST_MCC_MASK, make_locus(@1.first_filename, @1.first_line, @1.first_column), $1.token_text);
+	$$ = ASTLeaf(AST_MCC_MASK, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), $1.token_text);
 }
 ;
 
@@ -136,7 +136,7 @@ multiexpression_body : assignment_expression ',' multiexpression_iterator
 
 multiexpression_iterator : identifier_token '=' multiexpression_range
 {
-    AST symbol = ASTLeaf(AST_SYMBOL, make_locus(@1.first_filename, @1.first_line, @1.first_column), $1.token_text);
+    AST symbol = ASTLeaf(AST_SYMBOL, make_locus_file_id(@1.first_file_id, @1.first_line, @1.first_column), $1.token_text);
     $$ = ASTMake2(AST_MULTIEXPRESSION_ITERATOR, symbol, $3, ast_get_locus(symbol), NULL);
 }
 ;
@@ -33,6 +33,7 @@
 #include "cxx-cexpr.h"
 #include "cxx-diagnostic.h"
 #include "cxx-intelsupport.h"
+#include "cxx-lazybuiltins.h"
 #include <string.h>
 #include <math.h>
 
@@ -3538,12 +3539,21 @@ static scope_entry_t* solve_gcc_atomic_builtins_overload_name_generic(
     return NULL;
 }
 
+// Intel architecture gcc builtins
+#define LAZY_BUILTIN_SET gcc_ia32_builtins
+#define LAZY_BUILTIN_TABLE "cxx-gccbuiltins-ia32.h"
+#define LAZY_BUILTIN_LOCUS "(gcc-builtin-ia32)"
+#include "cxx-lazybuiltins-table.h"
+
+#define LAZY_BUILTIN_SET gcc_ia32_deprecated_builtins
+#define LAZY_BUILTIN_TABLE "cxx-gccbuiltins-ia32-deprecated.h"
+#define LAZY_BUILTIN_LOCUS "(gcc-builtin-ia32)"
+#include "cxx-lazybuiltins-table.h"
+
 static void sign_in_gcc_simd_builtins(const decl_context_t* decl_context)
 {
-    // Intel architecture gcc builtins
-    const locus_t* builtins_locus = make_locus("(gcc-builtin-ia32)", 0, 0);
-#include "cxx-gccbuiltins-ia32.h"
-#include "cxx-gccbuiltins-ia32-deprecated.h"
+    lazy_builtins_sign_in_set(decl_context, &gcc_ia32_builtins);
+    lazy_builtins_sign_in_set(decl_context, &gcc_ia32_deprecated_builtins);
 }
 
 static void sign_in_simd_builtins(const decl_context_t* decl_context)
@@ -3581,6 +3591,11 @@ static type_t* get_unsigned_16x8_int(void)
 }
 #endif
 
+#define LAZY_BUILTIN_SET gcc_arm_neon_builtins
+#define LAZY_BUILTIN_TABLE "cxx-gccbuiltins-arm-neon.h"
+#define LAZY_BUILTIN_LOCUS "(gcc-builtin-arm)"
+#include "cxx-lazybuiltins-table.h"
+
 static void gcc_builtins_neon(const decl_context_t* decl_context)
 {
 
@@ -3695,8 +3710,7 @@ static void gcc_builtins_neon(const decl_context_t* decl_context)
         symbol_entity_specs_set_is_builtin(sym, 1);
     }
 
-    const locus_t* builtins_locus = make_locus("(gcc-builtin-arm)", 0, 0);
-#include "cxx-gccbuiltins-arm-neon.h"
+    lazy_builtins_sign_in_set(decl_context, &gcc_arm_neon_builtins);
 }
 
 extern void gcc_builtins_arm(const decl_context_t* global_context)
@@ -3704,6 +3718,11 @@ extern void gcc_builtins_arm(const decl_context_t* global_context)
     gcc_builtins_neon(global_context);
 }
 
+#define LAZY_BUILTIN_SET gcc_arm64_neon_builtins
+#define LAZY_BUILTIN_TABLE "cxx-gccbuiltins-arm64-neon.h"
+#define LAZY_BUILTIN_LOCUS "(gcc-builtin-aarch64)"
+#include "cxx-lazybuiltins-table.h"
+
 static void gcc_builtins_neon_arm64(const decl_context_t* decl_context)
 {
 #define GENERATE_NEON_VECTOR_BUILTINS \
@@ -3810,8 +3829,7 @@ static void gcc_builtins_neon_arm64(const decl_context_t* decl_context)
         symbol_entity_specs_set_is_builtin(sym, 1);
     }
 
-    const locus_t* builtins_locus = make_locus("(gcc-builtin-aarch64)", 0, 0);
-#include "cxx-gccbuiltins-arm64-neon.h"
+    lazy_builtins_sign_in_set(decl_context, &gcc_arm64_neon_builtins);
 }
 
 extern void gcc_builtins_arm64(const decl_context_t* global_context)
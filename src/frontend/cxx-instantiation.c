@@ -46,6 +46,7 @@
 #include "cxx-codegen.h"
 
 #include "cxx-printscope.h"
+#include "cxx-driver-utils.h"
 
 static scope_entry_t* add_duplicate_member_to_class(
         const decl_context_t* context_of_being_instantiated,
@@ -2217,14 +2218,81 @@ struct instantiation_item_tag
     const locus_t* locus;
 } instantiation_item_t;
 
-static instantiation_item_t** symbols_to_instantiate;
-static int num_symbols_to_instantiate;
+// Worklist of functions pending to be instantiated. It is a FIFO queue (a
+// ring buffer) and a set with the symbols currently in it, so a symbol is
+// never queued twice
+static instantiation_item_t* pending_queue = NULL;
+static int pending_queue_capacity = 0;
+static int pending_queue_head = 0;
+static int num_pending = 0;
+static dhash_ptr_t* pending_symbols = NULL;
+
+// Statistics of the whole process, see instantiation_get_stats
+static int num_instantiations_requested = 0;
+static int num_instantiations_queued = 0;
+static int num_instantiations_done = 0;
+static int max_num_pending = 0;
+static double time_pending_instantiations = 0.0;
 
 void instantiation_init(void)
 {
     nodecl_instantiation_units = nodecl_null();
-    symbols_to_instantiate = NULL;
-    num_symbols_to_instantiate = 0;
+
+    pending_queue_head = 0;
+    num_pending = 0;
+    if (pending_symbols != NULL)
+        dhash_ptr_destroy(pending_symbols);
+    pending_symbols = dhash_ptr_new(5);
+}
+
+static void pending_queue_push(scope_entry_t* entry, const locus_t* locus)
+{
+    if (num_pending == pending_queue_capacity)
+    {
+        int new_capacity = (pending_queue_capacity == 0) ? 64 : 2 * pending_queue_capacity;
+        instantiation_item_t* new_queue = NEW_VEC(instantiation_item_t, new_capacity);
+
+        // Unwrap the ring buffer
+        int i;
+        for (i = 0; i < num_pending; i++)
+            new_queue[i] = pending_queue[(pending_queue_head + i) % pending_queue_capacity];
+
+        DELETE(pending_queue);
+        pending_queue = new_queue;
+        pending_queue_capacity = new_capacity;
+        pending_queue_head = 0;
+    }
+
+    instantiation_item_t* item = &pending_queue[(pending_queue_head + num_pending) % pending_queue_capacity];
+    item->symbol = entry;
+    item->locus = locus;
+    num_pending++;
+
+    dhash_ptr_insert(pending_symbols, (const char*)entry, entry);
+}
+
+static instantiation_item_t pending_queue_pop(void)
+{
+    instantiation_item_t result = pending_queue[pending_queue_head];
+    pending_queue_head = (pending_queue_head + 1) % pending_queue_capacity;
+    num_pending--;
+
+    dhash_ptr_remove(pending_symbols, (const char*)result.symbol);
+
+    return result;
+}
+
+void instantiation_get_stats(int* num_requested,
+        int* num_queued,
+        int* num_instantiated,
+        int* max_pending,
+        double* seconds)
+{
+    *num_requested = num_instantiations_requested;
+    *num_queued = num_instantiations_queued;
+    *num_instantiated = num_instantiations_done;
+    *max_pending = max_num_pending;
+    *seconds = time_pending_instantiations;
 }
 
 static void instantiate_every_symbol(scope_entry_t* entry,
@@ -2265,25 +2333,28 @@ static void mark_class_and_bases_as_user_declared(scope_entry_t* sym)
 
 void instantiation_instantiate_pending_functions(nodecl_t* nodecl_output)
 {
-    while (num_symbols_to_instantiate > 0)
-    {
-        int tmp_num_symbols_to_instantiate = num_symbols_to_instantiate;
-        instantiation_item_t** tmp_symbols_to_instantiate = symbols_to_instantiate;
-
-        num_symbols_to_instantiate = 0;
-        symbols_to_instantiate = NULL;
+    timing_t timing_instantiation;
+    timing_start(&timing_instantiation);
 
-        int i;
-        for (i = 0; i < tmp_num_symbols_to_instantiate; i++)
-        {
-            instantiate_every_symbol(
-                    tmp_symbols_to_instantiate[i]->symbol,
-                    tmp_symbols_to_instantiate[i]->locus);
+    int num_done = 0;
+    // Instantiating a function may queue more functions
+    while (num_pending > 0)
+    {
+        instantiation_item_t item = pending_queue_pop();
+        instantiate_every_symbol(item.symbol, item.locus);
+        num_done++;
+    }
 
+    timing_end(&timing_instantiation);
+    num_instantiations_done += num_done;
+    time_pending_instantiations += timing_elapsed(&timing_instantiation);
 
-            DELETE(tmp_symbols_to_instantiate[i]);
-        }
-        DELETE(tmp_symbols_to_instantiate);
+    if (CURRENT_CONFIGURATION->verbose
+            && num_done > 0)
+    {
+        fprintf(stderr, "%d pending functions instantiated in %.2f seconds\n",
+                num_done,
+                timing_elapsed(&timing_instantiation));
     }
 
     if (!nodecl_is_null(nodecl_instantiation_units))
@@ -2508,30 +2579,21 @@ void instantiation_instantiate_pending_functions(nodecl_t* nodecl_output)
     DELETE(list);
 }
 
-static char compare_instantiate_items(instantiation_item_t* current_item, instantiation_item_t* new_item)
-{
-    return current_item->symbol == new_item->symbol;
-}
-
 void instantiation_add_symbol_to_instantiate(scope_entry_t* entry,
         const locus_t* locus)
 {
-    instantiation_item_t* item = NEW0(instantiation_item_t);
-    item->symbol = entry;
-    item->locus = locus;
+    num_instantiations_requested++;
 
-    int old_num = num_symbols_to_instantiate;
+    if (pending_symbols == NULL)
+        pending_symbols = dhash_ptr_new(5);
+    else if (dhash_ptr_query(pending_symbols, (const char*)entry) != NULL)
+        return;
 
-    P_LIST_ADD_ONCE_FUN(symbols_to_instantiate,
-            num_symbols_to_instantiate,
-            item,
-            compare_instantiate_items);
+    pending_queue_push(entry, locus);
 
-    // Crummy way to know if it was added
-    if (old_num == num_symbols_to_instantiate)
-    {
-        DELETE(item);
-    }
+    num_instantiations_queued++;
+    if (num_pending > max_num_pending)
+        max_num_pending = num_pending;
 }
 
 static char instantiate_true_template_function(scope_entry_t* entry, const locus_t* locus UNUSED_PARAMETER)
@@ -57,6 +57,14 @@ LIBMCXX_EXTERN void instantiation_instantiate_pending_functions(nodecl_t* nodecl
 LIBMCXX_EXTERN void instantiation_add_symbol_to_instantiate(scope_entry_t* entry,
         const locus_t* locus);
 
+// Statistics of the functions queued to be instantiated by
+// instantiation_add_symbol_to_instantiate in the whole process
+LIBMCXX_EXTERN void instantiation_get_stats(int* num_requested,
+        int* num_queued,
+        int* num_instantiated,
+        int* max_pending,
+        double* seconds);
+
 LIBMCXX_EXTERN char function_may_be_instantiated(scope_entry_t* entry);
 LIBMCXX_EXTERN void instantiate_template_function(scope_entry_t* entry, const locus_t* locus);
 
@@ -34,6 +34,7 @@
 #include "cxx-exprtype.h"
 #include "cxx-diagnostic.h"
 #include "cxx-utils.h"
+#include "cxx-lazybuiltins.h"
 
 void intel_check_assume(
         AST expression,
@@ -561,14 +562,21 @@ char intel_vector_struct_to_intel_vector_struct_reinterpret_type(type_t* orig, t
     return 0;
 }
 
+// Xeon
+#define LAZY_BUILTIN_SET icc_builtins
+#define LAZY_BUILTIN_TABLE "cxx-iccbuiltins.h"
+#define LAZY_BUILTIN_LOCUS "(intel-builtins)"
+#include "cxx-lazybuiltins-table.h"
+
+// Knights Corner (aka MIC)
+#define LAZY_BUILTIN_SET icc_knc_builtins
+#define LAZY_BUILTIN_TABLE "cxx-iccbuiltins-knc.h"
+#define LAZY_BUILTIN_LOCUS "(intel-builtins-knc)"
+#include "cxx-lazybuiltins-table.h"
+
 void sign_in_icc_intrinsics(const decl_context_t* decl_context)
 {
-    const locus_t* builtins_locus = make_locus("(intel-builtins)", 0, 0);
-    // Xeon
-#include "cxx-iccbuiltins.h"
-
-    // Knights Corner (aka MIC)
-    builtins_locus = make_locus("(intel-builtins-knc)", 0, 0);
-#include "cxx-iccbuiltins-knc.h"
+    lazy_builtins_sign_in_set(decl_context, &icc_builtins);
+    lazy_builtins_sign_in_set(decl_context, &icc_knc_builtins);
 }
 
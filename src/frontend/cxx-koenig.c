@@ -36,6 +36,8 @@
 #include "cxx-typeutils.h"
 #include "cxx-utils.h"
 #include "cxx-entrylist.h"
+#include "cxx-driver.h"
+#include "dhash_ptr.h"
 
 // Koenig lookup may need to instantiate something
 #include "cxx-instantiation.h"
@@ -119,12 +121,12 @@ scope_entry_list_t* koenig_lookup(
                 DF_ONLY_CURRENT_SCOPE);
 
         scope_entry_list_t* filtered_friends = NULL;
-        scope_entry_list_iterator_t *it = NULL;
-        for (it = entry_list_iterator_begin(current_result);
-                !entry_list_iterator_end(it);
-                entry_list_iterator_next(it))
+        scope_entry_list_stack_iterator_t it;
+        for (it = entry_list_stack_iterator_begin(current_result);
+                !entry_list_stack_iterator_end(&it);
+                entry_list_stack_iterator_next(&it))
         {
-            scope_entry_t* current_entry = entry_list_iterator_current(it);
+            scope_entry_t* current_entry = entry_list_stack_iterator_current(&it);
 
             if (!symbol_entity_specs_get_is_friend_declared(current_entry))
             {
@@ -143,18 +145,16 @@ scope_entry_list_t* koenig_lookup(
                 scope_entry_t* current_class = koenig_info.associated_classes[j];
                 scope_entry_list_t* friend_list = class_type_get_friends(current_class->type_information);
 
-                scope_entry_list_iterator_t* it2 = NULL;
-                for (it2 = entry_list_iterator_begin(friend_list);
-                        !entry_list_iterator_end(it2) && !found_in_an_associated_class;
-                        entry_list_iterator_next(it2))
+                scope_entry_list_stack_iterator_t it2;
+                for (it2 = entry_list_stack_iterator_begin(friend_list);
+                        !entry_list_stack_iterator_end(&it2) && !found_in_an_associated_class;
+                        entry_list_stack_iterator_next(&it2))
                 {
-                    scope_entry_t* friend_decl = entry_list_iterator_current(it2);
+                    scope_entry_t* friend_decl = entry_list_stack_iterator_current(&it2);
                     scope_entry_t* current_friend = symbol_entity_specs_get_alias_to(friend_decl);
 
                     found_in_an_associated_class = (current_friend == current_entry);
                 }
-
-                entry_list_iterator_free(it2);
             }
 #undef it
 #undef i
@@ -164,7 +164,6 @@ scope_entry_list_t* koenig_lookup(
                 filtered_friends = entry_list_add(filtered_friends, current_entry);
             }
         }
-        entry_list_iterator_free(it);
 
         scope_entry_list_t* old_result = result;
 
@@ -203,6 +202,120 @@ static void compute_associated_scopes(
     compute_associated_scopes_aux(result, num_arguments, argument_type_list, locus);
 }
 
+/*
+ * Cache of associated scopes and classes
+ *
+ * Types are hash-consed so the associated scopes and classes of an argument
+ * type are computed only once and shared by every call. Sets that involve
+ * an incomplete class are not cached as completing that class later may add
+ * bases to them
+ */
+// type_t* -> koenig_lookup_info_t*
+static dhash_ptr_t* _associated_scopes_cache = NULL;
+
+static int _associated_scopes_num_hits = 0;
+static int _associated_scopes_num_misses = 0;
+
+// Set while computing the associated scopes of a type if the result cannot be
+// cached
+static char _associated_scopes_not_cacheable = 0;
+
+static void free_cached_associated_scopes(const char* key UNUSED_PARAMETER,
+        void* info,
+        void* walk_info UNUSED_PARAMETER)
+{
+    koenig_lookup_info_t* cached_info = (koenig_lookup_info_t*)info;
+    DELETE(cached_info->associated_scopes);
+    DELETE(cached_info->associated_classes);
+    DELETE(cached_info);
+}
+
+void koenig_init(void)
+{
+    if (_associated_scopes_cache != NULL)
+    {
+        dhash_ptr_walk(_associated_scopes_cache, free_cached_associated_scopes, NULL);
+        dhash_ptr_destroy(_associated_scopes_cache);
+        _associated_scopes_cache = NULL;
+    }
+}
+
+void koenig_get_stats(int* num_hits, int* num_misses)
+{
+    *num_hits = _associated_scopes_num_hits;
+    *num_misses = _associated_scopes_num_misses;
+}
+
+static void add_associated_class(koenig_lookup_info_t* koenig_info, scope_entry_t* class_symbol);
+
+static void merge_associated_scopes(koenig_lookup_info_t* koenig_info,
+        koenig_lookup_info_t* argument_info)
+{
+    int i;
+    for (i = 0; i < argument_info->num_associated_scopes; i++)
+    {
+        P_LIST_ADD_ONCE(koenig_info->associated_scopes,
+                koenig_info->num_associated_scopes,
+                argument_info->associated_scopes[i]);
+    }
+
+    for (i = 0; i < argument_info->num_associated_classes; i++)
+    {
+        add_associated_class(koenig_info, argument_info->associated_classes[i]);
+    }
+}
+
+static void compute_associated_scopes_of_argument(koenig_lookup_info_t* koenig_info,
+        type_t* argument_type,
+        const locus_t* locus)
+{
+    argument_type = no_ref(advance_over_typedefs(argument_type));
+
+    if (debug_options.disable_koenig_cache
+            || is_dependent_type(argument_type))
+    {
+        compute_associated_scopes_rec(koenig_info, argument_type, locus);
+        return;
+    }
+
+    if (_associated_scopes_cache == NULL)
+    {
+        _associated_scopes_cache = dhash_ptr_new(5);
+    }
+
+    koenig_lookup_info_t* cached_info = (koenig_lookup_info_t*)dhash_ptr_query(
+            _associated_scopes_cache, (const char*)argument_type);
+
+    if (cached_info != NULL)
+    {
+        _associated_scopes_num_hits++;
+        merge_associated_scopes(koenig_info, cached_info);
+        return;
+    }
+    _associated_scopes_num_misses++;
+
+    koenig_lookup_info_t* argument_info = NEW0(koenig_lookup_info_t);
+
+    // Completing a class may instantiate templates that do Koenig lookup
+    // themselves, so keep the flag of the enclosing computation
+    char outer_not_cacheable = _associated_scopes_not_cacheable;
+    _associated_scopes_not_cacheable = 0;
+    compute_associated_scopes_rec(argument_info, argument_type, locus);
+    char not_cacheable = _associated_scopes_not_cacheable;
+    _associated_scopes_not_cacheable = outer_not_cacheable;
+
+    merge_associated_scopes(koenig_info, argument_info);
+
+    if (!not_cacheable)
+    {
+        dhash_ptr_insert(_associated_scopes_cache, (const char*)argument_type, argument_info);
+    }
+    else
+    {
+        free_cached_associated_scopes(NULL, argument_info, NULL);
+    }
+}
+
 static void compute_associated_scopes_aux(koenig_lookup_info_t* koenig_info, 
         int num_arguments, type_t** argument_type_list,
         const locus_t* locus)
@@ -211,7 +324,7 @@ static void compute_associated_scopes_aux(koenig_lookup_info_t* koenig_info,
     for (i = 0; i < num_arguments; i++)
     {
         type_t* argument_type = argument_type_list[i];
-        compute_associated_scopes_rec(koenig_info, argument_type, locus);
+        compute_associated_scopes_of_argument(koenig_info, argument_type, locus);
     }
 }
 
@@ -479,6 +592,9 @@ static void compute_set_of_associated_classes_scope_rec(type_t* type_info,
             named_type_get_symbol(type_info)->decl_context,
             locus);
 
+    if (!is_complete_type(type_info))
+        _associated_scopes_not_cacheable = 1;
+
     add_associated_class(koenig_info, class_symbol);
 
     if (symbol_entity_specs_get_is_member(class_symbol))
@@ -44,6 +44,9 @@ LIBMCXX_EXTERN scope_entry_list_t* koenig_lookup(
         nodecl_t nodecl_simple_name,
         const locus_t* locus);
 
+LIBMCXX_EXTERN void koenig_init(void);
+LIBMCXX_EXTERN void koenig_get_stats(int* num_hits, int* num_misses);
+
 MCXX_END_DECLS
 
 #endif // CXX_KOENIG_H
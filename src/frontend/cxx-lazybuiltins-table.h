@@ -0,0 +1,96 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+
+/*
+   Defines a lazy_builtin_set_t (see cxx-lazybuiltins.h) from one of the
+   generated builtin tables. Each entry of the table is one of
+
+     BUILTIN_FUNCTION(name, type)
+     BUILTIN_FUNCTION_CXX(name, type)     -- only available in C++
+     BUILTIN_ALIAS(name, aliased_name)
+
+   where type is an expression computing the function type of the builtin.
+   The table is included twice: once to define a function computing the type
+   of every builtin and once more to build the array of descriptors.
+
+   Usage:
+
+     #define LAZY_BUILTIN_SET gcc_ia32_builtins
+     #define LAZY_BUILTIN_TABLE "cxx-gccbuiltins-ia32.h"
+     #define LAZY_BUILTIN_LOCUS "(gcc-builtin-ia32)"
+     #include "cxx-lazybuiltins-table.h"
+
+   This header can be included several times and does not leave any macro
+   defined.
+ */
+
+#if !defined(LAZY_BUILTIN_SET) || !defined(LAZY_BUILTIN_TABLE) || !defined(LAZY_BUILTIN_LOCUS)
+  #error LAZY_BUILTIN_SET, LAZY_BUILTIN_TABLE and LAZY_BUILTIN_LOCUS must be defined
+#endif
+
+#define LAZY_BUILTIN_CAT_(a, b) a##b
+#define LAZY_BUILTIN_CAT(a, b) LAZY_BUILTIN_CAT_(a, b)
+#define LAZY_BUILTIN_TYPE_FUN(name) LAZY_BUILTIN_CAT(LAZY_BUILTIN_SET, LAZY_BUILTIN_CAT(_type_, name))
+
+#define BUILTIN_FUNCTION(name, type) \
+    static type_t* LAZY_BUILTIN_TYPE_FUN(name)(void) { return type; }
+#define BUILTIN_FUNCTION_CXX(name, type) BUILTIN_FUNCTION(name, type)
+#define BUILTIN_ALIAS(name, aliased_name)
+#include LAZY_BUILTIN_TABLE
+#undef BUILTIN_FUNCTION
+#undef BUILTIN_FUNCTION_CXX
+#undef BUILTIN_ALIAS
+
+#define BUILTIN_FUNCTION(name, type) { #name, LAZY_BUILTIN_TYPE_FUN(name), NULL, 0 },
+#define BUILTIN_FUNCTION_CXX(name, type) { #name, LAZY_BUILTIN_TYPE_FUN(name), NULL, 1 },
+#define BUILTIN_ALIAS(name, aliased_name) { #name, NULL, #aliased_name, 0 },
+static const lazy_builtin_t LAZY_BUILTIN_CAT(LAZY_BUILTIN_SET, _table)[] =
+{
+#include LAZY_BUILTIN_TABLE
+};
+#undef BUILTIN_FUNCTION
+#undef BUILTIN_FUNCTION_CXX
+#undef BUILTIN_ALIAS
+
+static lazy_builtin_set_t LAZY_BUILTIN_SET =
+{
+    .locus_name = LAZY_BUILTIN_LOCUS,
+    .builtins = LAZY_BUILTIN_CAT(LAZY_BUILTIN_SET, _table),
+    .num_builtins = STATIC_ARRAY_LENGTH(LAZY_BUILTIN_CAT(LAZY_BUILTIN_SET, _table)),
+    .index_size = 0,
+    .index = NULL,
+};
+
+#undef LAZY_BUILTIN_TYPE_FUN
+#undef LAZY_BUILTIN_CAT
+#undef LAZY_BUILTIN_CAT_
+
+#undef LAZY_BUILTIN_SET
+#undef LAZY_BUILTIN_TABLE
+#undef LAZY_BUILTIN_LOCUS
@@ -0,0 +1,199 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+
+#include "cxx-lazybuiltins.h"
+#include "cxx-scope.h"
+#include "cxx-entrylist.h"
+#include "cxx-utils.h"
+#include "dhash_ptr.h"
+#include <string.h>
+#include <stdint.h>
+
+// Builtin sets made available in a global scope
+typedef struct lazy_builtins_registration_tag
+{
+    const decl_context_t* global_context;
+
+    int num_sets;
+    lazy_builtin_set_t** sets;
+} lazy_builtins_registration_t;
+
+// Registrations indexed by global scope
+static dhash_ptr_t* registrations = NULL;
+
+static int stats_num_available = 0;
+static int stats_num_signed_in = 0;
+
+static uint32_t lazy_builtin_hash(const char* name)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    const unsigned char* p;
+    for (p = (const unsigned char*)name; *p != '\0'; p++)
+    {
+        hash ^= *p;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void lazy_builtin_set_build_index(lazy_builtin_set_t* set)
+{
+    int index_size = 16;
+    while (index_size < 2 * set->num_builtins)
+        index_size *= 2;
+
+    // Entries store the position in the table plus one, 0 means empty
+    set->index = NEW_VEC0(int, index_size);
+    set->index_size = index_size;
+
+    int i;
+    for (i = 0; i < set->num_builtins; i++)
+    {
+        int pos = lazy_builtin_hash(set->builtins[i].name) & (index_size - 1);
+        while (set->index[pos] != 0)
+            pos = (pos + 1) & (index_size - 1);
+
+        set->index[pos] = i + 1;
+    }
+}
+
+static const lazy_builtin_t* lazy_builtin_set_find(lazy_builtin_set_t* set, const char* name)
+{
+    if (set->index == NULL)
+        lazy_builtin_set_build_index(set);
+
+    int pos = lazy_builtin_hash(name) & (set->index_size - 1);
+    while (set->index[pos] != 0)
+    {
+        const lazy_builtin_t* builtin = &set->builtins[set->index[pos] - 1];
+        if (strcmp(builtin->name, name) == 0)
+            return builtin;
+
+        pos = (pos + 1) & (set->index_size - 1);
+    }
+
+    return NULL;
+}
+
+static lazy_builtins_registration_t* lazy_builtins_get_registration(scope_t* global_scope)
+{
+    if (registrations == NULL)
+        return NULL;
+
+    return (lazy_builtins_registration_t*)dhash_ptr_query(registrations,
+            (const char*)global_scope);
+}
+
+void lazy_builtins_sign_in_set(const decl_context_t* global_context,
+        lazy_builtin_set_t* set)
+{
+    lazy_builtins_registration_t* registration =
+        lazy_builtins_get_registration(global_context->global_scope);
+
+    if (registration == NULL)
+    {
+        registration = NEW0(lazy_builtins_registration_t);
+        registration->global_context = global_context;
+
+        if (registrations == NULL)
+            registrations = dhash_ptr_new(5);
+        dhash_ptr_insert(registrations, (const char*)global_context->global_scope, registration);
+    }
+
+    int i;
+    for (i = 0; i < registration->num_sets; i++)
+    {
+        if (registration->sets[i] == set)
+            return;
+    }
+
+    P_LIST_ADD(registration->sets, registration->num_sets, set);
+    stats_num_available += set->num_builtins;
+}
+
+static void lazy_builtin_sign_in(const decl_context_t* global_context,
+        lazy_builtin_set_t* set,
+        const lazy_builtin_t* builtin)
+{
+    type_t* function_type;
+    if (builtin->alias_of != NULL)
+    {
+        // This may in turn sign in the aliased builtin
+        scope_entry_list_t* entry_list = query_in_scope_str(global_context,
+                uniquestr(builtin->alias_of), /* field_path */ NULL);
+        ERROR_CONDITION(entry_list == NULL, "Symbol '%s' should have been declared", builtin->alias_of);
+        function_type = entry_list_head(entry_list)->type_information;
+        entry_list_free(entry_list);
+    }
+    else
+    {
+        function_type = (builtin->compute_type)();
+    }
+
+    scope_entry_t* sym = new_symbol(global_context, global_context->global_scope, uniquestr(builtin->name));
+    sym->kind = SK_FUNCTION;
+    sym->do_not_print = 1;
+    sym->locus = make_locus(set->locus_name, 0, 0);
+    sym->type_information = function_type;
+    symbol_entity_specs_set_is_builtin(sym, 1);
+
+    stats_num_signed_in++;
+}
+
+char lazy_builtins_sign_in_on_demand(scope_t* global_scope, const char* name)
+{
+    lazy_builtins_registration_t* registration =
+        lazy_builtins_get_registration(global_scope);
+    if (registration == NULL)
+        return 0;
+
+    char signed_in = 0;
+    int i;
+    for (i = 0; i < registration->num_sets; i++)
+    {
+        lazy_builtin_set_t* set = registration->sets[i];
+        const lazy_builtin_t* builtin = lazy_builtin_set_find(set, name);
+
+        if (builtin == NULL
+                || (builtin->cxx_only && !IS_CXX_LANGUAGE))
+            continue;
+
+        lazy_builtin_sign_in(registration->global_context, set, builtin);
+        signed_in = 1;
+    }
+
+    return signed_in;
+}
+
+void lazy_builtins_get_stats(int* num_available, int* num_signed_in)
+{
+    *num_available = stats_num_available;
+    *num_signed_in = stats_num_signed_in;
+}
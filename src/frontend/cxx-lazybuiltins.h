@@ -0,0 +1,76 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+
+#ifndef CXX_LAZYBUILTINS_H
+#define CXX_LAZYBUILTINS_H
+
+#include "libmcxx-common.h"
+#include "cxx-scope-decls.h"
+#include "cxx-buildscope-decls.h"
+
+MCXX_BEGIN_DECLS
+
+// Target builtins (SIMD intrinsics and the like) are described by a static
+// table and are only signed in the global scope the first time a lookup of
+// their name fails there. See cxx-lazybuiltins-table.h
+typedef struct lazy_builtin_tag
+{
+    const char* name;
+    // Computes the type of the builtin. NULL for aliases
+    type_t* (*compute_type)(void);
+    // Builtin whose type is reused. Only for aliases
+    const char* alias_of;
+    // Only signed in for C++
+    char cxx_only;
+} lazy_builtin_t;
+
+typedef struct lazy_builtin_set_tag
+{
+    const char* locus_name;
+    const lazy_builtin_t* builtins;
+    int num_builtins;
+
+    // Open addressing index of builtins by name, built on first use
+    int index_size;
+    int* index;
+} lazy_builtin_set_t;
+
+// Makes the builtins of the set available in the global scope of global_context
+LIBMCXX_EXTERN void lazy_builtins_sign_in_set(const decl_context_t* global_context,
+        lazy_builtin_set_t* set);
+
+// Called when a lookup of name fails in global_scope. Returns nonzero if
+// some builtin with that name has been signed in
+LIBMCXX_EXTERN char lazy_builtins_sign_in_on_demand(scope_t* global_scope, const char* name);
+
+LIBMCXX_EXTERN void lazy_builtins_get_stats(int* num_available, int* num_signed_in);
+
+MCXX_END_DECLS
+
+#endif // CXX_LAZYBUILTINS_H
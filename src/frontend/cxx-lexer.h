@@ -43,9 +43,11 @@ struct token_atrib_tag
     const char* token_text;
 } token_atrib_t;
 
+// Files are identified by their locus file id (see locus_file_id) so the
+// lexer does not have to intern the filename of every token
 typedef struct parser_location_tag
 {
-    const char* first_filename;
+    unsigned int first_file_id;
     int first_line;
     int first_column;
 } parser_location_t;
@@ -54,14 +56,14 @@ typedef struct parser_location_tag
     do                                                                  \
       if (N)                                                            \
         {                                                               \
-          (Current).first_filename = YYRHSLOC (Rhs, 1).first_filename;  \
+          (Current).first_file_id  = YYRHSLOC (Rhs, 1).first_file_id;   \
           (Current).first_line     = YYRHSLOC (Rhs, 1).first_line;      \
           (Current).first_column   = YYRHSLOC (Rhs, 1).first_column;    \
         }                                                               \
       else                                                              \
         {                                                               \
-          (Current).first_filename   =                                  \
-            YYRHSLOC (Rhs, 0).first_filename;                           \
+          (Current).first_file_id    =                                  \
+            YYRHSLOC (Rhs, 0).first_file_id;                            \
           (Current).first_line =                                        \
             YYRHSLOC (Rhs, 0).first_line;                               \
           (Current).first_column =                                      \
@@ -76,9 +78,22 @@ LIBMCXX_EXTERN void update_parser_location(const char* current_text, parser_loca
 LIBMCXX_EXTERN int mcxx_open_file_for_scanning(const char* scanned_filename, const char* input_filename);
 LIBMCXX_EXTERN int mc99_open_file_for_scanning(const char* scanned_filename, const char* input_filename);
 
+// Scans length bytes of buffer (e.g. the output of the preprocessor read
+// from a pipe) in place. The buffer must have room for two more bytes and
+// the lexer releases it with DELETE once scanned
+LIBMCXX_EXTERN int mcxx_open_buffer_for_scanning(char* buffer, size_t length,
+        const char* scanned_filename, const char* input_filename);
+LIBMCXX_EXTERN int mc99_open_buffer_for_scanning(char* buffer, size_t length,
+        const char* scanned_filename, const char* input_filename);
+
 LIBMCXX_EXTERN int mcxx_prepare_string_for_scanning(const char* str);
 LIBMCXX_EXTERN int mc99_prepare_string_for_scanning(const char* str);
 
+// Scans the whole file opened for scanning without parsing it. Returns the
+// number of tokens
+LIBMCXX_EXTERN int mcxx_lex_all_tokens(void);
+LIBMCXX_EXTERN int mc99_lex_all_tokens(void);
+
 LIBMCXX_EXTERN void register_new_directive(
         compilation_configuration_t* configuration,
         const char* prefix, const char* directive, char is_construct, 
@@ -31,6 +31,7 @@ enum
 {
     // AST limits
     MCXX_MAX_AST_CHILDREN = 4,
+    MCXX_MAX_AST_AMBIGUITIES = (1 << 14) - 1,
 
     // Function limits
     MCXX_MAX_FUNCTION_PARAMETERS = 1024,
@@ -27,14 +27,49 @@
 
 #include "cxx-locus.h"
 #include <stdlib.h>
+#include <stdint.h>
 #include "string_utils.h"
 
 struct locus_tag
 {
-    const char* filename;
+    unsigned int file_id;
     unsigned int line, col;
 };
 
+// Loci live in chunks aligned to their size. The first locus id of a chunk is
+// stored at its beginning so the id of a locus can be computed from its
+// address
+enum { LOCUS_CHUNK_SIZE = 1 << 16 };
+#define LOCI_PER_CHUNK ((LOCUS_CHUNK_SIZE - sizeof(locus_id_t)) / sizeof(locus_t))
+
+typedef
+struct locus_chunk_tag
+{
+    locus_id_t first_id;
+    locus_t loci[LOCI_PER_CHUNK];
+} locus_chunk_t;
+
+LIBMCXX_EXTERN locus_chunk_t** _locus_chunks;
+LIBMCXX_EXTERN const char** _locus_file_names;
+
+static inline locus_id_t locus_get_id(const locus_t* l)
+{
+    if (l == NULL)
+        return 0;
+
+    const locus_chunk_t* chunk = (const locus_chunk_t*)
+        ((uintptr_t)l & ~(uintptr_t)(LOCUS_CHUNK_SIZE - 1));
+    return chunk->first_id + (locus_id_t)(l - chunk->loci);
+}
+
+static inline const locus_t* locus_from_id(locus_id_t id)
+{
+    if (id == 0)
+        return NULL;
+
+    return &_locus_chunks[id / LOCI_PER_CHUNK]->loci[id % LOCI_PER_CHUNK];
+}
+
 static inline const char* locus_to_str(const locus_t* l)
 {
     const char* result = NULL;
@@ -42,9 +77,9 @@ static inline const char* locus_to_str(const locus_t* l)
         return ":0";
 
     if (l->col != 0)
-        uniquestr_sprintf(&result, "%s:%d:%d", l->filename, l->line, l->col);
+        uniquestr_sprintf(&result, "%s:%d:%d", _locus_file_names[l->file_id], l->line, l->col);
     else
-        uniquestr_sprintf(&result, "%s:%d", l->filename, l->line);
+        uniquestr_sprintf(&result, "%s:%d", _locus_file_names[l->file_id], l->line);
 
     return result;
 }
@@ -53,7 +88,12 @@ static inline const char* locus_get_filename(const locus_t* l)
 {
     if (l == NULL)
         return "";
-    return l->filename;
+    return _locus_file_names[l->file_id];
+}
+
+static inline unsigned int locus_get_file_id(const locus_t* l)
+{
+    return l == NULL ? 0 : l->file_id;
 }
 
 static inline unsigned int locus_get_line(const locus_t* l)
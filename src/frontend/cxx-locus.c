@@ -29,28 +29,21 @@
 #include <string.h>
 #include "uniquestr.h"
 #include "string_utils.h"
+#include "cxx-utils.h"
 
-// Heavily inspired in lib/char_hash.c contributed by Jan Hoogerbrugge
+// Filenames of loci are identified by a small integer. This way a locus can
+// be built without hashing its filename (e.g. the lexer only computes the
+// file id when a line marker changes the current file)
 
-typedef
-struct locus_item_tag
-{
-    unsigned int hash;
-    locus_t *locus;
-} locus_item_t;
-
-typedef
-struct locus_bucket_tag
-{
-    int num;
-    int capacity;
-    locus_item_t* items;
-} locus_bucket_t;
+const char** _locus_file_names = NULL;
+static int num_file_names = 0;
+static int file_names_capacity = 0;
 
+// Open addressing table of file ids (plus one, 0 means empty)
+static unsigned int *file_table = NULL;
+static unsigned int file_table_size = 0;
 
-static locus_bucket_t *hash_table[49999];
-
-static unsigned int hash_locus(const char *filename, unsigned int line, unsigned int col)
+static unsigned int hash_filename(const char *filename)
 {
     unsigned int hash = 0;
     const char *p;
@@ -58,93 +51,228 @@ static unsigned int hash_locus(const char *filename, unsigned int line, unsigned
     for (p = filename; *p; p++)
         hash = ((hash << 5) + hash) ^ *p;
 
-    hash = ((hash << 5) + hash) ^ line;
-    hash = ((hash << 5) + hash) ^ col;
-
     return hash;
 }
 
-enum { POOL_SIZE = 1024 };
-
-typedef
-struct pool_locus_tag
+static void file_table_insert(unsigned int file_id)
 {
-    int num;
-    locus_t* pool;
-    struct pool_locus_tag *prev;
-} pool_locus_t;
+    unsigned int mask = file_table_size - 1;
+    unsigned int i = hash_filename(_locus_file_names[file_id]) & mask;
 
-static pool_locus_t *pool_locus;
+    while (file_table[i] != 0)
+        i = (i + 1) & mask;
+
+    file_table[i] = file_id + 1;
+}
 
-static locus_t* pool_locus_alloc(void)
+static void file_table_grow(void)
 {
-    if (pool_locus == NULL
-            || pool_locus->num == POOL_SIZE)
-    {
-        pool_locus_t* new_pool = NEW(pool_locus_t);
-        new_pool->num = 0;
-        new_pool->pool = NEW_VEC(locus_t, POOL_SIZE);
-        new_pool->prev = pool_locus;
+    DELETE(file_table);
 
-        pool_locus = new_pool;
-    }
+    file_table_size = (file_table_size == 0) ? 64 : 2 * file_table_size;
+    file_table = NEW_VEC0(unsigned int, file_table_size);
 
-    locus_t* result = &pool_locus->pool[pool_locus->num];
-    pool_locus->num++;
+    int i;
+    for (i = 0; i < num_file_names; i++)
+        file_table_insert(i);
+}
 
-    return result;
+// File id 0 is always the empty filename, so a zeroed location is valid
+static void init_file_names(void)
+{
+    if (file_table_size != 0)
+        return;
+
+    file_table_grow();
+    locus_file_id("");
 }
 
-const locus_t* make_locus(const char* filename, unsigned int line, unsigned int col)
+unsigned int locus_file_id(const char* filename)
 {
     if (filename == NULL)
         filename = "";
 
-    unsigned int hash = hash_locus(filename, line, col);
-    unsigned int hash_index = hash % (sizeof(hash_table) / sizeof(hash_table[0]));
+    init_file_names();
+
+    unsigned int mask = file_table_size - 1;
+    unsigned int i = hash_filename(filename) & mask;
+
+    while (file_table[i] != 0)
+    {
+        unsigned int file_id = file_table[i] - 1;
+        if (strcmp(_locus_file_names[file_id], filename) == 0)
+            return file_id;
+
+        i = (i + 1) & mask;
+    }
 
-    if (hash_table[hash_index] == NULL)
+    if (num_file_names == file_names_capacity)
     {
-        hash_table[hash_index] = NEW0(locus_bucket_t);
+        file_names_capacity = (file_names_capacity == 0) ? 64 : 2 * file_names_capacity;
+        _locus_file_names = NEW_REALLOC(const char*, _locus_file_names, file_names_capacity);
     }
 
-    locus_bucket_t* bucket = hash_table[hash_index];
+    unsigned int file_id = num_file_names;
+    _locus_file_names[num_file_names] = uniquestr(filename);
+    num_file_names++;
+
+    // Keep the load factor below 1/2
+    if (2 * (unsigned int)num_file_names > file_table_size)
+        file_table_grow();
+    else
+        file_table[i] = file_id + 1;
+
+    return file_id;
+}
+
+// Loci are stored densely, a locus id is the index of the locus in the
+// sequence of chunks. The first slot of the first chunk is never used since
+// id 0 is the NULL locus
+
+locus_chunk_t** _locus_chunks = NULL;
+static int num_locus_chunks = 0;
+static int locus_chunks_capacity = 0;
+
+static locus_id_t num_loci = 0;
 
-    int i, n = bucket->num;
-    locus_item_t *items = bucket->items;
+// Chunks must be aligned to their size, so they are carved from larger slabs
+enum { LOCUS_CHUNKS_PER_SLAB = 16 };
 
-    for (i = 0; i < n; i++)
+static char* slab_next = NULL;
+static int slab_remaining = 0;
+
+static locus_chunk_t* locus_chunk_alloc(void)
+{
+    if (slab_remaining == 0)
     {
-        if (items[i].hash == hash
-                && strcmp(items[i].locus->filename, filename) == 0
-                && items[i].locus->line == line
-                && items[i].locus->col == col)
-        {
-            return items[i].locus;
-        }
+        char* slab = NEW_VEC(char, (LOCUS_CHUNKS_PER_SLAB + 1) * LOCUS_CHUNK_SIZE);
+
+        slab_next = (char*)(((uintptr_t)slab + LOCUS_CHUNK_SIZE - 1)
+                & ~(uintptr_t)(LOCUS_CHUNK_SIZE - 1));
+        slab_remaining = LOCUS_CHUNKS_PER_SLAB;
     }
 
-    if (bucket->num == bucket->capacity)
+    locus_chunk_t* result = (locus_chunk_t*)slab_next;
+    slab_next += LOCUS_CHUNK_SIZE;
+    slab_remaining--;
+
+    return result;
+}
+
+static locus_t* locus_alloc(void)
+{
+    if (num_loci % LOCI_PER_CHUNK == 0)
     {
-        if (bucket->capacity == 0)
-            bucket->capacity = 16;
-        else
-            bucket->capacity = 2*(bucket->capacity + 1);
+        if (num_locus_chunks == locus_chunks_capacity)
+        {
+            locus_chunks_capacity = (locus_chunks_capacity == 0) ? 16 : 2 * locus_chunks_capacity;
+            _locus_chunks = NEW_REALLOC(locus_chunk_t*, _locus_chunks, locus_chunks_capacity);
+        }
 
-        bucket->items =
-            xrealloc(bucket->items, bucket->capacity * sizeof(*(bucket->items)));
+        locus_chunk_t* chunk = locus_chunk_alloc();
+        chunk->first_id = num_loci;
+        _locus_chunks[num_locus_chunks] = chunk;
+        num_locus_chunks++;
 
-        items = bucket->items;
+        // Skip the NULL locus
+        if (num_loci == 0)
+            num_loci++;
     }
 
-    items[n].hash = hash;
-    items[n].locus = pool_locus_alloc();
-    items[n].locus->filename = uniquestr(filename);
-    items[n].locus->line = line;
-    items[n].locus->col = col;
+    ERROR_CONDITION(num_loci == (locus_id_t)~0U, "Too many loci", 0);
 
-    bucket->num++;
+    locus_t* result = &_locus_chunks[num_loci / LOCI_PER_CHUNK]->loci[num_loci % LOCI_PER_CHUNK];
+    num_loci++;
 
-    return items[n].locus;
+    return result;
+}
+
+// Open addressing table of locus ids (0 means empty) used to intern loci
+
+static locus_id_t *locus_table = NULL;
+static unsigned int locus_table_size = 0;
+
+static unsigned int hash_locus(unsigned int file_id, unsigned int line, unsigned int col)
+{
+    unsigned int hash = file_id;
+
+    hash = ((hash << 5) + hash) ^ line;
+    hash = ((hash << 5) + hash) ^ col;
+
+    // Nearby loci hash to nearby values, scatter them since the table is
+    // probed linearly
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bU;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35U;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+static void locus_table_insert(locus_id_t id)
+{
+    const locus_t* l = locus_from_id(id);
+
+    unsigned int mask = locus_table_size - 1;
+    unsigned int i = hash_locus(l->file_id, l->line, l->col) & mask;
+
+    while (locus_table[i] != 0)
+        i = (i + 1) & mask;
+
+    locus_table[i] = id;
 }
 
+static void locus_table_grow(void)
+{
+    DELETE(locus_table);
+
+    locus_table_size = (locus_table_size == 0) ? 4096 : 2 * locus_table_size;
+    locus_table = NEW_VEC0(locus_id_t, locus_table_size);
+
+    // Ids are dense so there is no need to walk the old table
+    locus_id_t id;
+    for (id = 1; id < num_loci; id++)
+        locus_table_insert(id);
+}
+
+const locus_t* make_locus(const char* filename, unsigned int line, unsigned int col)
+{
+    return make_locus_file_id(locus_file_id(filename), line, col);
+}
+
+const locus_t* make_locus_file_id(unsigned int file_id, unsigned int line, unsigned int col)
+{
+    init_file_names();
+    ERROR_CONDITION(file_id >= (unsigned int)num_file_names, "Invalid file id %u", file_id);
+
+    if (locus_table_size == 0)
+        locus_table_grow();
+
+    unsigned int mask = locus_table_size - 1;
+    unsigned int i = hash_locus(file_id, line, col) & mask;
+
+    while (locus_table[i] != 0)
+    {
+        const locus_t* l = locus_from_id(locus_table[i]);
+        if (l->line == line
+                && l->col == col
+                && l->file_id == file_id)
+            return l;
+
+        i = (i + 1) & mask;
+    }
+
+    locus_t* result = locus_alloc();
+    result->file_id = file_id;
+    result->line = line;
+    result->col = col;
+
+    // Keep the load factor below 1/2
+    if (2 * num_loci > locus_table_size)
+        locus_table_grow();
+    else
+        locus_table[i] = locus_get_id(result);
+
+    return result;
+}
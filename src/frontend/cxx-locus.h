@@ -28,18 +28,32 @@
 #define CXX_LOCUS_H
 
 #include "cxx-macros.h"
+#include "libmcxx-common.h"
 
 MCXX_BEGIN_DECLS
 
 typedef struct locus_tag locus_t;
 
+// Every distinct locus is interned and identified by a 32-bit id. Id 0 is
+// the NULL locus
+typedef unsigned int locus_id_t;
+
 const locus_t* make_locus(const char* filename, unsigned int line, unsigned int col);
 
+// Returns a small integer identifying filename. Loci made from a file id do
+// not hash the filename, use this when many loci share the same file
+unsigned int locus_file_id(const char* filename);
+const locus_t* make_locus_file_id(unsigned int file_id, unsigned int line, unsigned int col);
+
 static inline const char* locus_to_str(const locus_t*);
 static inline const char* locus_get_filename(const locus_t*);
+static inline unsigned int locus_get_file_id(const locus_t*);
 static inline unsigned int locus_get_line(const locus_t*);
 static inline unsigned int locus_get_column(const locus_t*);
 
+static inline locus_id_t locus_get_id(const locus_t*);
+static inline const locus_t* locus_from_id(locus_id_t);
+
 #include "cxx-locus-inline.h"
 
 MCXX_END_DECLS
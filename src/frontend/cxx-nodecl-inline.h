@@ -94,7 +94,7 @@ static inline nodecl_expr_info_t* nodecl_expr_get_expression_info(AST expr)
     nodecl_expr_info_t* p = ast_get_expr_info(expr);
     if (p == NULL)
     {
-        p = NEW(nodecl_expr_info_t);
+        p = (nodecl_expr_info_t*)ast_alloc_expr_info(expr, sizeof(*p));
         p->is_value_dependent = 0;
         p->is_type_dependent_expression = 0;
         p->type_info = NULL;
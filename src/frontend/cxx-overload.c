@@ -42,6 +42,7 @@
 #include "cxx-intelsupport.h"
 
 #include <string.h>
+#include <stdint.h>
 
 typedef
 enum implicit_conversion_sequence_kind_tag
@@ -1098,13 +1099,13 @@ static char solve_initialization_of_direct_reference_type_ics(
         class_type_get_all_conversions(get_actual_class_type(no_ref(orig)),
                 decl_context);
 
-    scope_entry_list_iterator_t* it = NULL;
-    for (it = entry_list_iterator_begin(conversions);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
+    scope_entry_list_stack_iterator_t it;
+    for (it = entry_list_stack_iterator_begin(conversions);
+            !entry_list_stack_iterator_end(&it);
+            entry_list_stack_iterator_next(&it))
     {
         scope_entry_t* conversion
-            = entry_list_iterator_current(it);
+            = entry_list_stack_iterator_current(&it);
 
         if (is_template_specialized_type(conversion->type_information))
         {
@@ -1158,7 +1159,6 @@ static char solve_initialization_of_direct_reference_type_ics(
             candidate_list = entry_list_add(candidate_list, conversion);
         }
     }
-    entry_list_iterator_free(it);
     entry_list_free(conversions);
 
     scope_entry_list_t* overload_set = unfold_and_mix_candidate_functions(
@@ -1169,16 +1169,15 @@ static char solve_initialization_of_direct_reference_type_ics(
     entry_list_free(candidate_list);
 
     candidate_t* candidate_set = NULL;
-    for (it = entry_list_iterator_begin(overload_set);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
+    for (it = entry_list_stack_iterator_begin(overload_set);
+            !entry_list_stack_iterator_end(&it);
+            entry_list_stack_iterator_next(&it))
     {
         candidate_set = candidate_set_add(candidate_set,
-                entry_list_iterator_current(it),
+                entry_list_stack_iterator_current(&it),
                 1,
                 &orig);
     }
-    entry_list_iterator_free(it);
 
     // Now we have all the candidates, perform an overload resolution on them
     char is_ambiguous = 0;
@@ -1251,13 +1250,13 @@ static scope_entry_list_t* conversion_function_candidates_initialization_of_nonc
         class_type_get_all_conversions(get_actual_class_type(no_ref(orig)),
                 decl_context);
 
-    scope_entry_list_iterator_t* it = NULL;
-    for (it = entry_list_iterator_begin(conversions);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
+    scope_entry_list_stack_iterator_t it;
+    for (it = entry_list_stack_iterator_begin(conversions);
+            !entry_list_stack_iterator_end(&it);
+            entry_list_stack_iterator_next(&it))
     {
         scope_entry_t* conversion
-            = entry_list_iterator_current(it);
+            = entry_list_stack_iterator_current(&it);
 
         if (is_template_specialized_type(conversion->type_information))
         {
@@ -1312,7 +1311,6 @@ static scope_entry_list_t* conversion_function_candidates_initialization_of_nonc
             candidate_list = entry_list_add(candidate_list, conversion);
         }
     }
-    entry_list_iterator_free(it);
     entry_list_free(conversions);
 
     return candidate_list;
@@ -1349,13 +1347,13 @@ static scope_entry_list_t* conversion_function_candidates_initialization_of_clas
             get_actual_class_type(no_ref(orig)),
             decl_context);
 
-    scope_entry_list_iterator_t* it;
-    for (it = entry_list_iterator_begin(conversions);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
+    scope_entry_list_stack_iterator_t it;
+    for (it = entry_list_stack_iterator_begin(conversions);
+            !entry_list_stack_iterator_end(&it);
+            entry_list_stack_iterator_next(&it))
     {
         scope_entry_t* conversion
-            = entry_list_iterator_current(it);
+            = entry_list_stack_iterator_current(&it);
 
         if (is_template_specialized_type(conversion->type_information))
         {
@@ -1395,7 +1393,6 @@ static scope_entry_list_t* conversion_function_candidates_initialization_of_clas
 
         candidate_list = entry_list_add(candidate_list, conversion);
     }
-    entry_list_iterator_free(it);
     entry_list_free(conversions);
 
     return candidate_list;
@@ -1470,17 +1467,16 @@ static char solve_initialization_of_nonclass_nonreference_type_ics(
             entry_list_free(candidate_list);
 
             candidate_t* candidate_set = NULL;
-            scope_entry_list_iterator_t* it;
-            for (it = entry_list_iterator_begin(overload_set);
-                    !entry_list_iterator_end(it);
-                    entry_list_iterator_next(it))
+            scope_entry_list_stack_iterator_t it;
+            for (it = entry_list_stack_iterator_begin(overload_set);
+                    !entry_list_stack_iterator_end(&it);
+                    entry_list_stack_iterator_next(&it))
             {
                 candidate_set = candidate_set_add(candidate_set,
-                        entry_list_iterator_current(it),
+                        entry_list_stack_iterator_current(&it),
                         1,
                         &orig);
             }
-            entry_list_iterator_free(it);
 
             // Now we have all the candidates, perform an overload resolution on them
             char is_ambiguous = 0;
@@ -2998,8 +2994,264 @@ char is_better_function(
 }
 
 /*
- * num_arguments includes the implicit argument so it should never be zero, at least 1
+ * Overload resolution memo
+ *
+ * Template-heavy code solves exactly the same overload many times (think of
+ * operator<< on the same stream or std::get on the same tuple). Since
+ * symbols and types are unique in a translation unit, a call is identified
+ * by the sequence of its candidates with their argument types (value
+ * categories are encoded as reference types) plus the kind of
+ * initialization and the destination type.
  */
+typedef
+struct overload_memo_entry_tag
+{
+    unsigned int hash;
+    int key_length;
+    intptr_t* key;
+
+    scope_entry_t* result;
+    char is_ambiguous;
+} overload_memo_entry_t;
+
+static overload_memo_entry_t** overload_memo_table = NULL;
+static unsigned int overload_memo_table_size = 0;
+static unsigned int overload_memo_num_entries = 0;
+
+// Statistics of the current translation unit, see overload_get_stats
+static int num_overload_memo_hits = 0;
+static int num_overload_memo_misses = 0;
+
+void overload_init(void)
+{
+    unsigned int i;
+    for (i = 0; i < overload_memo_table_size; i++)
+    {
+        if (overload_memo_table[i] != NULL)
+        {
+            DELETE(overload_memo_table[i]->key);
+            DELETE(overload_memo_table[i]);
+        }
+    }
+    DELETE(overload_memo_table);
+
+    overload_memo_table = NULL;
+    overload_memo_table_size = 0;
+    overload_memo_num_entries = 0;
+
+    num_overload_memo_hits = 0;
+    num_overload_memo_misses = 0;
+}
+
+void overload_get_stats(int* num_hits, int* num_misses)
+{
+    *num_hits = num_overload_memo_hits;
+    *num_misses = num_overload_memo_misses;
+}
+
+static int overload_memo_key_length(candidate_t* candidate_set)
+{
+    int length = 2;
+    candidate_t* it;
+    for (it = candidate_set; it != NULL; it = it->next)
+        length += 2 + it->num_args;
+
+    return length;
+}
+
+static void overload_memo_fill_key(intptr_t* key,
+        candidate_t* candidate_set,
+        enum initialization_kind initialization_kind,
+        type_t* dest)
+{
+    int n = 0;
+    key[n++] = (intptr_t)initialization_kind;
+    key[n++] = (intptr_t)dest;
+
+    candidate_t* it;
+    for (it = candidate_set; it != NULL; it = it->next)
+    {
+        key[n++] = (intptr_t)it->entry;
+        key[n++] = (intptr_t)it->num_args;
+
+        int i;
+        for (i = 0; i < it->num_args; i++)
+            key[n++] = (intptr_t)it->args[i];
+    }
+}
+
+static unsigned int overload_memo_hash(const intptr_t* key, int key_length)
+{
+    unsigned int hash = 0;
+
+    int i;
+    for (i = 0; i < key_length; i++)
+    {
+        uintptr_t k = (uintptr_t)key[i];
+        hash = ((hash << 5) + hash) ^ (unsigned int)(k ^ (k >> 16 >> 16));
+    }
+
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bU;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35U;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+static void overload_memo_table_insert(overload_memo_entry_t* entry)
+{
+    unsigned int mask = overload_memo_table_size - 1;
+    unsigned int i = entry->hash & mask;
+
+    while (overload_memo_table[i] != NULL)
+        i = (i + 1) & mask;
+
+    overload_memo_table[i] = entry;
+}
+
+static void overload_memo_table_grow(void)
+{
+    overload_memo_entry_t** old_table = overload_memo_table;
+    unsigned int old_size = overload_memo_table_size;
+
+    overload_memo_table_size = (old_size == 0) ? 1024 : 2 * old_size;
+    overload_memo_table = NEW_VEC0(overload_memo_entry_t*, overload_memo_table_size);
+
+    unsigned int i;
+    for (i = 0; i < old_size; i++)
+    {
+        if (old_table[i] != NULL)
+            overload_memo_table_insert(old_table[i]);
+    }
+
+    DELETE(old_table);
+}
+
+static overload_memo_entry_t* overload_memo_lookup(const intptr_t* key,
+        int key_length,
+        unsigned int hash)
+{
+    if (overload_memo_table_size == 0)
+        return NULL;
+
+    unsigned int mask = overload_memo_table_size - 1;
+    unsigned int i = hash & mask;
+
+    while (overload_memo_table[i] != NULL)
+    {
+        overload_memo_entry_t* entry = overload_memo_table[i];
+        if (entry->hash == hash
+                && entry->key_length == key_length
+                && memcmp(entry->key, key, key_length * sizeof(*key)) == 0)
+            return entry;
+
+        i = (i + 1) & mask;
+    }
+
+    return NULL;
+}
+
+static void overload_memo_add(intptr_t* key,
+        int key_length,
+        unsigned int hash,
+        scope_entry_t* result,
+        char is_ambiguous)
+{
+    if (2 * (overload_memo_num_entries + 1) > overload_memo_table_size)
+        overload_memo_table_grow();
+
+    overload_memo_entry_t* entry = NEW(overload_memo_entry_t);
+    entry->hash = hash;
+    entry->key_length = key_length;
+    entry->key = key;
+    entry->result = result;
+    entry->is_ambiguous = is_ambiguous;
+
+    overload_memo_table_insert(entry);
+    overload_memo_num_entries++;
+}
+
+// An incomplete class may become complete later in the translation unit
+// and then the implicit conversions from or to it may change
+static char overload_memo_type_is_stable(type_t* t)
+{
+    if (t == NULL)
+        return 1;
+
+    t = no_ref(t);
+    for (;;)
+    {
+        if (is_pointer_to_member_type(t))
+        {
+            if (!overload_memo_type_is_stable(pointer_to_member_type_get_class_type(t)))
+                return 0;
+            t = pointer_type_get_pointee_type(t);
+        }
+        else if (is_pointer_type(t))
+            t = pointer_type_get_pointee_type(t);
+        else if (is_array_type(t))
+            t = array_type_get_element_type(t);
+        else
+            break;
+    }
+
+    if (is_braced_list_type(t))
+    {
+        int i, num_types = braced_list_type_get_num_types(t);
+        for (i = 0; i < num_types; i++)
+        {
+            if (!overload_memo_type_is_stable(braced_list_type_get_type_num(t, i)))
+                return 0;
+        }
+        return 1;
+    }
+
+    return !is_class_type(t)
+        || !is_incomplete_type(t);
+}
+
+static char overload_memo_result_is_stable(candidate_t* candidate_set,
+        type_t* dest)
+{
+    if (!overload_memo_type_is_stable(dest))
+        return 0;
+
+    candidate_t* it;
+    for (it = candidate_set; it != NULL; it = it->next)
+    {
+        int i;
+        for (i = 0; i < it->num_args; i++)
+        {
+            if (!overload_memo_type_is_stable(it->args[i]))
+                return 0;
+        }
+
+        type_t* function_type = entry_advance_aliases(it->entry)->type_information;
+        if (!is_function_type(function_type))
+            continue;
+
+        int num_parameters = function_type_get_num_parameters(function_type);
+        for (i = 0; i < num_parameters; i++)
+        {
+            if (!overload_memo_type_is_stable(
+                        function_type_get_parameter_type_num(function_type, i)))
+                return 0;
+        }
+    }
+
+    return 1;
+}
+
+static scope_entry_t* solve_overload_uncached(candidate_t* candidate_set,
+        const decl_context_t* decl_context,
+        enum initialization_kind initialization_kind,
+        type_t* dest,
+        const locus_t* locus,
+        // Out
+        char *is_ambiguous);
+
 static scope_entry_t* solve_overload_(candidate_t* candidate_set,
         const decl_context_t* decl_context,
         enum initialization_kind initialization_kind,
@@ -3007,6 +3259,69 @@ static scope_entry_t* solve_overload_(candidate_t* candidate_set,
         const locus_t* locus,
         // Out
         char *is_ambiguous)
+{
+    // Computed function types are solved by a function that may have any
+    // side effect, they are not memoized
+    if (candidate_set == NULL
+            || (candidate_set->next == NULL
+                && is_computed_function_type(candidate_set->entry->type_information)))
+    {
+        return solve_overload_uncached(candidate_set, decl_context,
+                initialization_kind, dest, locus, is_ambiguous);
+    }
+
+    int key_length = overload_memo_key_length(candidate_set);
+    intptr_t* key = NEW_VEC(intptr_t, key_length);
+    overload_memo_fill_key(key, candidate_set, initialization_kind, dest);
+    unsigned int hash = overload_memo_hash(key, key_length);
+
+    overload_memo_entry_t* entry = overload_memo_lookup(key, key_length, hash);
+    if (entry != NULL)
+    {
+        DEBUG_CODE()
+        {
+            fprintf(stderr, "OVERLOAD: Reusing memoized overload resolution\n");
+        }
+        DELETE(key);
+        num_overload_memo_hits++;
+
+        *is_ambiguous = entry->is_ambiguous;
+        return entry->result;
+    }
+
+    num_overload_memo_misses++;
+
+    int num_errors = diagnostics_get_error_count();
+    char solved_is_ambiguous = 0;
+    scope_entry_t* result = solve_overload_uncached(candidate_set, decl_context,
+            initialization_kind, dest, locus, &solved_is_ambiguous);
+    *is_ambiguous = solved_is_ambiguous;
+
+    // Do not remember anything that emitted errors as they would not be
+    // emitted again
+    if (num_errors == diagnostics_get_error_count()
+            && overload_memo_result_is_stable(candidate_set, dest))
+    {
+        overload_memo_add(key, key_length, hash, result, solved_is_ambiguous);
+    }
+    else
+    {
+        DELETE(key);
+    }
+
+    return result;
+}
+
+/*
+ * num_arguments includes the implicit argument so it should never be zero, at least 1
+ */
+static scope_entry_t* solve_overload_uncached(candidate_t* candidate_set,
+        const decl_context_t* decl_context,
+        enum initialization_kind initialization_kind,
+        type_t* dest,
+        const locus_t* locus,
+        // Out
+        char *is_ambiguous)
 {
     DEBUG_CODE()
     {
@@ -3347,12 +3662,12 @@ scope_entry_t* address_of_overloaded_function(
 
     scope_entry_list_t* potential_valid = NULL;
 
-    scope_entry_list_iterator_t *it = NULL;
-    for (it = entry_list_iterator_begin(overload_set);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
+    scope_entry_list_stack_iterator_t it;
+    for (it = entry_list_stack_iterator_begin(overload_set);
+            !entry_list_stack_iterator_end(&it);
+            entry_list_stack_iterator_next(&it))
     {
-        scope_entry_t* current_fun = entry_advance_aliases(entry_list_iterator_current(it));
+        scope_entry_t* current_fun = entry_advance_aliases(entry_list_stack_iterator_current(&it));
 
         scope_entry_t* considered_function = NULL;
 
@@ -3465,7 +3780,6 @@ scope_entry_t* address_of_overloaded_function(
             }
         }
     }
-    entry_list_iterator_free(it);
 
     if (explicit_template_arguments != NULL
             && !there_are_templates)
@@ -3500,17 +3814,16 @@ scope_entry_t* address_of_overloaded_function(
                     fprintf(stderr, "OVERLOAD: Filtering templates from potential list set\n");
                 }
                 scope_entry_list_t* nontemplates = NULL;
-                for (it = entry_list_iterator_begin(potential_valid);
-                        !entry_list_iterator_end(it);
-                        entry_list_iterator_next(it))
+                for (it = entry_list_stack_iterator_begin(potential_valid);
+                        !entry_list_stack_iterator_end(&it);
+                        entry_list_stack_iterator_next(&it))
                 {
-                    scope_entry_t* current_fun = entry_list_iterator_current(it);
+                    scope_entry_t* current_fun = entry_list_stack_iterator_current(&it);
                     if (!is_template_specialized_type(current_fun->type_information))
                     {
                         nontemplates = entry_list_add(nontemplates, current_fun);
                     }
                 }
-                entry_list_iterator_free(it);
                 entry_list_free(potential_valid);
 
                 potential_valid = nontemplates;
@@ -3540,11 +3853,11 @@ scope_entry_t* address_of_overloaded_function(
         {
             // All remaining functions are template-specialized, order them
             scope_entry_t* more_specialized = entry_list_head(potential_valid);
-            for (it = entry_list_iterator_begin(potential_valid);
-                    !entry_list_iterator_end(it);
-                    entry_list_iterator_next(it))
+            for (it = entry_list_stack_iterator_begin(potential_valid);
+                    !entry_list_stack_iterator_end(&it);
+                    entry_list_stack_iterator_next(&it))
             {
-                scope_entry_t* current_fun = entry_list_iterator_current(it);
+                scope_entry_t* current_fun = entry_list_stack_iterator_current(&it);
                 if (current_fun == more_specialized)
                     continue;
 
@@ -3560,14 +3873,13 @@ scope_entry_t* address_of_overloaded_function(
                     more_specialized = current_fun;
                 }
             }
-            entry_list_iterator_free(it);
 
             // Check
-            for (it = entry_list_iterator_begin(potential_valid);
-                    !entry_list_iterator_end(it);
-                    entry_list_iterator_next(it))
+            for (it = entry_list_stack_iterator_begin(potential_valid);
+                    !entry_list_stack_iterator_end(&it);
+                    entry_list_stack_iterator_next(&it))
             {
-                scope_entry_t* current_fun = entry_list_iterator_current(it);
+                scope_entry_t* current_fun = entry_list_stack_iterator_current(&it);
                 if (current_fun == more_specialized)
                     continue;
 
@@ -3584,7 +3896,6 @@ scope_entry_t* address_of_overloaded_function(
                     break;
                 }
             }
-            entry_list_iterator_free(it);
             entry_list_free(potential_valid);
 
             if (more_specialized != NULL)
@@ -3633,13 +3944,13 @@ static scope_entry_list_t* constructor_candidates_initialization_of_class_type(
     scope_entry_list_t* candidate_list = NULL;
 
     scope_entry_list_t* constructors = class_type_get_constructors(get_actual_class_type(dest));
-    scope_entry_list_iterator_t* it = NULL;
-    for (it = entry_list_iterator_begin(constructors);
-                !entry_list_iterator_end(it);
-                entry_list_iterator_next(it))
+    scope_entry_list_stack_iterator_t it;
+    for (it = entry_list_stack_iterator_begin(constructors);
+                !entry_list_stack_iterator_end(&it);
+                entry_list_stack_iterator_next(&it))
     {
         scope_entry_t* constructor
-            = entry_list_iterator_current(it);
+            = entry_list_stack_iterator_current(&it);
 
         // 13.3.1.3 [over.match.ctor]
         // For direct-initialization, the candidate functions are all the
@@ -3705,7 +4016,6 @@ static scope_entry_list_t* constructor_candidates_initialization_of_class_type(
 
         candidate_list = entry_list_add(candidate_list, constructor);
     }
-    entry_list_iterator_free(it);
     entry_list_free(constructors);
 
     return candidate_list;
@@ -3765,17 +4075,16 @@ static scope_entry_t* solve_constructor_(type_t* class_type,
     entry_list_free(candidate_list);
 
     candidate_t* candidate_set = NULL;
-    scope_entry_list_iterator_t* it = NULL;
-    for (it = entry_list_iterator_begin(overload_set);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
+    scope_entry_list_stack_iterator_t it;
+    for (it = entry_list_stack_iterator_begin(overload_set);
+            !entry_list_stack_iterator_end(&it);
+            entry_list_stack_iterator_next(&it))
     {
         candidate_set = candidate_set_add(candidate_set,
-                entry_list_iterator_current(it),
+                entry_list_stack_iterator_current(&it),
                 num_arguments,
                 argument_types);
     }
-    entry_list_iterator_free(it);
 
     // Store the candidates here
     *candidates = overload_set;
@@ -3917,7 +4226,7 @@ static char solve_list_initialization_of_class_type_(
     scope_entry_list_t* candidate_list = NULL;
     scope_entry_list_t* all_constructors = class_type_get_constructors(get_actual_class_type(class_type));
 
-    scope_entry_list_iterator_t* it = NULL;
+    scope_entry_list_stack_iterator_t it;
     scope_entry_list_t* list_initializer_constructors = NULL;
 
     *candidates = NULL;
@@ -3927,11 +4236,11 @@ static char solve_list_initialization_of_class_type_(
             // any initializer-list-constructor
             && std_initializer_list_template != NULL)
     {
-        for (it = entry_list_iterator_begin(all_constructors);
-                !entry_list_iterator_end(it);
-                entry_list_iterator_next(it))
+        for (it = entry_list_stack_iterator_begin(all_constructors);
+                !entry_list_stack_iterator_end(&it);
+                entry_list_stack_iterator_next(&it))
         {
-            scope_entry_t* entry = entry_list_iterator_current(it);
+            scope_entry_t* entry = entry_list_stack_iterator_current(&it);
 
             int num_parameters = function_type_get_num_parameters(entry->type_information);
             // Number of real parameters, ellipsis are counted as parameters
@@ -3963,7 +4272,6 @@ static char solve_list_initialization_of_class_type_(
                 }
             }
         }
-        entry_list_iterator_free(it);
 
 
         type_t* braced_list_type = get_braced_list_type(num_arguments, argument_types);
@@ -3975,16 +4283,15 @@ static char solve_list_initialization_of_class_type_(
         entry_list_free(list_initializer_constructors);
 
         candidate_t* candidate_set = NULL;
-        for (it = entry_list_iterator_begin(overload_set);
-                !entry_list_iterator_end(it);
-                entry_list_iterator_next(it))
+        for (it = entry_list_stack_iterator_begin(overload_set);
+                !entry_list_stack_iterator_end(&it);
+                entry_list_stack_iterator_next(&it))
         {
             candidate_set = candidate_set_add(candidate_set,
-                    entry_list_iterator_current(it),
+                    entry_list_stack_iterator_current(&it),
                     1,
                     &braced_list_type);
         }
-        entry_list_iterator_free(it);
 
         *candidates = entry_list_concat(*candidates, overload_set);
 
@@ -4016,12 +4323,12 @@ static char solve_list_initialization_of_class_type_(
         }
     }
 
-    for (it = entry_list_iterator_begin(all_constructors);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
+    for (it = entry_list_stack_iterator_begin(all_constructors);
+            !entry_list_stack_iterator_end(&it);
+            entry_list_stack_iterator_next(&it))
     {
         scope_entry_t* current_constructor
-            = entry_list_iterator_current(it);
+            = entry_list_stack_iterator_current(&it);
 
         // For template specialized types, use the template symbol
         if (is_template_specialized_type(current_constructor->type_information))
@@ -4034,7 +4341,6 @@ static char solve_list_initialization_of_class_type_(
 
         candidate_list = entry_list_add(candidate_list, current_constructor);
     }
-    entry_list_iterator_free(it);
 
     // Second phase (only if the first was not done or failed)
 
@@ -4045,16 +4351,15 @@ static char solve_list_initialization_of_class_type_(
             locus, /* explicit_template_arguments */ NULL);
 
     candidate_t* candidate_set = NULL;
-    for (it = entry_list_iterator_begin(overload_set);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
+    for (it = entry_list_stack_iterator_begin(overload_set);
+            !entry_list_stack_iterator_end(&it);
+            entry_list_stack_iterator_next(&it))
     {
         candidate_set = candidate_set_add(candidate_set,
-                entry_list_iterator_current(it),
+                entry_list_stack_iterator_current(&it),
                 num_arguments,
                 argument_types);
     }
-    entry_list_iterator_free(it);
 
     *candidates = entry_list_concat(*candidates, overload_set);
 
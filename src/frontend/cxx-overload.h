@@ -36,6 +36,10 @@
 
 MCXX_BEGIN_DECLS
 
+// Forgets memoized overload resolutions, once per translation unit
+LIBMCXX_EXTERN void overload_init(void);
+LIBMCXX_EXTERN void overload_get_stats(int* num_hits, int* num_misses);
+
 LIBMCXX_EXTERN candidate_t* candidate_set_add(candidate_t* candidate_set,
         scope_entry_t* entry,
         int num_args,
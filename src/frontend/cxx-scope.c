@@ -49,6 +49,7 @@
 #include "cxx-entrylist.h"
 #include "cxx-diagnostic.h"
 #include "dhash_ptr.h"
+#include "cxx-lazybuiltins.h"
 
 
 // Lookup of a simple name within a given declaration context
@@ -432,11 +433,15 @@ decl_context_t* new_class_context(const decl_context_t* enclosing_context,
     return result;
 }
 
+static void class_scope_lookup_cache_invalidate(scope_t* sc);
+
 void insert_alias(scope_t* sc, scope_entry_t* entry, const char* name)
 {
     ERROR_CONDITION(name == NULL ||
             *name == '\0', "Insert alias called with an empty or NULL string", 0);
 
+    class_scope_lookup_cache_invalidate(sc);
+
     const char* symbol_name = uniquestr(name);
 
     scope_entry_list_t* result_set = (scope_entry_list_t*)dhash_ptr_query(sc->dhash, symbol_name);
@@ -508,6 +513,16 @@ static scope_entry_list_t* query_name_in_scope(scope_t* sc, const char* name)
 
     scope_entry_list_t *result = (scope_entry_list_t*)dhash_ptr_query(sc->dhash, name);
 
+    // Target builtins are only signed in the global scope when first looked up
+    if (result == NULL
+            && name[0] == '_'
+            && sc->kind == NAMESPACE_SCOPE
+            && sc->contained_in == NULL
+            && lazy_builtins_sign_in_on_demand(sc, name))
+    {
+        result = (scope_entry_list_t*)dhash_ptr_query(sc->dhash, name);
+    }
+
     // ERROR_CONDITION(name != uniquestr(name), "Invalid name", 0);
 
     DEBUG_CODE()
@@ -533,22 +548,23 @@ void insert_entry(scope_t* sc, scope_entry_t* entry)
     ERROR_CONDITION((entry->symbol_name == NULL), "Inserting a symbol entry without name!", 0);
     // ERROR_CONDITION(entry->symbol_name != uniquestr(entry->symbol_name), "Name of symbol not canonical", 0);
 
+    class_scope_lookup_cache_invalidate(sc);
+
     scope_entry_list_t* result_set = (scope_entry_list_t*)dhash_ptr_query(sc->dhash, entry->symbol_name);
 
     if (result_set != NULL)
     {
         char do_not_add = 0;
-        scope_entry_list_iterator_t* it = entry_list_iterator_begin(result_set);
-        while (!entry_list_iterator_end(it) && !do_not_add)
+        scope_entry_list_stack_iterator_t it = entry_list_stack_iterator_begin(result_set);
+        while (!entry_list_stack_iterator_end(&it) && !do_not_add)
         {
-            if (entry_list_iterator_current(it) == entry)
+            if (entry_list_stack_iterator_current(&it) == entry)
             {
                 do_not_add = 1;
             }
 
-            entry_list_iterator_next(it);
+            entry_list_stack_iterator_next(&it);
         }
-        entry_list_iterator_free(it);
 
         if (!do_not_add)
         {
@@ -569,6 +585,8 @@ void remove_entry(scope_t* sc, scope_entry_t* entry)
     if (entry_list == NULL)
         return;
 
+    class_scope_lookup_cache_invalidate(sc);
+
     entry_list = entry_list_remove(entry_list, entry);
 
     if (entry_list_size(entry_list) >= 1)
@@ -585,12 +603,12 @@ scope_entry_list_t* filter_symbol_kind_set(scope_entry_list_t* entry_list, int n
 {
     scope_entry_list_t* result = NULL;
 
-    scope_entry_list_iterator_t* it = NULL;
-    for (it = entry_list_iterator_begin(entry_list);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
+    scope_entry_list_stack_iterator_t it;
+    for (it = entry_list_stack_iterator_begin(entry_list);
+            !entry_list_stack_iterator_end(&it);
+            entry_list_stack_iterator_next(&it))
     {
-        scope_entry_t* entry = entry_list_iterator_current(it);
+        scope_entry_t* entry = entry_list_stack_iterator_current(&it);
 
         int i;
         char found = 0;
@@ -603,7 +621,6 @@ scope_entry_list_t* filter_symbol_kind_set(scope_entry_list_t* entry_list, int n
             }
         }
     }
-    entry_list_iterator_free(it);
 
     return result;
 }
@@ -622,12 +639,12 @@ scope_entry_list_t* filter_symbol_non_kind_set(scope_entry_list_t* entry_list, i
 {
     scope_entry_list_t* result = NULL;
 
-    scope_entry_list_iterator_t* it = NULL;
-    for (it = entry_list_iterator_begin(entry_list);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
+    scope_entry_list_stack_iterator_t it;
+    for (it = entry_list_stack_iterator_begin(entry_list);
+            !entry_list_stack_iterator_end(&it);
+            entry_list_stack_iterator_next(&it))
     {
-        scope_entry_t* entry = entry_list_iterator_current(it);
+        scope_entry_t* entry = entry_list_stack_iterator_current(&it);
 
         int i;
         char found = 0;
@@ -644,7 +661,6 @@ scope_entry_list_t* filter_symbol_non_kind_set(scope_entry_list_t* entry_list, i
             result = entry_list_add(result, entry);
         }
     }
-    entry_list_iterator_free(it);
 
     return result;
 }
@@ -662,19 +678,18 @@ scope_entry_list_t* filter_symbol_using_predicate(scope_entry_list_t* entry_list
 {
     scope_entry_list_t* result = NULL;
 
-    scope_entry_list_iterator_t* it = NULL;
-    for (it = entry_list_iterator_begin(entry_list);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
+    scope_entry_list_stack_iterator_t it;
+    for (it = entry_list_stack_iterator_begin(entry_list);
+            !entry_list_stack_iterator_end(&it);
+            entry_list_stack_iterator_next(&it))
     {
-        scope_entry_t* entry = entry_list_iterator_current(it);
+        scope_entry_t* entry = entry_list_stack_iterator_current(&it);
 
         if (f(entry, p))
         {
             result = entry_list_add(result, entry);
         }
     }
-    entry_list_iterator_free(it);
 
     return result;
 }
@@ -1087,6 +1102,8 @@ struct class_scope_lookup_tag
     char is_virtual[MCXX_MAX_SCOPES_NESTING];
 
     scope_entry_list_t* entry_list;
+    // Set when the name is found in several subobjects
+    char is_ambiguous;
 } class_scope_lookup_t;
 
 static char can_be_inherited(scope_entry_t* entry, void* p UNUSED_PARAMETER)
@@ -1156,6 +1173,13 @@ static char same_type_conversion(scope_entry_t* entry, void *p)
     }
 }
 
+// Names of the members that finish_class_type may declare implicitly
+static char is_name_of_implicit_member(const char* name)
+{
+    return (strncmp(name, "constructor ", strlen("constructor ")) == 0)
+        || (name[0] == '~')
+        || (strcmp(name, STR_OPERATOR_ASSIGNMENT) == 0);
+}
 
 void class_scope_lookup_rec(scope_t* current_class_scope, const char* name, 
         class_scope_lookup_t* derived,
@@ -1180,6 +1204,10 @@ void class_scope_lookup_rec(scope_t* current_class_scope, const char* name,
     derived->path[derived->path_length - 1] = current_class_type;
     derived->is_virtual[derived->path_length - 1] = is_virtual;
 
+    if (is_class_type(current_class_type)
+            && is_name_of_implicit_member(name))
+        class_type_declare_pending_implicit_members(current_class_type);
+
     scope_entry_list_t* entry_list = query_name_in_scope(current_class_scope, name);
 
     if (!initial_lookup)
@@ -1455,12 +1483,12 @@ void class_scope_lookup_rec(scope_t* current_class_scope, const char* name,
                 {
                     if (several_subobjects)
                     {
-                        scope_entry_list_iterator_t* it = NULL; 
-                        for (it = entry_list_iterator_begin(derived->entry_list);
-                                !entry_list_iterator_end(it);
-                                entry_list_iterator_next(it))
+                        scope_entry_list_stack_iterator_t it; 
+                        for (it = entry_list_stack_iterator_begin(derived->entry_list);
+                                !entry_list_stack_iterator_end(&it);
+                                entry_list_stack_iterator_next(&it))
                         {
-                            scope_entry_t* entry = entry_list_iterator_current(it);
+                            scope_entry_t* entry = entry_list_stack_iterator_current(&it);
                             if (entry->kind == SK_VARIABLE
                                     || entry->kind == SK_FUNCTION
                                     /* || entry->kind == SK_TEMPLATE_FUNCTION */)
@@ -1486,7 +1514,6 @@ void class_scope_lookup_rec(scope_t* current_class_scope, const char* name,
                                 }
                             }
                         }
-                        entry_list_iterator_free(it);
                     }
                 }
 
@@ -1494,6 +1521,7 @@ void class_scope_lookup_rec(scope_t* current_class_scope, const char* name,
                 {
                     entry_list_free(derived->entry_list);
                     derived->entry_list = NULL;
+                    derived->is_ambiguous = 1;
                 }
             }
         }
@@ -1648,6 +1676,196 @@ type_t* build_dependent_typename_for_entry(
     return result;
 }
 
+/*
+ * Cache of class scope lookups
+ *
+ * Lookups in complete classes are remembered per class and name. Every class
+ * keeps a generation that increases when its scope or its bases change. Since
+ * the result of a lookup depends on the scopes of all the (possibly indirect)
+ * bases, the cache of a class remembers the generation of each of them and is
+ * discarded if any has changed. Changes to incomplete classes cannot affect
+ * the lookups in complete ones so they are ignored
+ */
+typedef
+struct class_scope_lookup_cache_entry_tag
+{
+    scope_entry_list_t* entry_list;
+    char is_ambiguous;
+} class_scope_lookup_cache_entry_t;
+
+typedef
+struct class_scope_lookup_dependence_tag
+{
+    type_t* class_type;
+    int* current_generation;
+    int generation;
+} class_scope_lookup_dependence_t;
+
+typedef
+struct class_scope_lookup_cache_tag
+{
+    // The class itself and all its bases
+    int num_dependences;
+    class_scope_lookup_dependence_t* dependences;
+    // name -> class_scope_lookup_cache_entry_t*
+    dhash_ptr_t* names;
+} class_scope_lookup_cache_t;
+
+// class scope -> class_scope_lookup_cache_t*
+static dhash_ptr_t* _class_scope_lookup_cache = NULL;
+// actual class type -> int*
+static dhash_ptr_t* _class_scope_lookup_generations = NULL;
+
+static int _class_scope_lookup_num_hits = 0;
+static int _class_scope_lookup_num_misses = 0;
+static int _class_scope_lookup_num_invalidations = 0;
+
+static char class_scope_is_complete(scope_t* sc)
+{
+    return sc->related_entry != NULL
+        && sc->related_entry->type_information != NULL
+        && is_class_type(sc->related_entry->type_information)
+        && is_complete_type(sc->related_entry->type_information);
+}
+
+static int* class_scope_lookup_generation(type_t* class_type)
+{
+    class_type = get_actual_class_type(class_type);
+
+    if (_class_scope_lookup_generations == NULL)
+    {
+        _class_scope_lookup_generations = dhash_ptr_new(5);
+    }
+
+    int* generation = (int*)dhash_ptr_query(_class_scope_lookup_generations,
+            (const char*)class_type);
+    if (generation == NULL)
+    {
+        generation = NEW0(int);
+        dhash_ptr_insert(_class_scope_lookup_generations,
+                (const char*)class_type, generation);
+    }
+
+    return generation;
+}
+
+void class_scope_lookup_cache_class_changed(type_t* class_type)
+{
+    if (_class_scope_lookup_cache == NULL
+            || !is_complete_type(class_type))
+        return;
+
+    (*class_scope_lookup_generation(class_type))++;
+    _class_scope_lookup_num_invalidations++;
+}
+
+static void class_scope_lookup_cache_invalidate(scope_t* sc)
+{
+    if (sc->kind != CLASS_SCOPE
+            || sc->related_entry == NULL
+            || sc->related_entry->type_information == NULL
+            || !is_class_type(sc->related_entry->type_information))
+        return;
+
+    class_scope_lookup_cache_class_changed(sc->related_entry->type_information);
+}
+
+static void free_class_scope_lookup_cache_entry(const char* key UNUSED_PARAMETER,
+        void* info,
+        void* walk_info UNUSED_PARAMETER)
+{
+    class_scope_lookup_cache_entry_t* entry = (class_scope_lookup_cache_entry_t*)info;
+    entry_list_free(entry->entry_list);
+    DELETE(entry);
+}
+
+static void class_scope_lookup_cache_add_dependence(class_scope_lookup_cache_t* cache,
+        type_t* class_type)
+{
+    class_type = get_actual_class_type(class_type);
+
+    int i;
+    for (i = 0; i < cache->num_dependences; i++)
+    {
+        if (cache->dependences[i].class_type == class_type)
+            return;
+    }
+
+    class_scope_lookup_dependence_t dependence;
+    dependence.class_type = class_type;
+    dependence.current_generation = class_scope_lookup_generation(class_type);
+    dependence.generation = *dependence.current_generation;
+    P_LIST_ADD(cache->dependences, cache->num_dependences, dependence);
+
+    for (i = 0; i < class_type_get_num_bases(class_type); i++)
+    {
+        char is_dependent = 0;
+        scope_entry_t* base_symbol = class_type_get_base_num(class_type, i,
+                /* is_virtual */ NULL,
+                &is_dependent,
+                /* is_expansion */ NULL,
+                /* access_specifier */ NULL);
+        if (is_dependent
+                || base_symbol->type_information == NULL
+                || !is_class_type(base_symbol->type_information))
+            continue;
+
+        class_scope_lookup_cache_add_dependence(cache, base_symbol->type_information);
+    }
+}
+
+static char class_scope_lookup_cache_is_stale(class_scope_lookup_cache_t* cache)
+{
+    int i;
+    for (i = 0; i < cache->num_dependences; i++)
+    {
+        if (*cache->dependences[i].current_generation != cache->dependences[i].generation)
+            return 1;
+    }
+    return 0;
+}
+
+static class_scope_lookup_cache_t* class_scope_lookup_cache_get(scope_t* sc)
+{
+    if (_class_scope_lookup_cache == NULL)
+    {
+        _class_scope_lookup_cache = dhash_ptr_new(5);
+    }
+
+    class_scope_lookup_cache_t* cache = (class_scope_lookup_cache_t*)dhash_ptr_query(
+            _class_scope_lookup_cache, (const char*)sc);
+
+    if (cache == NULL)
+    {
+        cache = NEW0(class_scope_lookup_cache_t);
+        cache->names = dhash_ptr_new(5);
+        class_scope_lookup_cache_add_dependence(cache, sc->related_entry->type_information);
+
+        dhash_ptr_insert(_class_scope_lookup_cache, (const char*)sc, cache);
+    }
+    else if (class_scope_lookup_cache_is_stale(cache))
+    {
+        // Stale, start over as the bases may have changed too
+        dhash_ptr_walk(cache->names, free_class_scope_lookup_cache_entry, NULL);
+        dhash_ptr_destroy(cache->names);
+        DELETE(cache->dependences);
+
+        cache->num_dependences = 0;
+        cache->dependences = NULL;
+        cache->names = dhash_ptr_new(5);
+        class_scope_lookup_cache_add_dependence(cache, sc->related_entry->type_information);
+    }
+
+    return cache;
+}
+
+void class_scope_lookup_get_stats(int* num_hits, int* num_misses, int* num_invalidations)
+{
+    *num_hits = _class_scope_lookup_num_hits;
+    *num_misses = _class_scope_lookup_num_misses;
+    *num_invalidations = _class_scope_lookup_num_invalidations;
+}
+
 static scope_entry_list_t* query_in_class(scope_t* current_class_scope, 
         const char* name,
         field_path_t* field_path UNUSED_PARAMETER,
@@ -1658,8 +1876,46 @@ static scope_entry_list_t* query_in_class(scope_t* current_class_scope,
     class_scope_lookup_t result;
     memset(&result, 0, sizeof(result));
 
+    // Lookups of conversions are not cached as they depend on the type
+    char use_cache = (type_of_conversion == NULL
+            && class_scope_is_complete(current_class_scope));
+
+    if (use_cache)
+    {
+        class_scope_lookup_cache_t* cache = class_scope_lookup_cache_get(current_class_scope);
+        class_scope_lookup_cache_entry_t* cached = (class_scope_lookup_cache_entry_t*)dhash_ptr_query(
+                cache->names, name);
+
+        if (cached != NULL)
+        {
+            DEBUG_CODE()
+            {
+                fprintf(stderr, "SCOPE: Class scope lookup of '%s' in class '%s' found in the cache%s\n",
+                        name,
+                        current_class_scope->related_entry->symbol_name,
+                        cached->is_ambiguous ? " (ambiguous)" : "");
+            }
+            _class_scope_lookup_num_hits++;
+            return entry_list_copy(cached->entry_list);
+        }
+        _class_scope_lookup_num_misses++;
+    }
+
     class_scope_lookup_rec(current_class_scope, name, &result, 0, /* initial_lookup */ 1, decl_flags, type_of_conversion, locus);
 
+    if (use_cache)
+    {
+        // Get the cache again as the lookup may have declared implicit
+        // members and invalidated the former one
+        class_scope_lookup_cache_t* cache = class_scope_lookup_cache_get(current_class_scope);
+
+        class_scope_lookup_cache_entry_t* cached = NEW0(class_scope_lookup_cache_entry_t);
+        cached->entry_list = entry_list_copy(result.entry_list);
+        cached->is_ambiguous = result.is_ambiguous;
+
+        dhash_ptr_insert(cache->names, name, cached);
+    }
+
     if (result.entry_list != NULL)
     {
         int i;
@@ -1708,12 +1964,12 @@ static void error_ambiguity(scope_entry_list_t* entry_list, const locus_t* locus
 
     uniquestr_sprintf(&candidates, "%s: info: candidates are\n", locus_to_str(locus));
 
-    scope_entry_list_iterator_t* it = NULL;
-    for (it = entry_list_iterator_begin(entry_list);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
+    scope_entry_list_stack_iterator_t it;
+    for (it = entry_list_stack_iterator_begin(entry_list);
+            !entry_list_stack_iterator_end(&it);
+            entry_list_stack_iterator_next(&it))
     {
-        scope_entry_t* entry = entry_list_iterator_current(it);
+        scope_entry_t* entry = entry_list_stack_iterator_current(&it);
 
         const char *single_candidate;
         uniquestr_sprintf(&single_candidate, "%s: info:    %s\n", 
@@ -1722,7 +1978,6 @@ static void error_ambiguity(scope_entry_list_t* entry_list, const locus_t* locus
 
         candidates = strappend(candidates, single_candidate);
     }
-    entry_list_iterator_free(it);
 
     error_printf_at(locus, "ambiguity in reference to '%s'\n%s", entry_list_head(entry_list)->symbol_name, candidates);
 }
@@ -1735,12 +1990,12 @@ static char check_for_naming_ambiguity(scope_entry_list_t* entry_list, const loc
 
     scope_entry_t* hiding_name = NULL;
 
-    scope_entry_list_iterator_t* it = NULL;
-    for (it = entry_list_iterator_begin(entry_list);
-            !entry_list_iterator_end(it);
-            entry_list_iterator_next(it))
+    scope_entry_list_stack_iterator_t it;
+    for (it = entry_list_stack_iterator_begin(entry_list);
+            !entry_list_stack_iterator_end(&it);
+            entry_list_stack_iterator_next(&it))
     {
-        scope_entry_t* entry = entry_advance_aliases(entry_list_iterator_current(it));
+        scope_entry_t* entry = entry_advance_aliases(entry_list_stack_iterator_current(&it));
 
         if (hiding_name == NULL
                 && (entry->kind == SK_VARIABLE
@@ -1781,11 +2036,9 @@ static char check_for_naming_ambiguity(scope_entry_list_t* entry_list, const loc
         else
         {
             error_ambiguity(entry_list, locus);
-            entry_list_iterator_free(it);
             return 0;
         }
     }
-    entry_list_iterator_free(it);
 
     return 1;
 }
@@ -1800,12 +2053,12 @@ static scope_entry_list_t* entry_list_merge_aliases(scope_entry_list_t* list1, s
     int i;
     for (i = 0; i < 2; i++)
     {
-        scope_entry_list_iterator_t* it = NULL;
-        for (it = entry_list_iterator_begin(lists[i]);
-                !entry_list_iterator_end(it);
-                entry_list_iterator_next(it))
+        scope_entry_list_stack_iterator_t it;
+        for (it = entry_list_stack_iterator_begin(lists[i]);
+                !entry_list_stack_iterator_end(&it);
+                entry_list_stack_iterator_next(&it))
         {
-            scope_entry_t* current_entry = entry_list_iterator_current(it);
+            scope_entry_t* current_entry = entry_list_stack_iterator_current(&it);
             scope_entry_t* real_sym = entry_advance_aliases(current_entry);
 
             if (!entry_list_contains(real_list, real_sym))
@@ -1814,7 +2067,6 @@ static scope_entry_list_t* entry_list_merge_aliases(scope_entry_list_t* list1, s
             }
             real_list = entry_list_add_once(real_list, real_sym);
         }
-        entry_list_iterator_free(it);
     }
 
     entry_list_free(real_list);
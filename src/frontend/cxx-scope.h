@@ -62,6 +62,11 @@ LIBMCXX_EXTERN void remove_entry(struct scope_tag* st, scope_entry_t* entry);
 LIBMCXX_EXTERN void insert_entry(struct scope_tag* st, scope_entry_t* entry);
 LIBMCXX_EXTERN void insert_alias(struct scope_tag* st, scope_entry_t* entry, const char* alias_name);
 
+// Lookups in complete classes are cached. Call this when the bases or the
+// inner context of a class change
+LIBMCXX_EXTERN void class_scope_lookup_cache_class_changed(type_t* class_type);
+LIBMCXX_EXTERN void class_scope_lookup_get_stats(int* num_hits, int* num_misses, int* num_invalidations);
+
 // Given a list of symbols, purge all those that are not of symbol_kind kind
 LIBMCXX_EXTERN scope_entry_list_t* filter_symbol_kind(scope_entry_list_t* entry_list, enum cxx_symbol_kind symbol_kind);
 // Similar but can be used to filter based on a kind set
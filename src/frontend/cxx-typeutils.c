@@ -29,6 +29,7 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
 #include "cxx-buildscope.h"
 #include "cxx-typeutils.h"
 #include "cxx-typeenviron.h"
@@ -179,6 +180,15 @@ struct virtual_base_class_info_tag
     _size_t virtual_base_offset;
 } virtual_base_class_info_t;
 
+// Implicit special members of a class are declared lazily using this
+typedef
+struct pending_implicit_members_tag
+{
+    type_t* type_info;
+    const decl_context_t* decl_context;
+    const locus_t* locus;
+} pending_implicit_members_t;
+
 // Information of a class
 typedef 
 struct class_info_tag {
@@ -231,6 +241,9 @@ struct class_info_tag {
     // Inherited constructors
     scope_entry_list_t* inherited_constructors;
 
+    // Implicit special members not declared yet (--lazy-implicit-members)
+    struct pending_implicit_members_tag* pending_implicit_members;
+
     // Info for laying out 
     _size_t non_virtual_size;
     _size_t non_virtual_align;
@@ -312,9 +325,14 @@ struct simple_type_tag {
     scope_entry_t* related_template_symbol;
 
     // Specialized types
-    //   Unique specialized types
+    //   Unique specialized types (in creation order)
     int num_unique_specialized_types;
     type_t** unique_specialized_types;
+    //   Hash of the template arguments of each unique specialized type and
+    //   an open addressing index (position + 1, 0 means empty) on it
+    unsigned int* unique_specialized_types_hash;
+    int unique_specialized_types_index_size;
+    int* unique_specialized_types_index;
     //   All specialized types
     int num_all_specialized_types;
     type_t** all_specialized_types;
@@ -493,7 +511,11 @@ struct type_tag
     // cv-qualifier related to this type
     // The cv-qualifier is in the type
     // (all types)
-    cv_qualifier_t cv_qualifier;
+    cv_qualifier_t cv_qualifier:4;
+
+    // Structural hash of this type, see type_intern_query
+    // (all types)
+    unsigned int hash;
 
     // We use a pointer so we can safely copy in cv-qualified versions
     // (all types)
@@ -581,11 +603,211 @@ static common_type_info_t* copy_common_type_info(common_type_info_t* t)
     return result;
 }
 
+/* Hash-consing of derived types */
+
+// Derived types (qualified, pointers, references, arrays of known size, ...)
+// are hash-consed: there is only one type for a given type constructor and
+// operands. This table replaces the per-constructor caches that were used
+// before. The hash of a hash-consed type is computed from the hashes of its
+// operands while any other type gets a fresh hash when created
+typedef enum type_intern_kind_tag
+{
+    TIK_QUALIFIED = 0,
+    TIK_POINTER,
+    TIK_LVALUE_REFERENCE,
+    TIK_RVALUE_REFERENCE,
+    TIK_REBINDABLE_REFERENCE,
+    TIK_POINTER_TO_MEMBER,
+    TIK_SIZED_ARRAY,
+    TIK_UNDEFINED_ARRAY,
+    TIK_VECTOR,
+    TIK_MASK,
+    TIK_COMPLEX,
+    TIK_PACK,
+    TIK_ZERO_VARIANT,
+    TIK_INTEROPERABLE_VARIANT,
+    TIK_ATOMIC_VARIANT,
+    TIK_NUM_KINDS
+} type_intern_kind_t;
+
+static const char* type_intern_kind_name[TIK_NUM_KINDS] =
+{
+    [TIK_QUALIFIED] = "qualified types",
+    [TIK_POINTER] = "pointer types",
+    [TIK_LVALUE_REFERENCE] = "lvalue reference types",
+    [TIK_RVALUE_REFERENCE] = "rvalue reference types",
+    [TIK_REBINDABLE_REFERENCE] = "rebindable reference types",
+    [TIK_POINTER_TO_MEMBER] = "pointer to member types",
+    [TIK_SIZED_ARRAY] = "array types of constant size",
+    [TIK_UNDEFINED_ARRAY] = "array types of unknown size",
+    [TIK_VECTOR] = "vector types",
+    [TIK_MASK] = "mask types",
+    [TIK_COMPLEX] = "complex types",
+    [TIK_PACK] = "pack types",
+    [TIK_ZERO_VARIANT] = "zero variant types",
+    [TIK_INTEROPERABLE_VARIANT] = "interoperable variant types",
+    [TIK_ATOMIC_VARIANT] = "atomic variant types",
+};
+
+#define TYPE_INTERN_MAX_OPERANDS 5
+
+typedef struct type_intern_key_tag
+{
+    type_intern_kind_t kind;
+    int num_operands;
+    uintptr_t operands[TYPE_INTERN_MAX_OPERANDS];
+    unsigned int hash;
+} type_intern_key_t;
+
+typedef struct type_intern_entry_tag
+{
+    type_intern_key_t key;
+    type_t* type;
+} type_intern_entry_t;
+
+static type_intern_entry_t* _type_intern_table = NULL;
+static unsigned int _type_intern_table_size = 0;
+static unsigned int _type_intern_table_used = 0;
+
+static int _type_intern_num_lookups[TIK_NUM_KINDS];
+static int _type_intern_num_hits[TIK_NUM_KINDS];
+
+static inline unsigned int type_hash_combine(unsigned int h, uint64_t v)
+{
+    // Finalizer of MurmurHash3
+    v ^= v >> 33;
+    v *= 0xff51afd7ed558ccdULL;
+    v ^= v >> 33;
+    v *= 0xc4ceb9fe1a85ec53ULL;
+    v ^= v >> 33;
+
+    return (h * 31) ^ (unsigned int)v ^ (unsigned int)(v >> 32);
+}
+
+static unsigned int new_type_hash(void)
+{
+    static uint64_t _num_types = 0;
+    return type_hash_combine(TIK_NUM_KINDS, ++_num_types);
+}
+
+static void type_intern_key_init(type_intern_key_t* key, type_intern_kind_t kind)
+{
+    key->kind = kind;
+    key->num_operands = 0;
+    key->hash = type_hash_combine(0, kind);
+}
+
+static void type_intern_key_add_type(type_intern_key_t* key, type_t* t)
+{
+    ERROR_CONDITION(key->num_operands == TYPE_INTERN_MAX_OPERANDS, "Too many operands", 0);
+    key->operands[key->num_operands] = (uintptr_t)t;
+    key->num_operands++;
+    key->hash = type_hash_combine(key->hash, (t != NULL) ? t->hash : 0);
+}
+
+static void type_intern_key_add_value(type_intern_key_t* key, uint64_t value)
+{
+    ERROR_CONDITION(key->num_operands == TYPE_INTERN_MAX_OPERANDS, "Too many operands", 0);
+    key->operands[key->num_operands] = (uintptr_t)value;
+    key->num_operands++;
+    key->hash = type_hash_combine(key->hash, value);
+}
+
+static char type_intern_key_equal(const type_intern_key_t* k1, const type_intern_key_t* k2)
+{
+    return k1->hash == k2->hash
+        && k1->kind == k2->kind
+        && k1->num_operands == k2->num_operands
+        && memcmp(k1->operands, k2->operands, k1->num_operands * sizeof(*k1->operands)) == 0;
+}
+
+static type_intern_entry_t* type_intern_find_slot(type_intern_entry_t* table,
+        unsigned int table_size,
+        const type_intern_key_t* key)
+{
+    // table_size is always a power of two
+    unsigned int i = key->hash & (table_size - 1);
+    while (table[i].type != NULL
+            && !type_intern_key_equal(&table[i].key, key))
+    {
+        i = (i + 1) & (table_size - 1);
+    }
+
+    return &table[i];
+}
+
+// Returns the type for the given key or NULL if it has not been interned yet
+static type_t* type_intern_query(const type_intern_key_t* key)
+{
+    _type_intern_num_lookups[key->kind]++;
+
+    if (_type_intern_table == NULL)
+        return NULL;
+
+    type_t* result = type_intern_find_slot(_type_intern_table, _type_intern_table_size, key)->type;
+    if (result != NULL)
+        _type_intern_num_hits[key->kind]++;
+
+    return result;
+}
+
+// Registers t as the type for the given key and sets its hash. Types that are
+// not inserted here keep the fresh hash they got when created
+static void type_intern_insert(const type_intern_key_t* key, type_t* t)
+{
+    // Keep load factor below 1/2
+    if (2 * (_type_intern_table_used + 1) > _type_intern_table_size)
+    {
+        unsigned int new_size = (_type_intern_table_size == 0) ? 1024 : 2 * _type_intern_table_size;
+        type_intern_entry_t* new_table = NEW_VEC0(type_intern_entry_t, new_size);
+
+        unsigned int i;
+        for (i = 0; i < _type_intern_table_size; i++)
+        {
+            if (_type_intern_table[i].type == NULL)
+                continue;
+
+            *type_intern_find_slot(new_table, new_size, &_type_intern_table[i].key) = _type_intern_table[i];
+        }
+
+        DELETE(_type_intern_table);
+        _type_intern_table = new_table;
+        _type_intern_table_size = new_size;
+    }
+
+    type_intern_entry_t* slot = type_intern_find_slot(_type_intern_table, _type_intern_table_size, key);
+    ERROR_CONDITION(slot->type != NULL, "Type already interned", 0);
+
+    slot->key = *key;
+    slot->type = t;
+    _type_intern_table_used++;
+
+    t->hash = key->hash;
+}
+
+int type_intern_get_num_kinds(void)
+{
+    return TIK_NUM_KINDS;
+}
+
+void type_intern_get_stats(int kind,
+        const char** name,
+        int* num_lookups,
+        int* num_hits)
+{
+    ERROR_CONDITION(kind < 0 || kind >= TIK_NUM_KINDS, "Invalid kind %d", kind);
+
+    *name = type_intern_kind_name[kind];
+    *num_lookups = _type_intern_num_lookups[kind];
+    *num_hits = _type_intern_num_hits[kind];
+}
+
 static type_t* copy_type_for_class_alias(type_t* t)
 {
     type_t* result = NEW0(type_t);
     *result = *t;
 
+    result->hash = new_type_hash();
     result->_advanced_type = NULL;
 
     result->info = copy_common_type_info(t->info);
@@ -601,6 +823,7 @@ static type_t* copy_type_for_variant(type_t* t)
     type_t* result = NEW0(type_t);
     *result = *t;
 
+    result->hash = new_type_hash();
     result->unqualified_type = result;
 
     result->_advanced_type = NULL;
@@ -626,6 +849,7 @@ extern inline type_t* variant_type_get_nonvariant(type_t* t)
 static type_t* new_empty_type_without_info(void)
 {
     type_t* result = NEW0(type_t);
+    result->hash = new_type_hash();
     return result;
 }
 
@@ -1343,18 +1567,6 @@ extern inline type_t* gxx_underlying_type_get_underlying_type(type_t* t)
 
 static void null_dtor(const void* v UNUSED_PARAMETER) { }
 
-static void* rb_tree_query_uint(rb_red_blk_tree* tree, unsigned int u)
-{
-    type_t* result = NULL;
-    rb_red_blk_node* n = rb_tree_query(tree, &u);
-    if (n != NULL)
-    {
-        result = rb_node_get_info(n);
-    }
-
-    return result;
-}
-
 static int intptr_t_comp(const void *v1, const void *v2)
 {
     intptr_t p1 = (intptr_t)(v1);
@@ -1368,19 +1580,6 @@ static int intptr_t_comp(const void *v1, const void *v2)
         return 0;
 }
 
-static int uint_comp(const void *v1, const void *v2)
-{
-    unsigned int p1 = *(unsigned int*)(v1);
-    unsigned int p2 = *(unsigned int*)(v2);
-
-    if (p1 < p2)
-        return -1;
-    else if (p1 > p2)
-        return 1;
-    else
-        return 0;
-}
-
 static inline type_t* get_indirect_type_(scope_entry_t* entry, char indirect)
 {
     type_t* type_info = entry->_indirect_type[!!indirect];
@@ -3279,19 +3478,293 @@ static int compare_equivalent_template_argument_list(
     return 0;
 }
 
-static int compare_equivalent_template_argument_list_of_named_template_specialized_types(
-        const void* v1,
-        const void* v2)
+// Structural hash of template arguments. Arguments that are equivalent (see
+// compare_equivalent_template_argument_list) have the same hash, so it only
+// looks at the parts that template_arg_value_type_equivalent_compare and
+// template_arg_value_expr_equivalent_compare compare exactly
+static unsigned int template_arg_hash_mix(unsigned int hash, uintptr_t value)
 {
-    type_t* t1 = *(type_t**)v1;
-    type_t* t2 = *(type_t**)v2;
+    unsigned int v = (unsigned int)value;
+#if UINTPTR_MAX > 0xffffffffU
+    v ^= (unsigned int)(value >> 32);
+#endif
+    return (hash ^ v) * 0x01000193U;
+}
 
-    t1 = named_type_get_symbol(t1)->type_information;
-    t2 = named_type_get_symbol(t2)->type_information;
+static unsigned int template_argument_list_equivalent_hash(
+        template_parameter_list_t* template_parameter_list);
 
-    return compare_equivalent_template_argument_list(
-            template_specialized_type_get_template_arguments(t1),
-            template_specialized_type_get_template_arguments(t2));
+static unsigned int template_arg_value_expr_equivalent_hash(nodecl_t n)
+{
+    if (nodecl_is_null(n))
+        return 0;
+
+    unsigned int hash = 1;
+    const_value_t* v = nodecl_get_constant(n);
+    hash = template_arg_hash_mix(hash, v != NULL);
+
+    if (v != NULL
+            && !const_value_is_address_or_object(v))
+    {
+        // Constants are compared by value, regardless of their type.
+        // Integers use their 64-bit pattern, so a signed -1 and an unsigned
+        // all-ones value, which compare equal, hash the same
+        if (const_value_is_integer(v))
+        {
+            uint64_t u = const_value_cast_to_8(v);
+            hash = template_arg_hash_mix(hash, (unsigned int)u);
+            hash = template_arg_hash_mix(hash, (unsigned int)(u >> 32));
+        }
+        else if (const_value_is_floating(v))
+        {
+            // Only use the value when it is an integer exactly
+            // representable in a double
+            const int64_t max_exact = (int64_t)1 << 53;
+            double d = const_value_cast_to_double(v);
+            if (-(double)max_exact <= d && d <= (double)max_exact
+                    && d == (double)(int64_t)d)
+            {
+                uint64_t u = (uint64_t)(int64_t)d;
+                hash = template_arg_hash_mix(hash, (unsigned int)u);
+                hash = template_arg_hash_mix(hash, (unsigned int)(u >> 32));
+            }
+        }
+    }
+    else if (nodecl_get_symbol(n) != NULL)
+    {
+        scope_entry_t* sym = nodecl_get_symbol(n);
+        hash = template_arg_hash_mix(hash, sym->kind);
+        if (sym->kind == SK_TEMPLATE_NONTYPE_PARAMETER)
+        {
+            hash = template_arg_hash_mix(hash, symbol_entity_specs_get_template_parameter_nesting(sym));
+            hash = template_arg_hash_mix(hash, symbol_entity_specs_get_template_parameter_position(sym));
+        }
+    }
+    else
+    {
+        hash = template_arg_hash_mix(hash, nodecl_get_kind(n));
+    }
+
+    return hash;
+}
+
+static unsigned int template_arg_value_type_equivalent_hash(type_t* t)
+{
+    if (t == NULL)
+        return 0;
+
+    cv_qualifier_t cv_qualifier = CV_NONE;
+    t = advance_over_typedefs_with_cv_qualif(t, &cv_qualifier);
+
+    unsigned int hash = template_arg_hash_mix(1, cv_qualifier);
+    hash = template_arg_hash_mix(hash, t->kind);
+
+    switch (t->kind)
+    {
+        case TK_DIRECT :
+            {
+                hash = template_arg_hash_mix(hash, t->type->kind);
+                switch (t->type->kind)
+                {
+                    case STK_BUILTIN_TYPE :
+                        {
+                            hash = template_arg_hash_mix(hash, t->type->builtin_type);
+                            hash = template_arg_hash_mix(hash, t->type->is_signed);
+                            hash = template_arg_hash_mix(hash, t->type->is_unsigned);
+                            hash = template_arg_hash_mix(hash, t->type->is_long);
+                            hash = template_arg_hash_mix(hash, t->type->is_short);
+                            break;
+                        }
+                    case STK_CLASS :
+                        {
+                            if (t->info->is_template_specialized_type)
+                            {
+                                scope_entry_t* sym = template_type_get_related_symbol(t->related_template_type);
+                                hash = template_arg_hash_mix(hash, sym->kind);
+                                if (sym->kind == SK_TEMPLATE_TEMPLATE_PARAMETER
+                                        || sym->kind == SK_TEMPLATE_TEMPLATE_PARAMETER_PACK)
+                                {
+                                    hash = template_arg_hash_mix(hash,
+                                            symbol_entity_specs_get_template_parameter_nesting(sym));
+                                    hash = template_arg_hash_mix(hash,
+                                            symbol_entity_specs_get_template_parameter_position(sym));
+                                    hash = template_arg_hash_mix(hash,
+                                            template_argument_list_equivalent_hash(
+                                                template_specialized_type_get_template_arguments(t)));
+                                    break;
+                                }
+                            }
+                            hash = template_arg_hash_mix(hash, (uintptr_t)t->type);
+                            break;
+                        }
+                    case STK_ENUM :
+                    case STK_TEMPLATE_TYPE :
+                        {
+                            hash = template_arg_hash_mix(hash, (uintptr_t)t->type);
+                            break;
+                        }
+                    case STK_UNDERLYING:
+                        {
+                            hash = template_arg_hash_mix(hash,
+                                    template_arg_value_type_equivalent_hash(t->type->underlying_type));
+                            break;
+                        }
+                    case STK_COMPLEX:
+                        {
+                            hash = template_arg_hash_mix(hash,
+                                    template_arg_value_type_equivalent_hash(t->type->complex_element));
+                            break;
+                        }
+                    case STK_VECTOR:
+                        {
+                            hash = template_arg_hash_mix(hash,
+                                    template_arg_value_type_equivalent_hash(t->type->vector_element));
+                            hash = template_arg_hash_mix(hash, t->type->vector_size);
+                            break;
+                        }
+                    case STK_MASK:
+                        {
+                            hash = template_arg_hash_mix(hash, t->type->vector_size);
+                            break;
+                        }
+                    default:
+                        {
+                            // Dependent types are only hashed by their kind
+                            break;
+                        }
+                }
+                break;
+            }
+        case TK_POINTER :
+        case TK_LVALUE_REFERENCE :
+        case TK_RVALUE_REFERENCE :
+        case TK_REBINDABLE_REFERENCE :
+            {
+                hash = template_arg_hash_mix(hash,
+                        template_arg_value_type_equivalent_hash(t->pointer->pointee));
+                break;
+            }
+        case TK_POINTER_TO_MEMBER :
+            {
+                hash = template_arg_hash_mix(hash,
+                        template_arg_value_type_equivalent_hash(t->pointer->pointee_class_type));
+                hash = template_arg_hash_mix(hash,
+                        template_arg_value_type_equivalent_hash(t->pointer->pointee));
+                break;
+            }
+        case TK_ARRAY :
+            {
+                hash = template_arg_hash_mix(hash,
+                        template_arg_value_type_equivalent_hash(t->array->element_type));
+                hash = template_arg_hash_mix(hash,
+                        template_arg_value_expr_equivalent_hash(t->array->whole_size));
+                break;
+            }
+        case TK_FUNCTION :
+            {
+                hash = template_arg_hash_mix(hash,
+                        template_arg_value_type_equivalent_hash(t->function->return_type));
+                hash = template_arg_hash_mix(hash, t->function->num_parameters);
+
+                int i;
+                for (i = 0; i < t->function->num_parameters; i++)
+                {
+                    hash = template_arg_hash_mix(hash, t->function->parameter_list[i]->is_ellipsis);
+                    hash = template_arg_hash_mix(hash,
+                            template_arg_value_type_equivalent_hash(t->function->parameter_list[i]->type_info));
+                }
+                hash = template_arg_hash_mix(hash, t->function->ref_qualifier);
+                break;
+            }
+        case TK_PACK:
+            {
+                hash = template_arg_hash_mix(hash,
+                        template_arg_value_type_equivalent_hash(t->pack_type->packed));
+                break;
+            }
+        case TK_SEQUENCE:
+            {
+                hash = template_arg_hash_mix(hash, t->sequence_type->num_types);
+
+                int i;
+                for (i = 0; i < t->sequence_type->num_types; i++)
+                {
+                    hash = template_arg_hash_mix(hash,
+                            template_arg_value_type_equivalent_hash(t->sequence_type->types[i]));
+                }
+                break;
+            }
+        default :
+            internal_error("Unexpected type kind (%d)\n", t->kind);
+    }
+
+    return hash;
+}
+
+static unsigned int template_argument_list_equivalent_hash(
+        template_parameter_list_t* template_parameter_list)
+{
+    unsigned int hash = template_arg_hash_mix(1, template_parameter_list->num_parameters);
+
+    int i;
+    for (i = 0; i < template_parameter_list->num_parameters; i++)
+    {
+        template_parameter_value_t* targ = template_parameter_list->arguments[i];
+
+        hash = template_arg_hash_mix(hash, targ->kind);
+        hash = template_arg_hash_mix(hash, template_arg_value_type_equivalent_hash(targ->type));
+        if (targ->kind == TPK_NONTYPE)
+        {
+            hash = template_arg_hash_mix(hash, template_arg_value_expr_equivalent_hash(targ->value));
+        }
+    }
+
+    return hash;
+}
+
+static void template_type_index_insert(type_t* t, int position)
+{
+    int mask = t->type->unique_specialized_types_index_size - 1;
+    int i = t->type->unique_specialized_types_hash[position] & mask;
+
+    while (t->type->unique_specialized_types_index[i] != 0)
+        i = (i + 1) & mask;
+
+    t->type->unique_specialized_types_index[i] = position + 1;
+}
+
+// Registers a new unique specialization of t whose template arguments hash
+// to hash
+static void template_type_add_unique_specialized_type(type_t* t,
+        type_t* specialization,
+        unsigned int hash)
+{
+    int num_items = t->type->num_unique_specialized_types;
+    P_LIST_ADD(t->type->unique_specialized_types,
+            t->type->num_unique_specialized_types,
+            specialization);
+    P_LIST_ADD(t->type->unique_specialized_types_hash,
+            num_items,
+            hash);
+
+    // Keep the load factor below 1/2
+    if (2 * t->type->num_unique_specialized_types > t->type->unique_specialized_types_index_size)
+    {
+        DELETE(t->type->unique_specialized_types_index);
+
+        t->type->unique_specialized_types_index_size =
+            (t->type->unique_specialized_types_index_size == 0) ? 8 : 2 * t->type->unique_specialized_types_index_size;
+        t->type->unique_specialized_types_index =
+            NEW_VEC0(int, t->type->unique_specialized_types_index_size);
+
+        int i;
+        for (i = 0; i < t->type->num_unique_specialized_types; i++)
+            template_type_index_insert(t, i);
+    }
+    else
+    {
+        template_type_index_insert(t, t->type->num_unique_specialized_types - 1);
+    }
 }
 
 static type_t* template_type_get_equivalent_specialized_type(type_t* t,
@@ -3318,49 +3791,43 @@ static type_t* template_type_get_equivalent_specialized_type(type_t* t,
 
     type_t* specialization = NULL;
 
-    int lower = 0;
-    int upper = t->type->num_unique_specialized_types - 1;
-
-    while (lower <= upper)
+    unsigned int hash = template_argument_list_equivalent_hash(template_parameters);
+    if (t->type->unique_specialized_types_index_size > 0)
     {
-        int middle = (lower + upper) / 2;
+        int mask = t->type->unique_specialized_types_index_size - 1;
+        int i = hash & mask;
 
-        type_t* current_specialization = t->type->unique_specialized_types[middle];
+        while (t->type->unique_specialized_types_index[i] != 0)
+        {
+            int position = t->type->unique_specialized_types_index[i] - 1;
+            if (t->type->unique_specialized_types_hash[position] == hash)
+            {
+                type_t* current_specialization = t->type->unique_specialized_types[position];
 
-        scope_entry_t* entry = named_type_get_symbol(current_specialization);
-        template_parameter_list_t* specialization_template_parameters =
-            template_specialized_type_get_template_arguments(entry->type_information);
+                scope_entry_t* entry = named_type_get_symbol(current_specialization);
+                template_parameter_list_t* specialization_template_parameters =
+                    template_specialized_type_get_template_arguments(entry->type_information);
 
-        DEBUG_CODE()
-        {
-            fprintf(stderr, "TYPEUTILS: Checking with specialization %p: #%d in [%d<=%d, %d<=%d] '%s' (%p) at '%s'\n",
-                    t->type,
-                    middle,
-                    0,
-                    lower,
-                    upper,
-                    t->type->num_unique_specialized_types - 1,
-                    print_type_str(current_specialization, entry->decl_context),
-                    entry->type_information,
-                    locus_to_str(entry->locus));
-        }
+                DEBUG_CODE()
+                {
+                    fprintf(stderr, "TYPEUTILS: Checking with specialization %p: #%d '%s' (%p) at '%s'\n",
+                            t->type,
+                            position,
+                            print_type_str(current_specialization, entry->decl_context),
+                            entry->type_information,
+                            locus_to_str(entry->locus));
+                }
 
-        int cmp = compare_equivalent_template_argument_list(
-                template_parameters,
-                specialization_template_parameters);
+                if (compare_equivalent_template_argument_list(
+                            template_parameters,
+                            specialization_template_parameters) == 0)
+                {
+                    specialization = current_specialization;
+                    break;
+                }
+            }
 
-        if (cmp == 0)
-        {
-            specialization = current_specialization;
-            break;
-        }
-        else if (cmp < 0)
-        {
-            upper = middle - 1;
-        }
-        else if (cmp > 0)
-        {
-            lower = middle + 1;
+            i = (i + 1) & mask;
         }
     }
 
@@ -3618,334 +4085,76 @@ static type_t* template_type_get_specialized_type_(
     specialized_symbol->kind = primary_symbol->kind;
     specialized_symbol->type_information = specialized_type;
 
-    // Fix the template arguments
-    decl_context_t* updated_decl_context = decl_context_clone(primary_symbol->decl_context);
-    updated_decl_context->template_parameters = template_arguments;
-    specialized_symbol->decl_context = updated_decl_context;
-
-    specialized_symbol->locus = locus;
-
-    // Keep information of the entity except for some attributes that
-    // must be cleared
-    symbol_entity_specs_copy_from(specialized_symbol, primary_symbol);
-    symbol_entity_specs_set_is_user_declared(specialized_symbol, 0);
-    symbol_entity_specs_set_is_instantiable(specialized_symbol, 0);
-
-    // Let this be filled later
-    symbol_entity_specs_free_related_symbols(specialized_symbol);
-
-    if (equivalent_match != NULL)
-    {
-        symbol_entity_specs_set_alias_to(specialized_symbol, named_type_get_symbol(equivalent_match));
-    }
-
-    // Copy function extra info
-    if (specialized_symbol->kind == SK_FUNCTION)
-    {
-        // Empty default argument info for the specialization
-        symbol_entity_specs_reserve_default_argument_info(
-                specialized_symbol,
-                function_type_get_num_parameters(
-                    specialized_symbol->type_information));
-
-        // Do not reuse the exceptions of the primary symbol (they may need to be updated)
-        symbol_entity_specs_free_exceptions(specialized_symbol);
-
-        // Update exception specifications
-        decl_context_t* updated_context = decl_context_clone(primary_symbol->decl_context);
-        updated_context->template_parameters = template_arguments;
-
-        int i, num_exceptions = symbol_entity_specs_get_num_exceptions(primary_symbol);
-        for (i = 0; i < num_exceptions; i++)
-        {
-            type_t* exception_type = symbol_entity_specs_get_exceptions_num(primary_symbol, i);
-            type_t* updated_exception_type = update_type(exception_type, updated_context,
-                    locus);
-
-            symbol_entity_specs_add_exceptions(specialized_symbol,
-                    updated_exception_type);
-        }
-
-        // FIXME - noexcept?
-        // Do not copy the function code because it must be first instantiated
-        symbol_entity_specs_set_function_code(specialized_symbol, nodecl_null());
-    }
-
-    type_t* result = get_user_defined_type(specialized_symbol);
-
-    if (equivalent_match == NULL)
-    {
-        DEBUG_CODE()
-        {
-            fprintf(stderr, "TYPEUTILS: %s: Creating new specialization: %p '%s'\n",
-                    locus_to_str(locus),
-                    result,
-                    print_type_str(result, decl_context));
-        }
-
-#if 0
-        // Integrity verification
-        {
-            int i;
-            for (i = 0; i < template_type->type->num_unique_specialized_types; i++)
-            {
-                int j;
-                for (j = i + 1; j < template_type->type->num_unique_specialized_types; j++)
-                {
-                    int cmp1;
-                    cmp1 = compare_template_argument_list_of_named_template_specialized_types(
-                            &template_type->type->specialized_types[i],
-                            &template_type->type->specialized_types[j]);
-
-                    int cmp2;
-                    cmp2 = compare_template_argument_list_of_named_template_specialized_types(
-                            &template_type->type->specialized_types[j],
-                            &template_type->type->specialized_types[i]);
-
-                    if (cmp1 != -1 || cmp2 != 1)
-                    {
-                        extern void _enable_debug();
-                        extern void _disable_debug();
-                        _enable_debug();
-                        fprintf(stderr, "i < j?\n");
-                        cmp1 = compare_template_argument_list_of_named_template_specialized_types(
-                                &template_type->type->specialized_types[i],
-                                &template_type->type->specialized_types[j]);
-                        fprintf(stderr, "i > j?\n");
-                        cmp2 = compare_template_argument_list_of_named_template_specialized_types(
-                                &template_type->type->specialized_types[j],
-                                &template_type->type->specialized_types[i]);
-                        fprintf(stderr, "====\n");
-
-                        template_type_get_equivalent_specialized_type(template_type,
-                                template_arguments,
-                                decl_context,
-                                locus);
-                        fprintf(stderr, "*****\n");
-                        _disable_debug();
-                    }
-
-                    ERROR_CONDITION(cmp1 != -1,
-                            "%p: Invalid ordering cmp == %d (should be -1)\n#%d: %s\n#%d: %s\n",
-                            template_type->type,
-                            cmp1,
-                            i, print_type_str(template_type->type->specialized_types[i], decl_context),
-                            j, print_type_str(template_type->type->specialized_types[j], decl_context));
-
-                    ERROR_CONDITION(cmp2 != 1,
-                            "%p: Invalid ordering cmp == %d (should be 1)\n#%d: %s\n#%d: %s\n",
-                            template_type->type,
-                            cmp2,
-                            i, print_type_str(template_type->type->specialized_types[i], decl_context),
-                            j, print_type_str(template_type->type->specialized_types[j], decl_context));
-                }
-            }
-
-            int last_failed = -1;
-
-            for (i = 0; i < template_type->type->num_unique_specialized_types ; i++)
-            {
-                int cmp = compare_template_argument_list_of_named_template_specialized_types(
-                        &result,
-                        &template_type->type->specialized_types[i]);
-                if (cmp == 0)
-                    last_failed = i;
-            }
-
-            if (last_failed >= 0)
-            {
-                extern void _enable_debug();
-                extern void _disable_debug();
-                _enable_debug();
-                compare_template_argument_list_of_named_template_specialized_types(
-                        &result,
-                        &template_type->type->specialized_types[last_failed]);
-                fprintf(stderr, "====\n");
-                _disable_debug();
-            }
-
-            ERROR_CONDITION(last_failed >= 0, "%p: This cannot happen #%d\n%s\n%s",
-                    template_type->type,
-                    last_failed,
-                    print_declarator(template_type->type->specialized_types[last_failed]),
-                    print_declarator(result));
-        }
-#endif
-
-        // Register this new specialization in the unique specialization list
-        // This is to make room
-        P_LIST_ADD(template_type->type->unique_specialized_types,
-                template_type->type->num_unique_specialized_types,
-                result);
-        // And now we make an "binary insertion"
-        {
-            int lower = 0;
-            int upper = template_type->type->num_unique_specialized_types - 2;
-
-            while (lower <= upper)
-            {
-                int middle = (lower + upper) / 2;
-
-                int cmp = compare_equivalent_template_argument_list_of_named_template_specialized_types(
-                        &result,
-                        &template_type->type->unique_specialized_types[middle]);
-
-                if (cmp < 0)
-                {
-                    upper = middle - 1;
-                }
-                else if (cmp > 0)
-                {
-                    lower = middle + 1;
-                }
-                else
-                {
-                    internal_error("This cannot happen %p\nnew %s\n%03d: %s",
-                            template_type->type,
-                            print_declarator(result),
-                            middle, print_declarator(template_type->type->unique_specialized_types[middle]));
-                }
-            }
-            // lower tells us where the new element goes
-
-            int j;
-            // Shift all items right
-            for (j = template_type->type->num_unique_specialized_types - 1; j >= lower + 1; j--)
-            {
-                template_type->type->unique_specialized_types[j] =
-                    template_type->type->unique_specialized_types[j-1];
-            }
-            template_type->type->unique_specialized_types[lower] = result;
-#if 0
-            int i;
-            for (i = 0; i < template_type->type->num_unique_specialized_types - 1; i++)
-            {
-                int cmp = compare_template_argument_list_of_named_template_specialized_types(
-                        &result,
-                        &template_type->type->specialized_types[i]);
+    // Fix the template arguments
+    decl_context_t* updated_decl_context = decl_context_clone(primary_symbol->decl_context);
+    updated_decl_context->template_parameters = template_arguments;
+    specialized_symbol->decl_context = updated_decl_context;
 
-                ERROR_CONDITION(cmp == 0, "This cannot happen %p\nnew %s\n%03d: %s",
-                        template_type->type,
-                        print_declarator(result),
-                        i, print_declarator(template_type->type->specialized_types[i]));
-                if (cmp > 0)
-                    continue;
-                else if (cmp < 0)
-                {
-                    int j;
-#if 0
-                    // Integrity verification
-                    for (j = i + 1; j < template_type->type->num_unique_specialized_types - 1; j++)
-                    {
-                        cmp = compare_template_argument_list_of_named_template_specialized_types(
-                                &result,
-                                &template_type->type->specialized_types[j]);
+    specialized_symbol->locus = locus;
 
-                        if (cmp != -1)
-                        {
-                            extern void _enable_debug();
-                            extern void _disable_debug();
-                            _enable_debug();
-                            fprintf(stderr, "result < j?\n");
-                            compare_template_argument_list_of_named_template_specialized_types(
-                                    &result,
-                                    &template_type->type->specialized_types[j]);
-                            fprintf(stderr, "result > j?\n");
-                            compare_template_argument_list_of_named_template_specialized_types(
-                                    &template_type->type->specialized_types[j],
-                                    &result);
-                            fprintf(stderr, "====\n");
-                            _disable_debug();
-                        }
+    // Keep information of the entity except for some attributes that
+    // must be cleared
+    symbol_entity_specs_copy_from(specialized_symbol, primary_symbol);
+    symbol_entity_specs_set_is_user_declared(specialized_symbol, 0);
+    symbol_entity_specs_set_is_instantiable(specialized_symbol, 0);
 
-                        ERROR_CONDITION(cmp != -1, "Wrong ordering %p\nnew %s\n%03d: %s",
-                                template_type->type,
-                                print_declarator(result),
-                                j, print_declarator(template_type->type->specialized_types[j]));
-                    }
-#endif
+    // Let this be filled later
+    symbol_entity_specs_free_related_symbols(specialized_symbol);
 
-                    // Shift all items right
-                    for (j = template_type->type->num_unique_specialized_types - 1; j >= i + 1; j--)
-                    {
-                        template_type->type->specialized_types[j] =
-                            template_type->type->specialized_types[j-1];
-                    }
-                    template_type->type->specialized_types[i] = result;
-                    break;
-                }
-            }
-#endif
-        }
+    if (equivalent_match != NULL)
+    {
+        symbol_entity_specs_set_alias_to(specialized_symbol, named_type_get_symbol(equivalent_match));
+    }
 
-#if 0
-        // Integrity verification
-        {
-            int i;
-            for (i = 0; i < template_type->type->num_unique_specialized_types; i++)
-            {
-                int j;
-                for (j = i + 1; j < template_type->type->num_unique_specialized_types; j++)
-                {
-                    int cmp1;
-                    cmp1 = compare_template_argument_list_of_named_template_specialized_types(
-                            &template_type->type->specialized_types[i],
-                            &template_type->type->specialized_types[j]);
+    // Copy function extra info
+    if (specialized_symbol->kind == SK_FUNCTION)
+    {
+        // Empty default argument info for the specialization
+        symbol_entity_specs_reserve_default_argument_info(
+                specialized_symbol,
+                function_type_get_num_parameters(
+                    specialized_symbol->type_information));
 
-                    int cmp2;
-                    cmp2 = compare_template_argument_list_of_named_template_specialized_types(
-                            &template_type->type->specialized_types[j],
-                            &template_type->type->specialized_types[i]);
+        // Do not reuse the exceptions of the primary symbol (they may need to be updated)
+        symbol_entity_specs_free_exceptions(specialized_symbol);
 
-                    if (cmp1 != -1 || cmp2 != 1)
-                    {
-                        extern void _enable_debug();
-                        extern void _disable_debug();
-                        _enable_debug();
-                        fprintf(stderr, "i < j?\n");
-                        cmp1 = compare_template_argument_list_of_named_template_specialized_types(
-                                &template_type->type->specialized_types[i],
-                                &template_type->type->specialized_types[j]);
-                        fprintf(stderr, "i > j?\n");
-                        cmp2 = compare_template_argument_list_of_named_template_specialized_types(
-                                &template_type->type->specialized_types[j],
-                                &template_type->type->specialized_types[i]);
-                        fprintf(stderr, "====\n");
-                        _disable_debug();
-                    }
+        // Update exception specifications
+        decl_context_t* updated_context = decl_context_clone(primary_symbol->decl_context);
+        updated_context->template_parameters = template_arguments;
 
-                    ERROR_CONDITION(cmp1 != -1,
-                            "%p: Invalid ordering cmp == %d (should be -1)\n#%d: %s\n#%d: %s\n",
-                            template_type->type,
-                            cmp1,
-                            i, print_type_str(template_type->type->specialized_types[i], decl_context),
-                            j, print_type_str(template_type->type->specialized_types[j], decl_context));
-
-                    ERROR_CONDITION(cmp2 != 1,
-                            "%p: Invalid ordering cmp == %d (should be 1)\n#%d: %s\n#%d: %s\n",
-                            template_type->type,
-                            cmp2,
-                            i, print_type_str(template_type->type->specialized_types[i], decl_context),
-                            j, print_type_str(template_type->type->specialized_types[j], decl_context));
-                }
-            }
+        int i, num_exceptions = symbol_entity_specs_get_num_exceptions(primary_symbol);
+        for (i = 0; i < num_exceptions; i++)
+        {
+            type_t* exception_type = symbol_entity_specs_get_exceptions_num(primary_symbol, i);
+            type_t* updated_exception_type = update_type(exception_type, updated_context,
+                    locus);
 
-            int last_failed = -1;
+            symbol_entity_specs_add_exceptions(specialized_symbol,
+                    updated_exception_type);
+        }
 
-            for (i = 0; i < template_type->type->num_unique_specialized_types ; i++)
-            {
-                int cmp = compare_template_argument_list_of_named_template_specialized_types(
-                        &result,
-                        &template_type->type->specialized_types[i]);
-                if (cmp == 0)
-                    last_failed = i;
-            }
+        // FIXME - noexcept?
+        // Do not copy the function code because it must be first instantiated
+        symbol_entity_specs_set_function_code(specialized_symbol, nodecl_null());
+    }
+
+    type_t* result = get_user_defined_type(specialized_symbol);
 
-            ERROR_CONDITION(last_failed < 0, "%p: This cannot happen\n%s",
-                    template_type->type,
+    if (equivalent_match == NULL)
+    {
+        DEBUG_CODE()
+        {
+            fprintf(stderr, "TYPEUTILS: %s: Creating new specialization: %p '%s'\n",
+                    locus_to_str(locus),
+                    result,
                     print_type_str(result, decl_context));
         }
-#endif
+
+        // Register this new specialization in the unique specialization index
+        template_type_add_unique_specialized_type(template_type, result,
+                template_argument_list_equivalent_hash(
+                    template_specialized_type_get_template_arguments(
+                        named_type_get_symbol(result)->type_information)));
     }
     else
     {
@@ -4141,14 +4350,11 @@ extern inline type_t* get_complex_type(type_t* t)
 {
     ERROR_CONDITION(t == NULL, "Invalid base type for complex type", 0);
 
-    static dhash_ptr_t *_complex_hash = NULL;
+    type_intern_key_t key;
+    type_intern_key_init(&key, TIK_COMPLEX);
+    type_intern_key_add_type(&key, t);
 
-    if (_complex_hash == NULL)
-    {
-        _complex_hash = dhash_ptr_new(5);
-    }
-
-    type_t* result = dhash_ptr_query(_complex_hash, (const char*)t);
+    type_t* result = type_intern_query(&key);
 
     if (result == NULL)
     {
@@ -4163,7 +4369,7 @@ extern inline type_t* get_complex_type(type_t* t)
 
         result->info->is_dependent = is_dependent_type(t);
 
-        dhash_ptr_insert(_complex_hash, (const char*)t, result);
+        type_intern_insert(&key, result);
     }
 
     return result;
@@ -4178,24 +4384,6 @@ extern inline type_t* complex_type_get_base_type(type_t* t)
     return t->type->complex_element;
 }
 
-static dhash_ptr_t *_qualification[(CV_CONST | CV_VOLATILE | CV_RESTRICT) + 1];
-static void init_qualification_hash(void)
-{
-    static char _qualif_hash_initialized = 0;
-
-    if (!_qualif_hash_initialized)
-    {
-        int i;
-        for (i = 0; 
-                i < (int)((CV_CONST|CV_VOLATILE|CV_RESTRICT) + 1);
-                i++)
-        {
-            _qualification[i] = dhash_ptr_new(5);
-        }
-        _qualif_hash_initialized = 1;
-    }
-}
-
 static void _get_array_type_components(type_t* array_type, 
         nodecl_t *whole_size, nodecl_t *lower_bound, nodecl_t *upper_bound, const decl_context_t** decl_context,
         array_region_t** array_region,
@@ -4286,10 +4474,6 @@ static inline type_t *get_qualified_type(type_t *original,
                                          cv_qualifier_t cv_qualification,
                                          char qualify_arrays)
 {
-    // Ensure it is initialized
-    init_qualification_hash();
-
-
     cv_qualifier_t old_cv_qualifier = CV_NONE;
     type_t* unchanged_type = original;
 
@@ -4324,9 +4508,12 @@ static inline type_t *get_qualified_type(type_t *original,
     }
 
     // Lookup based on the unqualified type
-    type_t* qualified_type = (type_t*)dhash_ptr_query(
-            _qualification[(int)(cv_qualification)], 
-            (const char*)original->unqualified_type);
+    type_intern_key_t key;
+    type_intern_key_init(&key, TIK_QUALIFIED);
+    type_intern_key_add_type(&key, original->unqualified_type);
+    type_intern_key_add_value(&key, cv_qualification);
+
+    type_t* qualified_type = type_intern_query(&key);
 
     if (qualified_type == NULL)
     {
@@ -4338,9 +4525,7 @@ static inline type_t *get_qualified_type(type_t *original,
 
         qualified_type->_advanced_type = NULL;
 
-        dhash_ptr_insert(_qualification[(int)(cv_qualification)], 
-                (const char*)original->unqualified_type, 
-                qualified_type);
+        type_intern_insert(&key, qualified_type);
     }
 
     return qualified_type;
@@ -4381,14 +4566,11 @@ extern inline type_t* get_pointer_type(type_t* t)
 {
     ERROR_CONDITION(t == NULL, "Invalid NULL type", 0);
 
-    static dhash_ptr_t *_pointer_types = NULL;
-
-    if (_pointer_types == NULL)
-    {
-        _pointer_types = dhash_ptr_new(5);
-    }
+    type_intern_key_t key;
+    type_intern_key_init(&key, TIK_POINTER);
+    type_intern_key_add_type(&key, t);
 
-    type_t* pointed_type = dhash_ptr_query(_pointer_types, (const char*)t);
+    type_t* pointed_type = type_intern_query(&key);
 
     if (pointed_type == NULL)
     {
@@ -4424,16 +4606,12 @@ extern inline type_t* get_pointer_type(type_t* t)
 
         pointed_type->info->is_dependent = is_dependent_type(t);
 
-        dhash_ptr_insert(_pointer_types, (const char*)t, pointed_type);
+        type_intern_insert(&key, pointed_type);
     }
 
     return pointed_type;
 }
 
-static dhash_ptr_t *_lvalue_reference_types = NULL;
-static dhash_ptr_t *_rvalue_reference_types = NULL;
-static dhash_ptr_t *_rebindable_reference_types = NULL;
-
 static type_t* get_internal_reference_type(type_t* t, enum type_kind reference_kind)
 {
     ERROR_CONDITION(t == NULL, "Invalid reference type", 0);
@@ -4447,22 +4625,22 @@ static type_t* get_internal_reference_type(type_t* t, enum type_kind reference_k
     ERROR_CONDITION(t == NULL,
             "Trying to create a reference of a null type", 0);
 
-    dhash_ptr_t **reference_types = NULL;
+    type_intern_kind_t intern_kind = TIK_LVALUE_REFERENCE;
     switch (reference_kind)
     {
         case TK_LVALUE_REFERENCE:
             {
-                reference_types = &_lvalue_reference_types;
+                intern_kind = TIK_LVALUE_REFERENCE;
                 break;
             }
         case TK_RVALUE_REFERENCE:
             {
-                reference_types = &_rvalue_reference_types;
+                intern_kind = TIK_RVALUE_REFERENCE;
                 break;
             }
         case TK_REBINDABLE_REFERENCE:
             {
-                reference_types = &_rebindable_reference_types;
+                intern_kind = TIK_REBINDABLE_REFERENCE;
                 break;
             }
         default:
@@ -4471,14 +4649,11 @@ static type_t* get_internal_reference_type(type_t* t, enum type_kind reference_k
             }
     }
 
-    if ((*reference_types) == NULL)
-    {
-        (*reference_types) = dhash_ptr_new(5);
-    }
-
-    dhash_ptr_t *reference_hash = *reference_types;
+    type_intern_key_t key;
+    type_intern_key_init(&key, intern_kind);
+    type_intern_key_add_type(&key, t);
 
-    type_t* referenced_type = dhash_ptr_query(reference_hash, (const char*)t);
+    type_t* referenced_type = type_intern_query(&key);
 
     if (referenced_type == NULL)
     {
@@ -4490,7 +4665,7 @@ static type_t* get_internal_reference_type(type_t* t, enum type_kind reference_k
 
         referenced_type->info->is_dependent = is_dependent_type(t);
 
-        dhash_ptr_insert(reference_hash, (const char*)t, referenced_type);
+        type_intern_insert(&key, referenced_type);
     }
 
     return referenced_type;
@@ -4515,24 +4690,12 @@ extern inline type_t* get_pointer_to_member_type(type_t* t, type_t* class_type)
 {
     ERROR_CONDITION(t == NULL, "Invalid NULL type", 0);
 
-    static dhash_ptr_t *_class_types = NULL;
-
-    if (_class_types == NULL)
-    {
-        _class_types = dhash_ptr_new(5);
-    }
-
-    // First lookup using the class type
-    dhash_ptr_t * class_type_hash = dhash_ptr_query(_class_types, (const char*)class_type);
-
-    if (class_type_hash == NULL)
-    {
-        class_type_hash = dhash_ptr_new(5);
-
-        dhash_ptr_insert(_class_types, (const char*)class_type, class_type_hash);
-    }
+    type_intern_key_t key;
+    type_intern_key_init(&key, TIK_POINTER_TO_MEMBER);
+    type_intern_key_add_type(&key, class_type);
+    type_intern_key_add_type(&key, t);
 
-    type_t* pointer_to_member = dhash_ptr_query(class_type_hash, (const char*)t);
+    type_t* pointer_to_member = type_intern_query(&key);
 
     if (pointer_to_member == NULL)
     {
@@ -4563,149 +4726,12 @@ extern inline type_t* get_pointer_to_member_type(type_t* t, type_t* class_type)
         pointer_to_member->info->is_dependent = is_dependent_type(t) 
             || is_dependent_type(class_type);
 
-        dhash_ptr_insert(class_type_hash, (const char*)t, pointer_to_member);
+        type_intern_insert(&key, pointer_to_member);
     }
 
     return pointer_to_member;
 }
 
-typedef struct array_sized_hash
-{
-    _size_t whole_size;
-    _size_t lower_bound;
-    _size_t upper_bound;
-    char with_descriptor;
-    char is_string_literal;
-    dhash_ptr_t *element_hash;
-} array_sized_hash_t;
-
-static array_sized_hash_t *_array_sized_hash = NULL;
-static int _array_sized_hash_size = 0;
-
-static dhash_ptr_t* _init_array_sized_hash(array_sized_hash_t *array_sized_hash_elem, 
-        _size_t whole_size,
-        _size_t lower_bound,
-        _size_t upper_bound,
-        char with_descriptor,
-        char is_string_literal)
-{
-    array_sized_hash_elem->whole_size = whole_size;
-    array_sized_hash_elem->lower_bound = lower_bound;
-    array_sized_hash_elem->upper_bound = upper_bound;
-    array_sized_hash_elem->with_descriptor = with_descriptor;
-    array_sized_hash_elem->is_string_literal = is_string_literal;
-    array_sized_hash_elem->element_hash = dhash_ptr_new(5);
-
-    return array_sized_hash_elem->element_hash;
-}
-
-/*
-   void *bsearch(const void *key, const void *base,
-   size_t nmemb, size_t size,
-   int (*compar)(const void *, const void *));
- */
-
-static char tuple_lower_than(
-        int a0, int a1,
-        int b0, int b1)
-{
-    if (a0 < b0)
-        return 1;
-    else if (a0 > b0)
-        return 0;
-    else
-        return a1 < b1;
-}
-
-static char triple_lower_than(
-        int a0, int a1, int a2,
-        int b0, int b1, int b2)
-{
-    if (a0 < b0)
-        return 1;
-    else if (a0 > b0)
-        return 0;
-    else // a0 == b0 
-        return tuple_lower_than(a1, a2, b1, b2);
-}
-
-static int array_hash_compar(const void* v1, const void* v2)
-{
-    const array_sized_hash_t* a1 = (const array_sized_hash_t*)v1;
-    const array_sized_hash_t* a2 = (const array_sized_hash_t*)v2;
-
-    // (x0, y0, z0) < (x1, y1, z1)
-    if (triple_lower_than(
-                a1->whole_size,
-                a1->lower_bound,
-                a1->upper_bound,
-                a2->whole_size,
-                a2->lower_bound,
-                a2->upper_bound))
-    {
-        return -1;
-    }
-    // (x0, y0, z0) > (x1, y1, z1)
-    else if (triple_lower_than(
-                a2->whole_size,
-                a2->lower_bound,
-                a2->upper_bound,
-                a1->whole_size,
-                a1->lower_bound,
-                a1->upper_bound))
-    {
-        return 1;
-    }
-    else // (x0, y0, z0) == (x1, y1, z1)
-    {
-        if (a1->with_descriptor < a2->with_descriptor)
-            return -1;
-        else if (a1->with_descriptor > a2->with_descriptor)
-            return 1;
-
-        if (a1->is_string_literal < a2->is_string_literal)
-            return -1;
-        else if (a1->is_string_literal > a2->is_string_literal)
-            return 1;
-    }
-    return 0;
-}
-
-static dhash_ptr_t* get_array_sized_hash(_size_t whole_size, _size_t lower_bound, _size_t upper_bound, 
-        char with_descriptor,
-        char is_string_literal)
-{
-    array_sized_hash_t key = { 
-        .whole_size = whole_size, 
-        .lower_bound = lower_bound, 
-        .upper_bound = upper_bound, 
-        .with_descriptor = with_descriptor,
-        .is_string_literal = is_string_literal
-    };
-
-    array_sized_hash_t* sized_hash = bsearch(&key, 
-            _array_sized_hash, _array_sized_hash_size, 
-            sizeof(array_sized_hash_t), array_hash_compar);
-
-    if (sized_hash == NULL)
-    {
-        _array_sized_hash_size++;
-        _array_sized_hash = NEW_REALLOC(array_sized_hash_t, _array_sized_hash, _array_sized_hash_size);
-
-        dhash_ptr_t* result = _init_array_sized_hash(&_array_sized_hash[_array_sized_hash_size - 1], 
-                whole_size, lower_bound, upper_bound, with_descriptor, is_string_literal);
-
-        // So we can use bsearch again
-        qsort(_array_sized_hash, _array_sized_hash_size, sizeof(array_sized_hash_t), array_hash_compar);
-
-        return result;
-    }
-    else
-    {
-        return sized_hash->element_hash;
-    }
-}
-
 // This is used only for cloning array types
 static void _get_array_type_components(type_t* array_type, 
         nodecl_t *whole_size, nodecl_t *lower_bound, nodecl_t *upper_bound, const decl_context_t** decl_context,
@@ -4811,27 +4837,23 @@ static type_t* _get_array_type(
         // Use the same strategy we use for pointers when all components (size,
         // lower, upper) of the array are null otherwise create a new array
         // every time (it is safer)
-        static dhash_ptr_t *_undefined_array_types[2][2][2] = {
-            { { NULL, NULL }, { NULL, NULL }  },
-            { { NULL, NULL }, { NULL, NULL }  }
-        };
-
         char is_dependent_array = force_dependent_type
             || is_dependent_type(element_type);
 
-        if (_undefined_array_types[!!with_descriptor][!!is_string_literal][!!is_dependent_array] == NULL)
-        {
-            _undefined_array_types[!!with_descriptor][!!is_string_literal][!!is_dependent_array] = dhash_ptr_new(5);
-        }
+        type_intern_key_t key;
+        type_intern_key_init(&key, TIK_UNDEFINED_ARRAY);
+        type_intern_key_add_type(&key, element_type);
+        type_intern_key_add_value(&key,
+                (!!with_descriptor)
+                | ((!!is_string_literal) << 1)
+                | ((!!is_dependent_array) << 2));
 
         type_t* undefined_array_type = NULL;
         if (nodecl_is_null(lower_bound)
                 && nodecl_is_null(upper_bound)
                 && array_region == NULL)
         {
-            undefined_array_type = dhash_ptr_query(
-                    _undefined_array_types[!!with_descriptor][!!is_string_literal][!!is_dependent_array],
-                    (const char*)element_type);
+            undefined_array_type = type_intern_query(&key);
         }
         if (undefined_array_type == NULL)
         {
@@ -4875,9 +4897,7 @@ static type_t* _get_array_type(
                     && nodecl_is_null(upper_bound)
                     && array_region == NULL)
             {
-                dhash_ptr_insert(
-                        _undefined_array_types[!!with_descriptor][!!is_string_literal][!!is_dependent_array],
-                        (const char*)element_type, result);
+                type_intern_insert(&key, result);
             }
         }
         else
@@ -4893,13 +4913,17 @@ static type_t* _get_array_type(
                 && upper_bound_is_constant
                 && array_region == NULL)
         {
-            dhash_ptr_t* array_sized_hash = get_array_sized_hash(whole_size_k,
-                    lower_bound_k,
-                    upper_bound_k,
-                    with_descriptor,
-                    is_string_literal);
+            type_intern_key_t key;
+            type_intern_key_init(&key, TIK_SIZED_ARRAY);
+            type_intern_key_add_type(&key, element_type);
+            type_intern_key_add_value(&key, whole_size_k);
+            type_intern_key_add_value(&key, lower_bound_k);
+            type_intern_key_add_value(&key, upper_bound_k);
+            type_intern_key_add_value(&key,
+                    (!!with_descriptor)
+                    | ((!!is_string_literal) << 1));
 
-            type_t* array_type = dhash_ptr_query(array_sized_hash, (const char*)element_type);
+            type_t* array_type = type_intern_query(&key);
 
             if (array_type == NULL)
             {
@@ -4930,7 +4954,7 @@ static type_t* _get_array_type(
 
                 result->array->is_string_literal = is_string_literal;
 
-                dhash_ptr_insert(array_sized_hash, (const char*)element_type, result);
+                type_intern_insert(&key, result);
             }
             else
             {
@@ -5025,8 +5049,29 @@ static nodecl_t convert_node_to_ptrdiff_t(nodecl_t n)
     return n;
 }
 
+// Array types keep their size trees and many of them are shared by all the
+// translation units (see type_intern_insert), so those trees are never
+// allocated in the arena of the current translation unit
+static mem_arena_t* array_type_suspend_ast_arena(nodecl_t* whole_size)
+{
+    mem_arena_t* arena = ast_get_current_arena();
+    if (arena == NULL)
+        return NULL;
+
+    ast_set_current_arena(NULL);
+
+    // Constant sizes are replaced by cached trees
+    if (!nodecl_is_null(*whole_size)
+            && !nodecl_is_constant(*whole_size))
+        *whole_size = nodecl_shallow_copy(*whole_size);
+
+    return arena;
+}
+
 extern inline type_t* get_array_type(type_t* element_type, nodecl_t whole_size, const decl_context_t* decl_context)
 {
+    mem_arena_t* arena = array_type_suspend_ast_arena(&whole_size);
+
     whole_size = convert_node_to_ptrdiff_t(whole_size);
 
     nodecl_t lower_bound = nodecl_null();
@@ -5066,17 +5111,23 @@ extern inline type_t* get_array_type(type_t* element_type, nodecl_t whole_size,
         }
     }
 
-    return _get_array_type(element_type, whole_size, lower_bound, upper_bound, decl_context, 
+    type_t* result = _get_array_type(element_type, whole_size, lower_bound, upper_bound, decl_context, 
             /* array_region */ NULL,
             /* with_descriptor */ 0,
             /* is_string_literal */ 0,
             /* force_dependent_type */ 0);
+
+    ast_set_current_arena(arena);
+
+    return result;
 }
 
 static type_t* get_array_type_for_literal_string(type_t* element_type,
         nodecl_t whole_size,
         const decl_context_t* decl_context)
 {
+    mem_arena_t* arena = array_type_suspend_ast_arena(&whole_size);
+
     whole_size = convert_node_to_ptrdiff_t(whole_size);
 
     nodecl_t lower_bound = nodecl_null();
@@ -5114,11 +5165,15 @@ static type_t* get_array_type_for_literal_string(type_t* element_type,
         }
     }
 
-    return _get_array_type(element_type, whole_size, lower_bound, upper_bound, decl_context,
+    type_t* result = _get_array_type(element_type, whole_size, lower_bound, upper_bound, decl_context,
             /* array_region */ NULL,
             /* with_descriptor */ 0,
             /* is_string_literal */ 1,
             /* force_dependent_type */ 0);
+
+    ast_set_current_arena(arena);
+
+    return result;
 }
 
 static nodecl_t compute_whole_size_given_bounds(
@@ -5253,38 +5308,16 @@ extern inline type_t* get_array_type_unknown_size_dependent(type_t* element_type
             /* force_dependent_type */ 1);
 }
 
-static dhash_ptr_t* get_vector_sized_hash(unsigned int vector_size)
-{
-    static rb_red_blk_tree *_vector_size_hash = NULL;
-
-    if (_vector_size_hash == NULL)
-    {
-        _vector_size_hash = rb_tree_create(uint_comp, null_dtor, null_dtor);
-    }
-
-    dhash_ptr_t* result = (dhash_ptr_t*)rb_tree_query_uint(_vector_size_hash, vector_size);
-
-    if (result == NULL)
-    {
-        dhash_ptr_t* new_hash = dhash_ptr_new(5);
-
-        unsigned int *k = NEW(unsigned int);
-        *k = vector_size;
-        rb_tree_insert(_vector_size_hash, k, new_hash);
-
-        result = new_hash;
-    }
-
-    return result;
-}
-
 extern inline type_t* get_vector_type_by_bytes(type_t* element_type, unsigned int vector_size)
 {
     ERROR_CONDITION(element_type == NULL, "Invalid type", 0);
 
-    dhash_ptr_t *_vector_hash = get_vector_sized_hash(vector_size);
+    type_intern_key_t key;
+    type_intern_key_init(&key, TIK_VECTOR);
+    type_intern_key_add_type(&key, element_type);
+    type_intern_key_add_value(&key, vector_size);
 
-    type_t* result = dhash_ptr_query(_vector_hash, (const char*)element_type);
+    type_t* result = type_intern_query(&key);
 
     if (result == NULL)
     {
@@ -5300,7 +5333,7 @@ extern inline type_t* get_vector_type_by_bytes(type_t* element_type, unsigned in
 
         result->info->is_dependent = is_dependent_type(element_type);
 
-        dhash_ptr_insert(_vector_hash, (const char*)element_type, result);
+        type_intern_insert(&key, result);
     }
 
     return result;
@@ -5418,9 +5451,13 @@ static type_t* _get_duplicated_class_type(type_t* class_type)
 {
     ERROR_CONDITION(!is_unnamed_class_type(class_type), "This is not a class type!", 0);
 
+    // Do not share the pending implicit members with the duplicate
+    class_type_declare_pending_implicit_members(class_type);
+
     type_t* result = NEW0(type_t);
     *result = *class_type;
 
+    result->hash = new_type_hash();
     result->unqualified_type = result;
 
     result->_advanced_type = NULL;
@@ -6018,10 +6055,47 @@ extern inline void class_type_set_destructor(type_t* class_type, scope_entry_t*
     class_type->type->class_info->destructor = entry;
 }
 
+extern inline void class_type_set_pending_implicit_members(type_t* class_type,
+        type_t* type_info,
+        const decl_context_t* decl_context,
+        const locus_t* locus)
+{
+    ERROR_CONDITION(!is_class_type(class_type), "This is not a class type", 0);
+    class_type = get_actual_class_type(class_type);
+
+    pending_implicit_members_t* pending = NEW(pending_implicit_members_t);
+    pending->type_info = type_info;
+    pending->decl_context = decl_context;
+    pending->locus = locus;
+
+    class_type->type->class_info->pending_implicit_members = pending;
+}
+
+extern inline void class_type_declare_pending_implicit_members(type_t* class_type)
+{
+    ERROR_CONDITION(!is_class_type(class_type), "This is not a class type", 0);
+    class_type = get_actual_class_type(class_type);
+
+    pending_implicit_members_t* pending = class_type->type->class_info->pending_implicit_members;
+    if (pending == NULL)
+        return;
+
+    // Clear it first as declaring them queries the members of this class
+    class_type->type->class_info->pending_implicit_members = NULL;
+
+    build_scope_declare_implicit_members(class_type,
+            pending->type_info,
+            pending->decl_context,
+            pending->locus);
+
+    DELETE(pending);
+}
+
 extern inline scope_entry_t* class_type_get_destructor(type_t* class_type)
 {
     ERROR_CONDITION(!is_class_type(class_type), "This is not a class type", 0);
     class_type = get_actual_class_type(class_type);
+    class_type_declare_pending_implicit_members(class_type);
     return class_type->type->class_info->destructor;
 }
 
@@ -6036,9 +6110,12 @@ extern inline scope_entry_t* class_type_get_default_constructor(type_t* class_ty
 {
     ERROR_CONDITION(!is_class_type(class_type), "This is not a class type", 0);
     class_type = get_actual_class_type(class_type);
+    class_type_declare_pending_implicit_members(class_type);
     return class_type->type->class_info->default_constructor;
 }
 
+// Does not declare the pending implicit members, only the getters that may
+// return them do
 static scope_entry_list_t* _class_type_get_members(type_t* t)
 {
     ERROR_CONDITION(!is_class_type(t), "This is not a class type", 0);
@@ -6068,6 +6145,7 @@ static scope_entry_list_t* _class_type_get_inherited_constructors(type_t* t)
 {
     ERROR_CONDITION(!is_class_type(t), "This is not a class type", 0);
     t = get_actual_class_type(t);
+    class_type_declare_pending_implicit_members(t);
 
     return t->type->class_info->inherited_constructors;
 }
@@ -6085,6 +6163,7 @@ extern inline scope_entry_list_t* class_type_get_members(type_t* t)
 {
     ERROR_CONDITION(!is_class_type(t), "This is not a class type", 0);
     t = get_actual_class_type(t);
+    class_type_declare_pending_implicit_members(t);
     scope_entry_list_t* members = _class_type_get_members(t);
 
     return entry_list_copy(members);
@@ -6133,6 +6212,14 @@ static scope_entry_list_t* _class_type_get_members_pred(type_t* t, void* data, c
     return result;
 }
 
+// Like _class_type_get_members_pred for members that may be implicit
+static scope_entry_list_t* _class_type_get_special_members_pred(type_t* t, void* data, char (*fun)(scope_entry_t*, void*))
+{
+    class_type_declare_pending_implicit_members(t);
+
+    return _class_type_get_members_pred(t, data, fun);
+}
+
 static char _member_is_conversion(scope_entry_t* entry, void* data UNUSED_PARAMETER)
 {
     return symbol_entity_specs_get_is_member(entry)
@@ -6157,7 +6244,7 @@ extern inline scope_entry_list_t* class_type_get_member_functions(type_t* t)
     ERROR_CONDITION(!is_class_type(t), "This is not a class type", 0);
     t = get_actual_class_type(t);
 
-    return _class_type_get_members_pred(t, NULL, _member_is_member_function);
+    return _class_type_get_special_members_pred(t, NULL, _member_is_member_function);
 }
 
 static char _member_is_data_member(scope_entry_t* entry, void* data UNUSED_PARAMETER)
@@ -6201,7 +6288,7 @@ extern inline scope_entry_list_t* class_type_get_move_constructors(type_t* t)
     ERROR_CONDITION(!is_class_type(t), "This is not a class type", 0);
     t = get_actual_class_type(t);
 
-    return _class_type_get_members_pred(t, NULL, _member_is_move_constructor);
+    return _class_type_get_special_members_pred(t, NULL, _member_is_move_constructor);
 }
 
 static char _member_is_copy_constructor(scope_entry_t* entry, void* data UNUSED_PARAMETER)
@@ -6214,7 +6301,7 @@ extern inline scope_entry_list_t* class_type_get_copy_constructors(type_t* t)
     ERROR_CONDITION(!is_class_type(t), "This is not a class type", 0);
     t = get_actual_class_type(t);
 
-    return _class_type_get_members_pred(t, NULL, _member_is_copy_constructor);
+    return _class_type_get_special_members_pred(t, NULL, _member_is_copy_constructor);
 }
 
 static char _member_is_move_assignment_operator(scope_entry_t* entry, void* data UNUSED_PARAMETER)
@@ -6227,7 +6314,7 @@ extern inline scope_entry_list_t* class_type_get_move_assignment_operators(type_
     ERROR_CONDITION(!is_class_type(t), "This is not a class type", 0);
     t = get_actual_class_type(t);
 
-    return _class_type_get_members_pred(t, NULL, _member_is_move_assignment_operator);
+    return _class_type_get_special_members_pred(t, NULL, _member_is_move_assignment_operator);
 }
 
 static char _member_is_constructor(scope_entry_t* entry, void* data UNUSED_PARAMETER)
@@ -6240,7 +6327,7 @@ extern inline scope_entry_list_t* class_type_get_constructors(type_t* t)
     ERROR_CONDITION(!is_class_type(t), "This is not a class type", 0);
     t = get_actual_class_type(t);
 
-    return _class_type_get_members_pred(t, NULL, _member_is_constructor);
+    return _class_type_get_special_members_pred(t, NULL, _member_is_constructor);
 }
 
 static char _member_is_copy_assignment_operator(scope_entry_t* entry, void* data UNUSED_PARAMETER)
@@ -6253,7 +6340,7 @@ extern inline scope_entry_list_t* class_type_get_copy_assignment_operators(type_
     ERROR_CONDITION(!is_class_type(t), "This is not a class type", 0);
     t = get_actual_class_type(t);
 
-    return _class_type_get_members_pred(t, NULL, _member_is_copy_assignment_operator);
+    return _class_type_get_special_members_pred(t, NULL, _member_is_copy_assignment_operator);
 }
 
 static void class_type_get_virtual_base_classes_rec(type_t* t, scope_entry_list_t** result, char canonical)
@@ -6358,7 +6445,7 @@ extern inline scope_entry_list_t* class_type_get_virtual_functions(type_t* t)
 
     int i, num_bases = class_type_get_num_bases(t);
 
-    scope_entry_list_t* result = _class_type_get_members_pred(t, NULL, _member_is_virtual_member_function);
+    scope_entry_list_t* result = _class_type_get_special_members_pred(t, NULL, _member_is_virtual_member_function);
 
     for (i = 0; i < num_bases; i++)
     {
@@ -6922,6 +7009,8 @@ extern inline void class_type_add_base_class(type_t* class_type, scope_entry_t*
     class_info_t* class_info = class_type->type->class_info;
     // Only add once
     P_LIST_ADD_ONCE(class_info->base_classes_list, class_info->num_bases, new_base_class);
+
+    class_scope_lookup_cache_class_changed(class_type);
 }
 
 void class_type_set_inner_context(type_t* class_type, const decl_context_t* decl_context)
@@ -6930,6 +7019,8 @@ void class_type_set_inner_context(type_t* class_type, const decl_context_t* decl
     class_type = get_actual_class_type(class_type);
 
     class_type->type->class_info->inner_decl_context = decl_context;
+
+    class_scope_lookup_cache_class_changed(class_type);
 }
 
 extern inline const decl_context_t* class_type_get_inner_context(type_t* class_type)
@@ -7096,6 +7187,14 @@ extern inline char equivalent_types(type_t* t1, type_t* t2)
     t1 = advance_over_typedefs_with_cv_qualif(t1, &cv_qualifier_t1);
     t2 = advance_over_typedefs_with_cv_qualif(t2, &cv_qualifier_t2);
 
+    // Derived types are hash-consed so in most cases equivalent types are
+    // the same type
+    if (t1 == t2
+            && t1->kind != TK_OVERLOAD)
+    {
+        return equivalent_cv_qualification(cv_qualifier_t1, cv_qualifier_t2);
+    }
+
     if (t1->kind != t2->kind)
     {
         return 0;
@@ -13820,8 +13919,6 @@ extern inline scope_entry_t* unresolved_overloaded_type_simplify(type_t* t, cons
             locus);
 }
 
-static dhash_ptr_t *_zero_types_hash = NULL;
-
 extern inline type_t* get_variant_type_zero(type_t* t)
 {
     ERROR_CONDITION (!is_integral_type(t) && !is_bool_type(t), "Base type must be integral", 0);
@@ -13831,19 +13928,18 @@ extern inline type_t* get_variant_type_zero(type_t* t)
     cv_qualifier_t cv_qualif = get_cv_qualifier(t);
     t = get_cv_qualified_type(advance_over_typedefs(t), CV_NONE);
 
-    if (_zero_types_hash == NULL)
-    {
-        _zero_types_hash = dhash_ptr_new(5);
-    }
+    type_intern_key_t key;
+    type_intern_key_init(&key, TIK_ZERO_VARIANT);
+    type_intern_key_add_type(&key, t);
 
-    type_t* result = dhash_ptr_query(_zero_types_hash, (const char*)t);
+    type_t* result = type_intern_query(&key);
 
     if (result == NULL)
     {
         result = copy_type_for_variant(t);
         result->info->is_zero_type = 1;
 
-        dhash_ptr_insert(_zero_types_hash, (const char*)t, result);
+        type_intern_insert(&key, result);
     }
 
     return get_cv_qualified_type(result, cv_qualif);
@@ -16012,8 +16108,6 @@ extern inline type_t* type_deep_copy(type_t* orig,
             /* symbol_deep_copy_map_t */ NULL);
 }
 
-static dhash_ptr_t *_interoperable_hash = NULL;
-
 // This function constructs an interoperable variant
 // This is used only in Fortran
 extern inline type_t* get_variant_type_interoperable(type_t* t)
@@ -16024,19 +16118,18 @@ extern inline type_t* get_variant_type_interoperable(type_t* t)
     if (t->info->is_interoperable)
         return t;
 
-    if (_interoperable_hash == NULL)
-    {
-        _interoperable_hash = dhash_ptr_new(5);
-    }
+    type_intern_key_t key;
+    type_intern_key_init(&key, TIK_INTEROPERABLE_VARIANT);
+    type_intern_key_add_type(&key, t);
 
-    type_t* result = dhash_ptr_query(_interoperable_hash, (const char*)t);
+    type_t* result = type_intern_query(&key);
 
     if (result == NULL)
     {
         result = copy_type_for_variant(t);
         result->info->is_interoperable = 1;
 
-        dhash_ptr_insert(_interoperable_hash, (const char*)t, result);
+        type_intern_insert(&key, result);
     }
 
     return result;
@@ -16137,14 +16230,11 @@ static void mask_type_compute_underlying_type(type_t* t)
 
 extern inline type_t* get_mask_type(unsigned int mask_size_bits)
 {
-    static rb_red_blk_tree *_mask_hash = NULL;
+    type_intern_key_t key;
+    type_intern_key_init(&key, TIK_MASK);
+    type_intern_key_add_value(&key, mask_size_bits);
 
-    if (_mask_hash == NULL)
-    {
-        _mask_hash = rb_tree_create(uint_comp, null_dtor, null_dtor);
-    }
-
-    type_t* result = (type_t*)rb_tree_query_uint(_mask_hash, mask_size_bits);
+    type_t* result = type_intern_query(&key);
 
     if (result == NULL)
     {
@@ -16152,12 +16242,9 @@ extern inline type_t* get_mask_type(unsigned int mask_size_bits)
         result->type->kind = STK_MASK;
         result->type->vector_size = mask_size_bits;
 
-        int *k = NEW(int);
-        *k = mask_size_bits;
-
         mask_type_compute_underlying_type(result);
 
-        rb_tree_insert(_mask_hash, k, result);
+        type_intern_insert(&key, result);
     }
 
     return result;
@@ -16221,14 +16308,11 @@ extern inline type_t* get_pack_type(type_t* t)
     ERROR_CONDITION(t == NULL, "Invalid NULL type", 0);
     ERROR_CONDITION(is_pack_type(t), "Cannot build a pack type of a pack type", 0);
 
-    static dhash_ptr_t *_pack_types = NULL;
+    type_intern_key_t key;
+    type_intern_key_init(&key, TIK_PACK);
+    type_intern_key_add_type(&key, t);
 
-    if (_pack_types == NULL)
-    {
-        _pack_types = dhash_ptr_new(5);
-    }
-
-    type_t* pack_type = dhash_ptr_query(_pack_types, (const char*)t);
+    type_t* pack_type = type_intern_query(&key);
 
     if (pack_type == NULL)
     {
@@ -16240,7 +16324,7 @@ extern inline type_t* get_pack_type(type_t* t)
 
         pack_type->info->is_dependent = is_dependent_type(t);
 
-        dhash_ptr_insert(_pack_types, (const char*)t, pack_type);
+        type_intern_insert(&key, pack_type);
     }
 
     return pack_type;
@@ -16768,27 +16852,24 @@ extern inline void get_packs_in_type(type_t* pack_type,
     }
 }
 
-static dhash_ptr_t *_atomic_types_hash = NULL;
-
 extern inline type_t* get_variant_type_atomic(type_t* t)
 {
-    if (_atomic_types_hash == NULL)
-    {
-        _atomic_types_hash = dhash_ptr_new(5);
-    }
-
     cv_qualifier_t cv_qualif = get_cv_qualifier(t);
     // We do not use get_unqualified_type because it preserves restrict
     t = get_cv_qualified_type(t, CV_NONE);
 
-    type_t* result = dhash_ptr_query(_atomic_types_hash, (const char*)t);
+    type_intern_key_t key;
+    type_intern_key_init(&key, TIK_ATOMIC_VARIANT);
+    type_intern_key_add_type(&key, t);
+
+    type_t* result = type_intern_query(&key);
 
     if (result == NULL)
     {
         result = copy_type_for_variant(t);
         result->info->is_atomic_type = 1;
 
-        dhash_ptr_insert(_atomic_types_hash, (const char*)t, result);
+        type_intern_insert(&key, result);
     }
 
     return get_cv_qualified_type(result, cv_qualif);
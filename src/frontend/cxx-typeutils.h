@@ -317,6 +317,11 @@ LIBMCXX_EXTERN void class_type_set_inner_context(type_t* class_type, const decl_
 LIBMCXX_EXTERN void class_type_set_destructor(type_t* class_type, scope_entry_t* entry);
 LIBMCXX_EXTERN void class_type_set_default_constructor(type_t* t, scope_entry_t* entry);
 LIBMCXX_EXTERN void class_type_set_enclosing_class_type(type_t* t, type_t* class_type);
+LIBMCXX_EXTERN void class_type_set_pending_implicit_members(type_t* class_type,
+        type_t* type_info,
+        const decl_context_t* decl_context,
+        const locus_t* locus);
+LIBMCXX_EXTERN void class_type_declare_pending_implicit_members(type_t* class_type);
 
 LIBMCXX_EXTERN void class_type_add_friend_symbol(type_t* t, scope_entry_t* entry);
 LIBMCXX_EXTERN void class_type_add_inherited_constructor(type_t* t, scope_entry_t* entry);
@@ -855,6 +860,14 @@ LIBMCXX_EXTERN void class_type_get_virtual_base_with_offset_num(type_t* t, int n
 
 LIBMCXX_EXTERN size_t get_type_t_size(void);
 
+// Statistics of the hash-consing of derived types, kind goes from 0 to
+// type_intern_get_num_kinds() - 1
+LIBMCXX_EXTERN int type_intern_get_num_kinds(void);
+LIBMCXX_EXTERN void type_intern_get_stats(int kind,
+        const char** name,
+        int* num_lookups,
+        int* num_hits);
+
 LIBMCXX_EXTERN const char* print_decl_type_str(type_t* t, const decl_context_t* decl_context, const char* name);
 LIBMCXX_EXTERN const char* print_type_str(type_t* t, const decl_context_t* decl_context);
 
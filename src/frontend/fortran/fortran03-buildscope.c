@@ -9809,6 +9809,7 @@ scope_entry_t* fortran_load_module(const char* module_name_str, char must_be_int
         fprintf(stderr, "BUILDSCOPE: Loading module '%s'\n", module_name_str);
     }
 
+    fortran_sign_in_intrinsic_module_on_demand(module_name_str);
     rb_red_blk_node* query = rb_tree_query(CURRENT_COMPILED_FILE->module_file_cache, module_name_str);
 
     char must_load = 1;
@@ -9984,6 +9985,8 @@ static void build_scope_use_stmt(AST a, const decl_context_t* decl_context, node
         }
 
         // Now add the ones not renamed
+        load_all_module_members(module_symbol);
+
         int i;
         for (i = 0; i < symbol_entity_specs_get_num_related_symbols(module_symbol); i++)
         {
@@ -1304,11 +1304,8 @@ static scope_entry_t* get_intrinsic_symbol_(
 
 static void null_dtor_func(const void *v UNUSED_PARAMETER) { }
 
-static void fortran_init_specific_names(const decl_context_t* decl_context);
-
 static void fortran_create_scope_for_intrinsics(const decl_context_t* decl_context);
-static void fortran_init_intrinsic_modules(const decl_context_t* decl_context);
-static void fortran_finish_intrinsic_modules(const decl_context_t* decl_context);
+static void fortran_reset_signed_in_intrinsics(void);
 
 static int pstrcasecmp(const char** a, const char** b)
 {
@@ -1330,9 +1327,6 @@ static char intrinsic_has_been_disabled(const char* c)
 void fortran_init_intrinsics(const decl_context_t* decl_context)
 {
     fortran_create_scope_for_intrinsics(decl_context);
-    fortran_init_intrinsic_modules(decl_context);
-
-    const decl_context_t* fortran_intrinsic_context = fortran_get_context_of_intrinsics(decl_context);
 
     if (CURRENT_CONFIGURATION->num_disabled_intrinsics > 0)
     {
@@ -1343,66 +1337,12 @@ void fortran_init_intrinsics(const decl_context_t* decl_context)
                 (int (*)(const void*, const void*))pstrcasecmp);
     }
 
-#define FORTRAN_GENERIC_INTRINSIC(module_name, name, keywords0, kind0, compute_code) \
-    { \
-        const decl_context_t* relevant_decl_context = fortran_intrinsic_context; \
-        scope_entry_t* module_sym = NULL; \
-        char disabled = 0; \
-        if (module_name != NULL) \
-        { \
-            rb_red_blk_node* query = rb_tree_query(CURRENT_COMPILED_FILE->module_file_cache, module_name); \
-            ERROR_CONDITION(query == NULL, "Module '%s' has not been registered", module_name); \
-            module_sym = (scope_entry_t*)rb_node_get_info(query); \
-            relevant_decl_context = module_sym->related_decl_context; \
-        } \
-        else { \
-            disabled = intrinsic_has_been_disabled(#name); \
-        } \
-        if (!disabled) \
-        { \
-        scope_entry_t* new_intrinsic = new_symbol(relevant_decl_context, relevant_decl_context->current_scope, uniquestr(#name)); \
-        new_intrinsic->locus = make_locus("(fortran-intrinsic)", 0, 0); \
-        new_intrinsic->kind = SK_FUNCTION; \
-        new_intrinsic->do_not_print = 1; \
-        new_intrinsic->type_information = get_computed_function_type(keyword_compute_intrinsic_##name); \
-        symbol_entity_specs_set_is_global_hidden(new_intrinsic, (module_sym == NULL)); \
-        symbol_entity_specs_set_is_builtin(new_intrinsic, 1); \
-        symbol_entity_specs_set_is_intrinsic_function(new_intrinsic, 1); \
-        if (kind0 == ES || kind0 == PS || kind0 == S) \
-        { \
-            symbol_entity_specs_set_is_intrinsic_function(new_intrinsic, 0); \
-            symbol_entity_specs_set_is_intrinsic_subroutine(new_intrinsic, 1); \
-        } \
-        else if (kind0 == M) \
-        { \
-            symbol_entity_specs_set_is_intrinsic_function(new_intrinsic, 1); \
-            symbol_entity_specs_set_is_intrinsic_subroutine(new_intrinsic, 1); \
-        } \
-        symbol_entity_specs_set_simplify_function(new_intrinsic, compute_code); \
-        if (module_sym != NULL) \
-        { \
-            new_intrinsic->locus = module_sym->locus; \
-            symbol_entity_specs_set_in_module(new_intrinsic, module_sym); \
-            symbol_entity_specs_set_is_module_procedure(new_intrinsic, 1); \
-            symbol_entity_specs_add_related_symbols(module_sym, \
-                    new_intrinsic); \
-        } \
-        } \
-    }
-
-#define FORTRAN_GENERIC_INTRINSIC_2(module_name, name, keywords0, kind0, compute_code0, keywords1, kind1, compute_code1) \
-    FORTRAN_GENERIC_INTRINSIC(module_name, name, keywords0, kind0, compute_code0)
-
-    FORTRAN_INTRINSIC_GENERIC_LIST
-#undef FORTRAN_GENERIC_INTRINSIC
-#undef FORTRAN_GENERIC_INTRINSIC_2
-
     intrinsic_map = rb_tree_create(intrinsic_descr_cmp, null_dtor_func, null_dtor_func);
 
-    // Sign in specific names for intrinsics
-    fortran_init_specific_names(fortran_intrinsic_context);
-
-    fortran_finish_intrinsic_modules(decl_context);
+    // Intrinsic names are signed in the first time they are looked up (see
+    // fortran_sign_in_intrinsic_on_demand) and intrinsic modules the first
+    // time they are used (see fortran_sign_in_intrinsic_module_on_demand)
+    fortran_reset_signed_in_intrinsics();
 }
 
 void copy_intrinsic_function_info(scope_entry_t* entry, scope_entry_t* intrinsic)
@@ -1607,126 +1547,426 @@ static scope_entry_t* register_custom_intrinsic(
     return entry;
 }
 
-#define REGISTER_SPECIFIC_INTRINSIC_0(_specific_name, _generic_name) \
-    register_specific_intrinsic_name(decl_context, (_generic_name), (_specific_name), 0, NULL, NULL, NULL, NULL, NULL, NULL, NULL)
-#define REGISTER_SPECIFIC_INTRINSIC_1(_specific_name, _generic_name, t_0) \
-    register_specific_intrinsic_name(decl_context, (_generic_name), (_specific_name), 1, (t_0), NULL, NULL, NULL, NULL, NULL, NULL)
-#define REGISTER_SPECIFIC_INTRINSIC_2(_specific_name, _generic_name, t_0, t_1) \
-    register_specific_intrinsic_name(decl_context, (_generic_name), (_specific_name), 2, (t_0), (t_1), NULL, NULL, NULL, NULL, NULL)
-
-#define REGISTER_CUSTOM_INTRINSIC_0(_specific_name, result_type) \
-    register_custom_intrinsic(decl_context, (_specific_name), result_type, 0, NULL, NULL, NULL)
-#define REGISTER_CUSTOM_INTRINSIC_1(_specific_name, result_type, type_0) \
-    register_custom_intrinsic(decl_context, (_specific_name), result_type, 1, type_0, NULL, NULL)
-#define REGISTER_CUSTOM_INTRINSIC_2(_specific_name, result_type, type_0, type_1) \
-    register_custom_intrinsic(decl_context, (_specific_name), result_type, 2, type_0, type_1, NULL)
-#define REGISTER_CUSTOM_INTRINSIC_3(_specific_name, result_type, type_0, type_1, type_2) \
-    register_custom_intrinsic(decl_context, (_specific_name), result_type, 3, type_0, type_1, type_2)
-
-static void fortran_init_specific_names(const decl_context_t* decl_context)
-{
-    type_t* default_char = get_array_type(fortran_get_default_character_type(), nodecl_null(), decl_context);
-
-    REGISTER_SPECIFIC_INTRINSIC_1("abs", "abs", fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("acos", "acos", fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("aimag", "aimag", get_complex_type(fortran_get_default_real_type()));
-    REGISTER_SPECIFIC_INTRINSIC_2("aint", "aint", fortran_get_default_real_type(), NULL);
-    REGISTER_SPECIFIC_INTRINSIC_1("alog", "log", fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("alog10", "log10", fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_2("amod", "mod", fortran_get_default_real_type(), fortran_get_default_real_type());
+typedef
+enum intrinsic_type_code_tag
+{
+    ITC_NONE = 0,
+    ITC_VOID,
+    ITC_INTEGER,
+    ITC_REAL,
+    ITC_DOUBLE,
+    ITC_COMPLEX,
+    ITC_DOUBLE_COMPLEX,
+    ITC_CHARACTER,
+    // Assumed length array of default character
+    ITC_DEFAULT_CHAR,
+} intrinsic_type_code_t;
+
+typedef
+struct specific_intrinsic_tag
+{
+    const char* specific_name;
+    // NULL for custom intrinsics
+    const char* generic_name;
+    // Only for custom intrinsics
+    intrinsic_type_code_t result_type;
+    int num_args;
+    intrinsic_type_code_t arg_types[3];
+} specific_intrinsic_t;
+
+#define SPECIFIC_INTRINSIC_0(_specific_name, _generic_name) \
+    { (_specific_name), (_generic_name), ITC_NONE, 0, { ITC_NONE, ITC_NONE, ITC_NONE } },
+#define SPECIFIC_INTRINSIC_1(_specific_name, _generic_name, t_0) \
+    { (_specific_name), (_generic_name), ITC_NONE, 1, { ITC_##t_0, ITC_NONE, ITC_NONE } },
+#define SPECIFIC_INTRINSIC_2(_specific_name, _generic_name, t_0, t_1) \
+    { (_specific_name), (_generic_name), ITC_NONE, 2, { ITC_##t_0, ITC_##t_1, ITC_NONE } },
+
+#define CUSTOM_INTRINSIC_0(_specific_name, result_type) \
+    { (_specific_name), NULL, ITC_##result_type, 0, { ITC_NONE, ITC_NONE, ITC_NONE } },
+#define CUSTOM_INTRINSIC_1(_specific_name, result_type, type_0) \
+    { (_specific_name), NULL, ITC_##result_type, 1, { ITC_##type_0, ITC_NONE, ITC_NONE } },
+#define CUSTOM_INTRINSIC_2(_specific_name, result_type, type_0, type_1) \
+    { (_specific_name), NULL, ITC_##result_type, 2, { ITC_##type_0, ITC_##type_1, ITC_NONE } },
+#define CUSTOM_INTRINSIC_3(_specific_name, result_type, type_0, type_1, type_2) \
+    { (_specific_name), NULL, ITC_##result_type, 3, { ITC_##type_0, ITC_##type_1, ITC_##type_2 } },
+
+// Specific names of generic intrinsics (i.e. ccos as a specific name of cos)
+// and custom intrinsics, which have no generic name. These are only signed in
+// when their generic name (or they themselves) are first referenced
+static const specific_intrinsic_t specific_intrinsics[] =
+{
+    SPECIFIC_INTRINSIC_1("abs", "abs", REAL)
+    SPECIFIC_INTRINSIC_1("acos", "acos", REAL)
+    SPECIFIC_INTRINSIC_1("aimag", "aimag", COMPLEX)
+    SPECIFIC_INTRINSIC_2("aint", "aint", REAL, NONE)
+    SPECIFIC_INTRINSIC_1("alog", "log", REAL)
+    SPECIFIC_INTRINSIC_1("alog10", "log10", REAL)
+    SPECIFIC_INTRINSIC_2("amod", "mod", REAL, REAL)
     // 'amax0' 'amax1' 'amin0' 'amin1' are defined as generic intrinsics due to their non-fortranish nature of unbounded number of parameters
-    REGISTER_SPECIFIC_INTRINSIC_2("anint", "anint", fortran_get_default_real_type(), NULL);
-    REGISTER_SPECIFIC_INTRINSIC_1("asin", "asin", fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("atan", "atan", fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_2("atan2", "atan2", fortran_get_default_real_type(), fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("cabs", "abs", get_complex_type(fortran_get_default_real_type()));
-    REGISTER_SPECIFIC_INTRINSIC_1("ccos", "cos", get_complex_type(fortran_get_default_real_type()));
-    REGISTER_SPECIFIC_INTRINSIC_1("cdcos", "cos", get_complex_type(fortran_get_doubleprecision_type()));
-    REGISTER_SPECIFIC_INTRINSIC_1("cexp", "exp", get_complex_type(fortran_get_default_real_type()));
-    REGISTER_SPECIFIC_INTRINSIC_2("char", "char", fortran_get_default_integer_type(), NULL);
-    REGISTER_SPECIFIC_INTRINSIC_1("clog", "log", get_complex_type(fortran_get_default_real_type()));
-    REGISTER_SPECIFIC_INTRINSIC_1("conjg", "conjg", get_complex_type(fortran_get_default_real_type()));
-    REGISTER_SPECIFIC_INTRINSIC_1("cos", "cos", fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("cosh", "cosh", fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("csin", "sin", get_complex_type(fortran_get_default_real_type()));
-    REGISTER_SPECIFIC_INTRINSIC_1("csqrt", "sqrt", get_complex_type(fortran_get_default_real_type()));
-    REGISTER_SPECIFIC_INTRINSIC_1("dabs", "abs", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("dacos", "cos", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("dasin", "asin", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("datan", "atan", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_2("datan2", "atan2", fortran_get_doubleprecision_type(), fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("dcos", "cos", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("dcosh", "cosh", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_2("ddim", "dim", fortran_get_doubleprecision_type(), fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("dexp", "exp", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_2("dim", "dim", fortran_get_default_real_type(), fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_2("dint", "aint", fortran_get_doubleprecision_type(), NULL);
-    REGISTER_SPECIFIC_INTRINSIC_1("dlog", "log", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("dlog10", "log10", fortran_get_doubleprecision_type());
+    SPECIFIC_INTRINSIC_2("anint", "anint", REAL, NONE)
+    SPECIFIC_INTRINSIC_1("asin", "asin", REAL)
+    SPECIFIC_INTRINSIC_1("atan", "atan", REAL)
+    SPECIFIC_INTRINSIC_2("atan2", "atan2", REAL, REAL)
+    SPECIFIC_INTRINSIC_1("cabs", "abs", COMPLEX)
+    SPECIFIC_INTRINSIC_1("ccos", "cos", COMPLEX)
+    SPECIFIC_INTRINSIC_1("cdcos", "cos", DOUBLE_COMPLEX)
+    SPECIFIC_INTRINSIC_1("cexp", "exp", COMPLEX)
+    SPECIFIC_INTRINSIC_2("char", "char", INTEGER, NONE)
+    SPECIFIC_INTRINSIC_1("clog", "log", COMPLEX)
+    SPECIFIC_INTRINSIC_1("conjg", "conjg", COMPLEX)
+    SPECIFIC_INTRINSIC_1("cos", "cos", REAL)
+    SPECIFIC_INTRINSIC_1("cosh", "cosh", REAL)
+    SPECIFIC_INTRINSIC_1("csin", "sin", COMPLEX)
+    SPECIFIC_INTRINSIC_1("csqrt", "sqrt", COMPLEX)
+    SPECIFIC_INTRINSIC_1("dabs", "abs", DOUBLE)
+    SPECIFIC_INTRINSIC_1("dacos", "cos", DOUBLE)
+    SPECIFIC_INTRINSIC_1("dasin", "asin", DOUBLE)
+    SPECIFIC_INTRINSIC_1("datan", "atan", DOUBLE)
+    SPECIFIC_INTRINSIC_2("datan2", "atan2", DOUBLE, DOUBLE)
+    SPECIFIC_INTRINSIC_1("dcos", "cos", DOUBLE)
+    SPECIFIC_INTRINSIC_1("dcosh", "cosh", DOUBLE)
+    SPECIFIC_INTRINSIC_2("ddim", "dim", DOUBLE, DOUBLE)
+    SPECIFIC_INTRINSIC_1("dexp", "exp", DOUBLE)
+    SPECIFIC_INTRINSIC_2("dim", "dim", REAL, REAL)
+    SPECIFIC_INTRINSIC_2("dint", "aint", DOUBLE, NONE)
+    SPECIFIC_INTRINSIC_1("dlog", "log", DOUBLE)
+    SPECIFIC_INTRINSIC_1("dlog10", "log10", DOUBLE)
     // dmax1 dmin1 are defined as generic intrinsics
-    REGISTER_SPECIFIC_INTRINSIC_2("dmod", "mod", fortran_get_doubleprecision_type(), fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_2("dnint", "anint", fortran_get_doubleprecision_type(), NULL);
-    REGISTER_SPECIFIC_INTRINSIC_2("dprod", "dprod", fortran_get_default_real_type(), fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_2("dreal", "real", get_complex_type(fortran_get_doubleprecision_type()), NULL);
-    REGISTER_SPECIFIC_INTRINSIC_2("dsign", "sign", fortran_get_doubleprecision_type(), fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("dsin", "sin", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("dsinh", "sinh", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("dsqrt", "sqrt", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("dtan", "tan", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("dtanh", "tanh", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("exp", "exp", fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("iabs", "abs", fortran_get_default_integer_type());
-    REGISTER_SPECIFIC_INTRINSIC_2("ichar", "ichar", default_char, NULL);
-    REGISTER_SPECIFIC_INTRINSIC_2("idim", "dim", fortran_get_default_integer_type(), fortran_get_default_integer_type());
-    REGISTER_SPECIFIC_INTRINSIC_2("idint", "int", fortran_get_doubleprecision_type(), NULL);
-    REGISTER_SPECIFIC_INTRINSIC_2("idnint", "nint", fortran_get_doubleprecision_type(), NULL);
-    REGISTER_SPECIFIC_INTRINSIC_2("ifix", "int", fortran_get_default_real_type(), NULL);
-    REGISTER_SPECIFIC_INTRINSIC_2("index", "index", default_char, default_char);
-    REGISTER_SPECIFIC_INTRINSIC_2("int", "int", fortran_get_default_integer_type(), NULL);
-    REGISTER_SPECIFIC_INTRINSIC_2("isign", "sign", fortran_get_default_integer_type(), fortran_get_default_integer_type());
-    REGISTER_SPECIFIC_INTRINSIC_2("len", "len", default_char, NULL);
-    REGISTER_SPECIFIC_INTRINSIC_2("lge", "lge", default_char, default_char);
-    REGISTER_SPECIFIC_INTRINSIC_2("lgt", "lgt", default_char, default_char);
-    REGISTER_SPECIFIC_INTRINSIC_2("lle", "lle", default_char, default_char);
-    REGISTER_SPECIFIC_INTRINSIC_2("llt", "llt", default_char, default_char);
-    REGISTER_SPECIFIC_INTRINSIC_2("mod", "mod", fortran_get_default_integer_type(), fortran_get_default_integer_type());
-    REGISTER_SPECIFIC_INTRINSIC_2("nint", "nint", fortran_get_default_real_type(), NULL);
-    REGISTER_SPECIFIC_INTRINSIC_2("real", "real", fortran_get_default_integer_type(), NULL);
-    REGISTER_SPECIFIC_INTRINSIC_2("sign", "sign", fortran_get_default_real_type(), fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("sin", "sin", fortran_get_default_real_type());
-    //REGISTER_SPECIFIC_INTRINSIC_2("sngl", "real", fortran_get_doubleprecision_type(), NULL);
-    REGISTER_SPECIFIC_INTRINSIC_1("sqrt", "sqrt", fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("tan", "tan", fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("tanh", "tanh", fortran_get_default_real_type());
-
-    REGISTER_SPECIFIC_INTRINSIC_1("sind", "sind", fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("dsind", "sind", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("csind", "sind", get_complex_type(fortran_get_default_real_type()));
-
-    REGISTER_SPECIFIC_INTRINSIC_1("cosd", "cosd", fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("dcosd", "cosd", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("ccosd", "cosd", get_complex_type(fortran_get_default_real_type()));
-
-    REGISTER_SPECIFIC_INTRINSIC_1("tand", "tand", fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("dtand", "tand", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("ctand", "tand", get_complex_type(fortran_get_default_real_type()));
-
-    REGISTER_SPECIFIC_INTRINSIC_2("atan2d", "atan2d", fortran_get_default_real_type(), fortran_get_default_real_type());
-    REGISTER_SPECIFIC_INTRINSIC_2("datan2d", "atan2d", fortran_get_doubleprecision_type(), fortran_get_doubleprecision_type());
+    SPECIFIC_INTRINSIC_2("dmod", "mod", DOUBLE, DOUBLE)
+    SPECIFIC_INTRINSIC_2("dnint", "anint", DOUBLE, NONE)
+    SPECIFIC_INTRINSIC_2("dprod", "dprod", REAL, REAL)
+    SPECIFIC_INTRINSIC_2("dreal", "real", DOUBLE_COMPLEX, NONE)
+    SPECIFIC_INTRINSIC_2("dsign", "sign", DOUBLE, DOUBLE)
+    SPECIFIC_INTRINSIC_1("dsin", "sin", DOUBLE)
+    SPECIFIC_INTRINSIC_1("dsinh", "sinh", DOUBLE)
+    SPECIFIC_INTRINSIC_1("dsqrt", "sqrt", DOUBLE)
+    SPECIFIC_INTRINSIC_1("dtan", "tan", DOUBLE)
+    SPECIFIC_INTRINSIC_1("dtanh", "tanh", DOUBLE)
+    SPECIFIC_INTRINSIC_1("exp", "exp", REAL)
+    SPECIFIC_INTRINSIC_1("iabs", "abs", INTEGER)
+    SPECIFIC_INTRINSIC_2("ichar", "ichar", DEFAULT_CHAR, NONE)
+    SPECIFIC_INTRINSIC_2("idim", "dim", INTEGER, INTEGER)
+    SPECIFIC_INTRINSIC_2("idint", "int", DOUBLE, NONE)
+    SPECIFIC_INTRINSIC_2("idnint", "nint", DOUBLE, NONE)
+    SPECIFIC_INTRINSIC_2("ifix", "int", REAL, NONE)
+    SPECIFIC_INTRINSIC_2("index", "index", DEFAULT_CHAR, DEFAULT_CHAR)
+    SPECIFIC_INTRINSIC_2("int", "int", INTEGER, NONE)
+    SPECIFIC_INTRINSIC_2("isign", "sign", INTEGER, INTEGER)
+    SPECIFIC_INTRINSIC_2("len", "len", DEFAULT_CHAR, NONE)
+    SPECIFIC_INTRINSIC_2("lge", "lge", DEFAULT_CHAR, DEFAULT_CHAR)
+    SPECIFIC_INTRINSIC_2("lgt", "lgt", DEFAULT_CHAR, DEFAULT_CHAR)
+    SPECIFIC_INTRINSIC_2("lle", "lle", DEFAULT_CHAR, DEFAULT_CHAR)
+    SPECIFIC_INTRINSIC_2("llt", "llt", DEFAULT_CHAR, DEFAULT_CHAR)
+    SPECIFIC_INTRINSIC_2("mod", "mod", INTEGER, INTEGER)
+    SPECIFIC_INTRINSIC_2("nint", "nint", REAL, NONE)
+    SPECIFIC_INTRINSIC_2("real", "real", INTEGER, NONE)
+    SPECIFIC_INTRINSIC_2("sign", "sign", REAL, REAL)
+    SPECIFIC_INTRINSIC_1("sin", "sin", REAL)
+    //SPECIFIC_INTRINSIC_2("sngl", "real", DOUBLE, NONE)
+    SPECIFIC_INTRINSIC_1("sqrt", "sqrt", REAL)
+    SPECIFIC_INTRINSIC_1("tan", "tan", REAL)
+    SPECIFIC_INTRINSIC_1("tanh", "tanh", REAL)
+
+    SPECIFIC_INTRINSIC_1("sind", "sind", REAL)
+    SPECIFIC_INTRINSIC_1("dsind", "sind", DOUBLE)
+    SPECIFIC_INTRINSIC_1("csind", "sind", COMPLEX)
+
+    SPECIFIC_INTRINSIC_1("cosd", "cosd", REAL)
+    SPECIFIC_INTRINSIC_1("dcosd", "cosd", DOUBLE)
+    SPECIFIC_INTRINSIC_1("ccosd", "cosd", COMPLEX)
+
+    SPECIFIC_INTRINSIC_1("tand", "tand", REAL)
+    SPECIFIC_INTRINSIC_1("dtand", "tand", DOUBLE)
+    SPECIFIC_INTRINSIC_1("ctand", "tand", COMPLEX)
+
+    SPECIFIC_INTRINSIC_2("atan2d", "atan2d", REAL, REAL)
+    SPECIFIC_INTRINSIC_2("datan2d", "atan2d", DOUBLE, DOUBLE)
 
     // Non standard stuff
     // Very old (normally from g77) intrinsics
-    REGISTER_SPECIFIC_INTRINSIC_1("cdabs", "abs", get_complex_type(fortran_get_doubleprecision_type()));
-    REGISTER_SPECIFIC_INTRINSIC_1("zabs", "abs", get_complex_type(fortran_get_doubleprecision_type()));
-    REGISTER_SPECIFIC_INTRINSIC_1("dconjg", "conjg", get_complex_type(fortran_get_doubleprecision_type()));
-    REGISTER_SPECIFIC_INTRINSIC_1("dimag", "aimag", get_complex_type(fortran_get_doubleprecision_type()));
-    REGISTER_SPECIFIC_INTRINSIC_1("derf", "erf", fortran_get_doubleprecision_type());
-    REGISTER_SPECIFIC_INTRINSIC_1("derfc", "erfc", fortran_get_doubleprecision_type());
+    SPECIFIC_INTRINSIC_1("cdabs", "abs", DOUBLE_COMPLEX)
+    SPECIFIC_INTRINSIC_1("zabs", "abs", DOUBLE_COMPLEX)
+    SPECIFIC_INTRINSIC_1("dconjg", "conjg", DOUBLE_COMPLEX)
+    SPECIFIC_INTRINSIC_1("dimag", "aimag", DOUBLE_COMPLEX)
+    SPECIFIC_INTRINSIC_1("derf", "erf", DOUBLE)
+    SPECIFIC_INTRINSIC_1("derfc", "erfc", DOUBLE)
+
+    CUSTOM_INTRINSIC_2("getenv", VOID, CHARACTER, CHARACTER)
+    CUSTOM_INTRINSIC_1("sngl", REAL, DOUBLE)
+    CUSTOM_INTRINSIC_0("iargc", INTEGER)
+};
+
+#undef SPECIFIC_INTRINSIC_0
+#undef SPECIFIC_INTRINSIC_1
+#undef SPECIFIC_INTRINSIC_2
+#undef CUSTOM_INTRINSIC_0
+#undef CUSTOM_INTRINSIC_1
+#undef CUSTOM_INTRINSIC_2
+#undef CUSTOM_INTRINSIC_3
+
+typedef
+struct generic_intrinsic_tag
+{
+    const char* name;
+    // NULL unless this intrinsic belongs to an intrinsic module
+    const char* module_name;
+    intrinsic_kind_t kind;
+    computed_function_type_t compute_type;
+    simplify_function_t simplify;
+} generic_intrinsic_t;
 
-    REGISTER_CUSTOM_INTRINSIC_2("getenv", get_void_type(), fortran_get_default_character_type(), 
-            fortran_get_default_character_type());
-    REGISTER_CUSTOM_INTRINSIC_1("sngl", fortran_get_default_real_type(), fortran_get_doubleprecision_type());
-    REGISTER_CUSTOM_INTRINSIC_0("iargc", fortran_get_default_integer_type());
+static const generic_intrinsic_t generic_intrinsics[] =
+{
+#define FORTRAN_GENERIC_INTRINSIC(module_name, name, keywords0, kind0, compute_code) \
+    { #name, module_name, kind0, keyword_compute_intrinsic_##name, compute_code },
+#define FORTRAN_GENERIC_INTRINSIC_2(module_name, name, keywords0, kind0, compute_code0, keywords1, kind1, compute_code1) \
+    FORTRAN_GENERIC_INTRINSIC(module_name, name, keywords0, kind0, compute_code0)
+FORTRAN_INTRINSIC_GENERIC_LIST
+#undef FORTRAN_GENERIC_INTRINSIC
+#undef FORTRAN_GENERIC_INTRINSIC_2
+};
+
+// Whether an element of generic_intrinsics or specific_intrinsics has already
+// been signed in the current file
+static char generic_intrinsic_signed_in[STATIC_ARRAY_LENGTH(generic_intrinsics)];
+static char specific_intrinsic_signed_in[STATIC_ARRAY_LENGTH(specific_intrinsics)];
+
+static void fortran_reset_signed_in_intrinsics(void)
+{
+    memset(generic_intrinsic_signed_in, 0, sizeof(generic_intrinsic_signed_in));
+    memset(specific_intrinsic_signed_in, 0, sizeof(specific_intrinsic_signed_in));
+}
+
+// Sorted by name, it maps a name to the generic intrinsic that has to be
+// signed in (generic names and specific names of a generic) or to the custom
+// intrinsic. Intrinsics of intrinsic modules are not in this index.
+typedef
+struct intrinsic_name_tag
+{
+    const char* name;
+    int generic_index;
+    int custom_index;
+} intrinsic_name_t;
+
+static intrinsic_name_t* intrinsic_names = NULL;
+static int num_intrinsic_names = 0;
+
+static int intrinsic_name_cmp(const void* a, const void* b)
+{
+    return strcasecmp(((const intrinsic_name_t*)a)->name,
+            ((const intrinsic_name_t*)b)->name);
+}
+
+static int find_generic_intrinsic_index(const char* name)
+{
+    int i;
+    for (i = 0; i < (int)STATIC_ARRAY_LENGTH(generic_intrinsics); i++)
+    {
+        if (generic_intrinsics[i].module_name == NULL
+                && strcasecmp(generic_intrinsics[i].name, name) == 0)
+            return i;
+    }
+    return -1;
+}
+
+static void build_intrinsic_names_index(void)
+{
+    intrinsic_names = NEW_VEC(intrinsic_name_t,
+            STATIC_ARRAY_LENGTH(generic_intrinsics) + STATIC_ARRAY_LENGTH(specific_intrinsics));
+
+    int i;
+    for (i = 0; i < (int)STATIC_ARRAY_LENGTH(generic_intrinsics); i++)
+    {
+        if (generic_intrinsics[i].module_name != NULL)
+            continue;
+
+        intrinsic_name_t* current = &intrinsic_names[num_intrinsic_names];
+        num_intrinsic_names++;
+
+        current->name = generic_intrinsics[i].name;
+        current->generic_index = i;
+        current->custom_index = -1;
+    }
+
+    for (i = 0; i < (int)STATIC_ARRAY_LENGTH(specific_intrinsics); i++)
+    {
+        intrinsic_name_t* current = &intrinsic_names[num_intrinsic_names];
+        num_intrinsic_names++;
+
+        current->name = specific_intrinsics[i].specific_name;
+        if (specific_intrinsics[i].generic_name != NULL)
+        {
+            current->generic_index = find_generic_intrinsic_index(specific_intrinsics[i].generic_name);
+            current->custom_index = -1;
+            ERROR_CONDITION(current->generic_index < 0,
+                    "Generic intrinsic '%s' of specific intrinsic '%s' does not exist",
+                    specific_intrinsics[i].generic_name,
+                    specific_intrinsics[i].specific_name);
+        }
+        else
+        {
+            current->generic_index = -1;
+            current->custom_index = i;
+        }
+    }
+
+    qsort(intrinsic_names, num_intrinsic_names, sizeof(*intrinsic_names), intrinsic_name_cmp);
+}
+
+static type_t* get_type_of_intrinsic_type_code(intrinsic_type_code_t code,
+        const decl_context_t* decl_context)
+{
+    switch (code)
+    {
+        case ITC_NONE:
+            return NULL;
+        case ITC_VOID:
+            return get_void_type();
+        case ITC_INTEGER:
+            return fortran_get_default_integer_type();
+        case ITC_REAL:
+            return fortran_get_default_real_type();
+        case ITC_DOUBLE:
+            return fortran_get_doubleprecision_type();
+        case ITC_COMPLEX:
+            return get_complex_type(fortran_get_default_real_type());
+        case ITC_DOUBLE_COMPLEX:
+            return get_complex_type(fortran_get_doubleprecision_type());
+        case ITC_CHARACTER:
+            return fortran_get_default_character_type();
+        case ITC_DEFAULT_CHAR:
+            return get_array_type(fortran_get_default_character_type(), nodecl_null(), decl_context);
+        default:
+            internal_error("Invalid intrinsic type code %d", code);
+    }
+}
+
+static void sign_in_generic_intrinsic(const decl_context_t* decl_context,
+        scope_entry_t* module_sym,
+        const generic_intrinsic_t* generic)
+{
+    scope_entry_t* new_intrinsic = new_symbol(decl_context, decl_context->current_scope, uniquestr(generic->name));
+    new_intrinsic->locus = make_locus("(fortran-intrinsic)", 0, 0);
+    new_intrinsic->kind = SK_FUNCTION;
+    new_intrinsic->do_not_print = 1;
+    new_intrinsic->type_information = get_computed_function_type(generic->compute_type);
+    symbol_entity_specs_set_is_global_hidden(new_intrinsic, (module_sym == NULL));
+    symbol_entity_specs_set_is_builtin(new_intrinsic, 1);
+    symbol_entity_specs_set_is_intrinsic_function(new_intrinsic, 1);
+    if (generic->kind == ES || generic->kind == PS || generic->kind == S)
+    {
+        symbol_entity_specs_set_is_intrinsic_function(new_intrinsic, 0);
+        symbol_entity_specs_set_is_intrinsic_subroutine(new_intrinsic, 1);
+    }
+    else if (generic->kind == M)
+    {
+        symbol_entity_specs_set_is_intrinsic_function(new_intrinsic, 1);
+        symbol_entity_specs_set_is_intrinsic_subroutine(new_intrinsic, 1);
+    }
+    symbol_entity_specs_set_simplify_function(new_intrinsic, generic->simplify);
+    if (module_sym != NULL)
+    {
+        new_intrinsic->locus = module_sym->locus;
+        symbol_entity_specs_set_in_module(new_intrinsic, module_sym);
+        symbol_entity_specs_set_is_module_procedure(new_intrinsic, 1);
+        symbol_entity_specs_add_related_symbols(module_sym,
+                new_intrinsic);
+    }
+}
+
+static void sign_in_specific_intrinsic(const decl_context_t* intrinsic_context, int index)
+{
+    if (specific_intrinsic_signed_in[index])
+        return;
+    specific_intrinsic_signed_in[index] = 1;
+
+    const specific_intrinsic_t* specific = &specific_intrinsics[index];
+
+    type_t* t0 = get_type_of_intrinsic_type_code(specific->arg_types[0], intrinsic_context);
+    type_t* t1 = get_type_of_intrinsic_type_code(specific->arg_types[1], intrinsic_context);
+    type_t* t2 = get_type_of_intrinsic_type_code(specific->arg_types[2], intrinsic_context);
+
+    if (specific->generic_name != NULL)
+    {
+        register_specific_intrinsic_name(intrinsic_context,
+                specific->generic_name,
+                specific->specific_name,
+                specific->num_args,
+                t0, t1, t2, NULL, NULL, NULL, NULL);
+    }
+    else
+    {
+        register_custom_intrinsic(intrinsic_context,
+                specific->specific_name,
+                get_type_of_intrinsic_type_code(specific->result_type, intrinsic_context),
+                specific->num_args,
+                t0, t1, t2);
+    }
+}
+
+static void sign_in_intrinsic_of_generic_name(const decl_context_t* intrinsic_context, int index)
+{
+    if (generic_intrinsic_signed_in[index])
+        return;
+    generic_intrinsic_signed_in[index] = 1;
+
+    const generic_intrinsic_t* generic = &generic_intrinsics[index];
+    if (intrinsic_has_been_disabled(generic->name))
+        return;
+
+    sign_in_generic_intrinsic(intrinsic_context, /* module_sym */ NULL, generic);
+
+    // Sign in as well the specific names of this generic intrinsic
+    int i;
+    for (i = 0; i < (int)STATIC_ARRAY_LENGTH(specific_intrinsics); i++)
+    {
+        if (specific_intrinsics[i].generic_name != NULL
+                && strcasecmp(specific_intrinsics[i].generic_name, generic->name) == 0)
+        {
+            sign_in_specific_intrinsic(intrinsic_context, i);
+        }
+    }
+}
+
+char fortran_sign_in_intrinsic_on_demand(const decl_context_t* intrinsic_context, const char* name)
+{
+    if (intrinsic_names == NULL)
+        build_intrinsic_names_index();
+
+    intrinsic_name_t key = { name, -1, -1 };
+    intrinsic_name_t* first = (intrinsic_name_t*)bsearch(&key,
+            intrinsic_names, num_intrinsic_names,
+            sizeof(*intrinsic_names), intrinsic_name_cmp);
+    if (first == NULL)
+        return 0;
+
+    // A name may be both a generic name and a specific name
+    while (first > intrinsic_names
+            && intrinsic_name_cmp(first - 1, &key) == 0)
+        first--;
+
+    char signed_in = 0;
+    intrinsic_name_t* it;
+    for (it = first;
+            it < intrinsic_names + num_intrinsic_names
+            && intrinsic_name_cmp(it, &key) == 0;
+            it++)
+    {
+        if (it->generic_index >= 0
+                && !generic_intrinsic_signed_in[it->generic_index])
+        {
+            sign_in_intrinsic_of_generic_name(intrinsic_context, it->generic_index);
+            signed_in = 1;
+        }
+        if (it->custom_index >= 0
+                && !specific_intrinsic_signed_in[it->custom_index])
+        {
+            sign_in_specific_intrinsic(intrinsic_context, it->custom_index);
+            signed_in = 1;
+        }
+    }
+
+    return signed_in;
 }
 
 static type_t* no_ptr(type_t* t)
@@ -7721,13 +7961,6 @@ static void fortran_init_intrinsic_module_ieee_features(const decl_context_t* de
     }
 }
 
-static void fortran_init_intrinsic_module_ieee(const decl_context_t* decl_context)
-{
-    fortran_init_intrinsic_module_ieee_exceptions(decl_context);
-    fortran_init_intrinsic_module_ieee_arithmetic(decl_context);
-    fortran_init_intrinsic_module_ieee_features(decl_context);
-}
-
 static type_t* get_type_from_module(const char* module_name, const char* type_name)
 {
     scope_entry_t* module = get_module_in_cache(module_name);
@@ -8346,17 +8579,9 @@ static scope_entry_t* compute_intrinsic_ieee_is_nan(scope_entry_t* symbol UNUSED
     return NULL;
 }
 
-static void fortran_init_intrinsic_modules(const decl_context_t* decl_context)
-{
-    fortran_init_intrinsic_module_iso_c_binding(decl_context);
-    fortran_init_intrinsic_module_ieee(decl_context);
-}
-
-static void fortran_finish_intrinsic_modules(const decl_context_t* decl_context UNUSED_PARAMETER)
+static void fortran_finish_intrinsic_module_ieee_arithmetic(void)
 {
-    // Finish modules
-    //
-    // IEEE_ARITHMETICS modules has a USE IEEE_EXCEPTIONS
+    // IEEE_ARITHMETIC module has a USE IEEE_EXCEPTIONS
     scope_entry_t* ieee_arithmetic = get_module_in_cache("ieee_arithmetic");
     scope_entry_t* ieee_exceptions = get_module_in_cache("ieee_exceptions");
 
@@ -8376,6 +8601,72 @@ static void fortran_finish_intrinsic_modules(const decl_context_t* decl_context
     }
 }
 
+static void sign_in_intrinsics_of_module(scope_entry_t* module_sym)
+{
+    int i;
+    for (i = 0; i < (int)STATIC_ARRAY_LENGTH(generic_intrinsics); i++)
+    {
+        if (generic_intrinsics[i].module_name != NULL
+                && strcasecmp(generic_intrinsics[i].module_name, module_sym->symbol_name) == 0)
+        {
+            sign_in_generic_intrinsic(module_sym->related_decl_context,
+                    module_sym,
+                    &generic_intrinsics[i]);
+        }
+    }
+}
+
+static struct intrinsic_module_tag
+{
+    const char* module_name;
+    void (*init)(const decl_context_t* decl_context);
+    // Modules USEd by this one
+    const char* used_module_name;
+    void (*finish)(void);
+} intrinsic_modules[] = {
+    { "iso_c_binding", fortran_init_intrinsic_module_iso_c_binding, NULL, NULL },
+    { "ieee_exceptions", fortran_init_intrinsic_module_ieee_exceptions, NULL, NULL },
+    { "ieee_arithmetic", fortran_init_intrinsic_module_ieee_arithmetic,
+        "ieee_exceptions", fortran_finish_intrinsic_module_ieee_arithmetic },
+    { "ieee_features", fortran_init_intrinsic_module_ieee_features, NULL, NULL },
+};
+
+char fortran_is_intrinsic_module_name(const char* module_name)
+{
+    int i;
+    for (i = 0; i < (int)STATIC_ARRAY_LENGTH(intrinsic_modules); i++)
+    {
+        if (strcasecmp(intrinsic_modules[i].module_name, module_name) == 0)
+            return 1;
+    }
+    return 0;
+}
+
+void fortran_sign_in_intrinsic_module_on_demand(const char* module_name)
+{
+    if (rb_tree_query(CURRENT_COMPILED_FILE->module_file_cache, module_name) != NULL)
+        return;
+
+    int i;
+    for (i = 0; i < (int)STATIC_ARRAY_LENGTH(intrinsic_modules); i++)
+    {
+        if (strcasecmp(intrinsic_modules[i].module_name, module_name) != 0)
+            continue;
+
+        if (intrinsic_modules[i].used_module_name != NULL)
+            fortran_sign_in_intrinsic_module_on_demand(intrinsic_modules[i].used_module_name);
+
+        // This registers the module in the module cache
+        (intrinsic_modules[i].init)(CURRENT_COMPILED_FILE->global_decl_context);
+
+        sign_in_intrinsics_of_module(get_module_in_cache(intrinsic_modules[i].module_name));
+
+        if (intrinsic_modules[i].finish != NULL)
+            (intrinsic_modules[i].finish)();
+        return;
+    }
+}
+
 static void fortran_create_scope_for_intrinsics(const decl_context_t* decl_context)
 {
     scope_entry_t* fortran_intrinsics = new_symbol(decl_context, decl_context->current_scope,
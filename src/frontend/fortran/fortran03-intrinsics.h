@@ -49,6 +49,17 @@ void fortran_simplify_specific_intrinsic_call(scope_entry_t* symbol,
 
 const decl_context_t* fortran_get_context_of_intrinsics(const decl_context_t* decl_context);
 
+// Signs in the intrinsic (generic, specific or custom) called name. Returns
+// nonzero if something new was signed in
+char fortran_sign_in_intrinsic_on_demand(const decl_context_t* intrinsic_context, const char* name);
+
+// Builds the intrinsic module module_name (like ISO_C_BINDING) in the module
+// cache if it has not been built yet. Does nothing for non intrinsic modules
+void fortran_sign_in_intrinsic_module_on_demand(const char* module_name);
+
+// Returns nonzero if module_name is one of the intrinsic modules
+char fortran_is_intrinsic_module_name(const char* module_name);
+
 // These functions are for serialization purposes only
 int fortran_intrinsic_get_id(computed_function_type_t t);
 computed_function_type_t fortran_intrinsic_get_ptr(int id);
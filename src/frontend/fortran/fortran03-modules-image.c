@@ -0,0 +1,640 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "fortran03-modules-image.h"
+#include "cxx-utils.h"
+#include "uniquestr.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+
+/*
+   Layout of an image
+
+   header
+   string table: entries are 8-byte aligned and look like
+
+      [uint32_t length][uint32_t padding][length bytes][NUL]
+
+      a reference to a string is the file offset of its first byte, so the
+      string can be used in place. Offset 0 (inside the header) means NULL
+
+   then, for every section
+
+      uint32_t column_names[num_columns] (string references)
+      uint64_t keys[num_rows] (sorted)
+      uint32_t cells[num_rows * num_columns] (string references)
+*/
+
+#define MODULE_IMAGE_MAGIC "MF03IMG"
+
+enum {
+    MODULE_IMAGE_BYTE_ORDER = 0x01020304,
+    MODULE_IMAGE_FORMAT_VERSION = 2,
+};
+
+typedef
+struct module_image_section_header_tag
+{
+    uint32_t num_columns;
+    uint32_t num_rows;
+    uint64_t column_names_offset;
+    uint64_t keys_offset;
+    uint64_t cells_offset;
+} module_image_section_header_t;
+
+typedef
+struct module_image_header_tag
+{
+    char magic[8];
+    uint32_t byte_order;
+    uint32_t format_version;
+    uint64_t file_size;
+    uint64_t strings_offset;
+    uint64_t strings_size;
+    module_image_section_header_t sections[MIS_NUM_SECTIONS];
+} module_image_header_t;
+
+typedef
+struct module_image_section_info_tag
+{
+    int num_columns;
+    int num_rows;
+    const char** column_names;
+    const uint64_t* keys;
+    const uint32_t* cells;
+} module_image_section_info_t;
+
+struct module_image_tag
+{
+    const char* filename;
+    const char* addr;
+    size_t size;
+
+    uint64_t strings_offset;
+    uint64_t strings_size;
+
+    module_image_section_info_t sections[MIS_NUM_SECTIONS];
+};
+
+static const char* image_string(module_image_t* image, uint32_t ref)
+{
+    if (ref == 0)
+        return NULL;
+    return image->addr + ref;
+}
+
+static char image_range_is_valid(module_image_t* image, uint64_t offset, uint64_t size)
+{
+    return offset <= image->size
+        && size <= image->size - offset;
+}
+
+static char image_string_is_valid(module_image_t* image, uint32_t ref)
+{
+    if (ref == 0)
+        return 1;
+
+    if (ref < image->strings_offset + 2 * sizeof(uint32_t)
+            || ref >= image->strings_offset + image->strings_size
+            || (ref % 8) != 0)
+        return 0;
+
+    uint32_t length = *(const uint32_t*)(image->addr + ref - 2 * sizeof(uint32_t));
+    return image_range_is_valid(image, ref, (uint64_t)length + 1)
+        && image->addr[ref + length] == '\0';
+}
+
+char module_image_file_is_image(const char* filename)
+{
+    FILE* f = fopen(filename, "rb");
+    if (f == NULL)
+        return 0;
+
+    char magic[8];
+    char result = (fread(magic, sizeof(magic), 1, f) == 1
+            && memcmp(magic, MODULE_IMAGE_MAGIC, sizeof(magic)) == 0);
+    fclose(f);
+
+    return result;
+}
+
+module_image_t* module_image_open(const char* filename)
+{
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+
+    struct stat s;
+    if (fstat(fd, &s) < 0
+            || (size_t)s.st_size < sizeof(module_image_header_t))
+    {
+        close(fd);
+        return NULL;
+    }
+
+    const char* addr = mmap(0, s.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps the file alive
+    close(fd);
+    if (addr == MAP_FAILED)
+        return NULL;
+
+    module_image_t* image = NEW0(module_image_t);
+    image->filename = uniquestr(filename);
+    image->addr = addr;
+    image->size = s.st_size;
+
+    const module_image_header_t* header = (const module_image_header_t*)addr;
+    if (memcmp(header->magic, MODULE_IMAGE_MAGIC, sizeof(header->magic)) != 0
+            || header->byte_order != MODULE_IMAGE_BYTE_ORDER
+            || header->format_version != MODULE_IMAGE_FORMAT_VERSION
+            || header->file_size != image->size
+            || !image_range_is_valid(image, header->strings_offset, header->strings_size))
+    {
+        module_image_close(image);
+        return NULL;
+    }
+    image->strings_offset = header->strings_offset;
+    image->strings_size = header->strings_size;
+
+    int i;
+    for (i = 0; i < MIS_NUM_SECTIONS; i++)
+    {
+        const module_image_section_header_t* section_header = &header->sections[i];
+        module_image_section_info_t* section = &image->sections[i];
+
+        uint64_t num_cells = (uint64_t)section_header->num_rows * section_header->num_columns;
+        if (!image_range_is_valid(image, section_header->column_names_offset,
+                    section_header->num_columns * sizeof(uint32_t))
+                || !image_range_is_valid(image, section_header->keys_offset,
+                    section_header->num_rows * sizeof(uint64_t))
+                || !image_range_is_valid(image, section_header->cells_offset,
+                    num_cells * sizeof(uint32_t))
+                || (section_header->keys_offset % sizeof(uint64_t)) != 0
+                || (section_header->cells_offset % sizeof(uint32_t)) != 0
+                || (section_header->column_names_offset % sizeof(uint32_t)) != 0)
+        {
+            module_image_close(image);
+            return NULL;
+        }
+
+        section->num_columns = section_header->num_columns;
+        section->num_rows = section_header->num_rows;
+        section->keys = (const uint64_t*)(addr + section_header->keys_offset);
+        section->cells = (const uint32_t*)(addr + section_header->cells_offset);
+
+        const uint32_t* names = (const uint32_t*)(addr + section_header->column_names_offset);
+        // Keep a trailing NULL so the names can be used as a NULL-terminated array
+        section->column_names = NEW_VEC0(const char*, section->num_columns + 1);
+        int j;
+        for (j = 0; j < section->num_columns; j++)
+        {
+            if (names[j] == 0
+                    || !image_string_is_valid(image, names[j]))
+            {
+                module_image_close(image);
+                return NULL;
+            }
+            section->column_names[j] = image_string(image, names[j]);
+        }
+        // Cells are checked when they are read, this way opening an image
+        // does not have to touch all of it
+    }
+
+    return image;
+}
+
+void module_image_close(module_image_t* image)
+{
+    if (image == NULL)
+        return;
+
+    int i;
+    for (i = 0; i < MIS_NUM_SECTIONS; i++)
+    {
+        DELETE(image->sections[i].column_names);
+    }
+
+    munmap((void*)image->addr, image->size);
+    DELETE(image);
+}
+
+int module_image_num_columns(module_image_t* image, module_image_section_t section)
+{
+    return image->sections[section].num_columns;
+}
+
+const char** module_image_column_names(module_image_t* image, module_image_section_t section)
+{
+    return image->sections[section].column_names;
+}
+
+int module_image_num_rows(module_image_t* image, module_image_section_t section)
+{
+    return image->sections[section].num_rows;
+}
+
+char module_image_find_rows(module_image_t* image, module_image_section_t section,
+        uint64_t key, int *first, int *count)
+{
+    module_image_section_info_t* s = &image->sections[section];
+
+    // Lower bound
+    int lower = 0, upper = s->num_rows;
+    while (lower < upper)
+    {
+        int middle = lower + (upper - lower) / 2;
+        if (s->keys[middle] < key)
+            lower = middle + 1;
+        else
+            upper = middle;
+    }
+
+    int end = lower;
+    while (end < s->num_rows
+            && s->keys[end] == key)
+        end++;
+
+    *first = lower;
+    *count = end - lower;
+
+    return (*count != 0);
+}
+
+void module_image_get_row(module_image_t* image, module_image_section_t section,
+        int row, const char** values)
+{
+    module_image_section_info_t* s = &image->sections[section];
+    ERROR_CONDITION(row < 0 || row >= s->num_rows, "Invalid row %d", row);
+
+    const uint32_t* cells = &s->cells[(uint64_t)row * s->num_columns];
+    int i;
+    for (i = 0; i < s->num_columns; i++)
+    {
+        if (!image_string_is_valid(image, cells[i]))
+        {
+            fatal_error("Module image '%s' is corrupted\n", image->filename);
+        }
+        values[i] = image_string(image, cells[i]);
+    }
+}
+
+// Writer
+
+typedef
+struct module_image_row_tag
+{
+    uint64_t key;
+    int order;
+    uint32_t* cells;
+} module_image_row_t;
+
+typedef
+struct module_image_writer_section_tag
+{
+    int num_columns;
+    uint32_t* column_names;
+
+    int num_rows;
+    int capacity;
+    module_image_row_t* rows;
+} module_image_writer_section_t;
+
+typedef
+struct module_image_string_entry_tag
+{
+    uint32_t ref;
+    uint32_t length;
+    uint32_t hash;
+} module_image_string_entry_t;
+
+struct module_image_writer_tag
+{
+    // The string table is built already with its final layout, it will be
+    // placed right after the header
+    char* strings;
+    size_t strings_size;
+    size_t strings_capacity;
+
+    module_image_string_entry_t* string_hash;
+    int string_hash_size;
+    int num_strings;
+
+    module_image_writer_section_t sections[MIS_NUM_SECTIONS];
+    module_image_writer_section_t* current_section;
+};
+
+module_image_writer_t* module_image_writer_new(void)
+{
+    module_image_writer_t* writer = NEW0(module_image_writer_t);
+
+    writer->string_hash_size = 1024;
+    writer->string_hash = NEW_VEC0(module_image_string_entry_t, writer->string_hash_size);
+
+    return writer;
+}
+
+static uint32_t string_hash(const char* str, int length)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    int i;
+    for (i = 0; i < length; i++)
+    {
+        hash ^= (unsigned char)str[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static size_t align_to(size_t offset, size_t alignment)
+{
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+static void string_hash_insert(module_image_string_entry_t* table, int size,
+        module_image_string_entry_t entry)
+{
+    int i = entry.hash & (size - 1);
+    while (table[i].ref != 0)
+        i = (i + 1) & (size - 1);
+    table[i] = entry;
+}
+
+static uint32_t writer_add_string(module_image_writer_t* writer, const char* str, int length)
+{
+    if (str == NULL)
+        return 0;
+
+    uint32_t hash = string_hash(str, length);
+
+    int i = hash & (writer->string_hash_size - 1);
+    while (writer->string_hash[i].ref != 0)
+    {
+        module_image_string_entry_t* entry = &writer->string_hash[i];
+        if (entry->hash == hash
+                && entry->length == (uint32_t)length
+                && memcmp(writer->strings + entry->ref - sizeof(module_image_header_t), str, length) == 0)
+            return entry->ref;
+        i = (i + 1) & (writer->string_hash_size - 1);
+    }
+
+    size_t start = align_to(writer->strings_size, 8);
+    size_t end = start + 2 * sizeof(uint32_t) + length + 1;
+    if (end > writer->strings_capacity)
+    {
+        while (end > writer->strings_capacity)
+            writer->strings_capacity = writer->strings_capacity == 0 ? 4096 : 2 * writer->strings_capacity;
+        writer->strings = NEW_REALLOC(char, writer->strings, writer->strings_capacity);
+    }
+
+    memset(writer->strings + writer->strings_size, 0, end - writer->strings_size);
+    uint32_t length_u32 = length;
+    memcpy(writer->strings + start, &length_u32, sizeof(length_u32));
+    memcpy(writer->strings + start + 2 * sizeof(uint32_t), str, length);
+    writer->strings_size = end;
+
+    uint64_t ref = sizeof(module_image_header_t) + start + 2 * sizeof(uint32_t);
+    if (ref > UINT32_MAX)
+    {
+        fatal_error("Module image is too large\n");
+    }
+
+    module_image_string_entry_t new_entry = { (uint32_t)ref, (uint32_t)length, hash };
+    string_hash_insert(writer->string_hash, writer->string_hash_size, new_entry);
+    writer->num_strings++;
+
+    // Keep the load factor below 1/2
+    if (2 * writer->num_strings > writer->string_hash_size)
+    {
+        int new_size = 2 * writer->string_hash_size;
+        module_image_string_entry_t* new_table = NEW_VEC0(module_image_string_entry_t, new_size);
+        for (i = 0; i < writer->string_hash_size; i++)
+        {
+            if (writer->string_hash[i].ref != 0)
+                string_hash_insert(new_table, new_size, writer->string_hash[i]);
+        }
+        DELETE(writer->string_hash);
+        writer->string_hash = new_table;
+        writer->string_hash_size = new_size;
+    }
+
+    return new_entry.ref;
+}
+
+void module_image_writer_begin_section(module_image_writer_t* writer,
+        module_image_section_t section,
+        int num_columns, const char** column_names)
+{
+    ERROR_CONDITION(section < 0 || section >= MIS_NUM_SECTIONS, "Invalid section %d", section);
+
+    module_image_writer_section_t* s = &writer->sections[section];
+    ERROR_CONDITION(s->column_names != NULL, "Section %d already started", section);
+
+    s->num_columns = num_columns;
+    s->column_names = NEW_VEC0(uint32_t, num_columns);
+    int i;
+    for (i = 0; i < num_columns; i++)
+    {
+        s->column_names[i] = writer_add_string(writer, column_names[i], strlen(column_names[i]));
+    }
+
+    writer->current_section = s;
+}
+
+void module_image_writer_add_row(module_image_writer_t* writer,
+        uint64_t key, const char** values, const int* lengths)
+{
+    module_image_writer_section_t* s = writer->current_section;
+    ERROR_CONDITION(s == NULL, "No section has been started", 0);
+
+    if (s->num_rows == s->capacity)
+    {
+        s->capacity = s->capacity == 0 ? 64 : 2 * s->capacity;
+        s->rows = NEW_REALLOC(module_image_row_t, s->rows, s->capacity);
+    }
+
+    module_image_row_t* row = &s->rows[s->num_rows];
+    row->key = key;
+    row->order = s->num_rows;
+    row->cells = NEW_VEC0(uint32_t, s->num_columns);
+
+    int i;
+    for (i = 0; i < s->num_columns; i++)
+    {
+        row->cells[i] = writer_add_string(writer, values[i],
+                lengths != NULL ? lengths[i] : (values[i] != NULL ? (int)strlen(values[i]) : 0));
+    }
+
+    s->num_rows++;
+}
+
+static int row_cmp(const void* p1, const void* p2)
+{
+    const module_image_row_t* r1 = (const module_image_row_t*)p1;
+    const module_image_row_t* r2 = (const module_image_row_t*)p2;
+
+    if (r1->key < r2->key)
+        return -1;
+    else if (r1->key > r2->key)
+        return 1;
+    // qsort is not stable
+    else if (r1->order < r2->order)
+        return -1;
+    else if (r1->order > r2->order)
+        return 1;
+    else
+        return 0;
+}
+
+static void write_or_die(FILE* f, const void* data, size_t size, const char* filename)
+{
+    if (size > 0
+            && fwrite(data, size, 1, f) != 1)
+    {
+        fatal_error("Error while writing module image '%s' (%s)\n", filename, strerror(errno));
+    }
+}
+
+static void write_padding(FILE* f, size_t *offset, size_t alignment, const char* filename)
+{
+    static const char zeros[8] = { 0 };
+    size_t aligned = align_to(*offset, alignment);
+    write_or_die(f, zeros, aligned - *offset, filename);
+    *offset = aligned;
+}
+
+void module_image_writer_write(module_image_writer_t* writer, const char* filename)
+{
+    module_image_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MODULE_IMAGE_MAGIC, sizeof(header.magic));
+    header.byte_order = MODULE_IMAGE_BYTE_ORDER;
+    header.format_version = MODULE_IMAGE_FORMAT_VERSION;
+    header.strings_offset = sizeof(header);
+    header.strings_size = writer->strings_size;
+
+    // Compute the layout of the sections
+    size_t offset = align_to(sizeof(header) + writer->strings_size, 8);
+    int i;
+    for (i = 0; i < MIS_NUM_SECTIONS; i++)
+    {
+        module_image_writer_section_t* s = &writer->sections[i];
+        qsort(s->rows, s->num_rows, sizeof(*s->rows), row_cmp);
+
+        header.sections[i].num_columns = s->num_columns;
+        header.sections[i].num_rows = s->num_rows;
+
+        header.sections[i].column_names_offset = offset;
+        offset += s->num_columns * sizeof(uint32_t);
+
+        offset = align_to(offset, 8);
+        header.sections[i].keys_offset = offset;
+        offset += s->num_rows * sizeof(uint64_t);
+
+        header.sections[i].cells_offset = offset;
+        offset += (size_t)s->num_rows * s->num_columns * sizeof(uint32_t);
+
+        offset = align_to(offset, 8);
+    }
+    header.file_size = offset;
+
+    // The image is written aside and renamed over the former one, so a
+    // concurrent reader never sees a partial image and whoever has the
+    // former one mapped can keep reading it
+    const char* temporal_filename = NULL;
+    uniquestr_sprintf(&temporal_filename, "%s.%d", filename, (int)getpid());
+
+    FILE* f = fopen(temporal_filename, "wb");
+    if (f == NULL)
+    {
+        fatal_error("Cannot create module image '%s' (%s)\n", filename, strerror(errno));
+    }
+
+    offset = 0;
+    write_or_die(f, &header, sizeof(header), filename);
+    write_or_die(f, writer->strings, writer->strings_size, filename);
+    offset += sizeof(header) + writer->strings_size;
+    write_padding(f, &offset, 8, filename);
+
+    for (i = 0; i < MIS_NUM_SECTIONS; i++)
+    {
+        module_image_writer_section_t* s = &writer->sections[i];
+
+        write_or_die(f, s->column_names, s->num_columns * sizeof(uint32_t), filename);
+        offset += s->num_columns * sizeof(uint32_t);
+        write_padding(f, &offset, 8, filename);
+
+        int j;
+        for (j = 0; j < s->num_rows; j++)
+        {
+            write_or_die(f, &s->rows[j].key, sizeof(uint64_t), filename);
+        }
+        offset += s->num_rows * sizeof(uint64_t);
+
+        for (j = 0; j < s->num_rows; j++)
+        {
+            write_or_die(f, s->rows[j].cells, s->num_columns * sizeof(uint32_t), filename);
+            DELETE(s->rows[j].cells);
+        }
+        offset += (size_t)s->num_rows * s->num_columns * sizeof(uint32_t);
+        write_padding(f, &offset, 8, filename);
+
+        DELETE(s->rows);
+        DELETE(s->column_names);
+    }
+
+    ERROR_CONDITION(offset != header.file_size, "Mismatch in the size of the module image", 0);
+
+    if (fclose(f) != 0)
+    {
+        remove(temporal_filename);
+        fatal_error("Error while writing module image '%s' (%s)\n", filename, strerror(errno));
+    }
+
+    if (rename(temporal_filename, filename) != 0)
+    {
+        int rename_errno = errno;
+        remove(temporal_filename);
+        fatal_error("Cannot create module image '%s' (%s)\n", filename, strerror(rename_errno));
+    }
+
+    DELETE(writer->strings);
+    DELETE(writer->string_hash);
+    DELETE(writer);
+}
@@ -0,0 +1,97 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+#ifndef FORTRAN03_MODULES_IMAGE_H
+#define FORTRAN03_MODULES_IMAGE_H
+
+#include "cxx-macros.h"
+
+#include <stdint.h>
+
+MCXX_BEGIN_DECLS
+
+// A module image is a read-only, memory-mappable rendition of a module file.
+//
+// It is made of a string table and a fixed set of sections. Every section is
+// a table of rows, sorted by a 64-bit key, whose cells are references into
+// the string table. Rows are found by binary search on the key so loading
+// an entity does not require parsing anything but the cells actually used.
+typedef
+enum module_image_section_tag
+{
+    MIS_INFO = 0,
+    MIS_SYMBOL,
+    MIS_ATTRIBUTES,
+    MIS_SCOPE,
+    MIS_DECL_CONTEXT,
+    MIS_AST,
+    MIS_TYPE,
+    MIS_CONST_VALUE,
+    MIS_RAW_CONST_VALUE,
+    MIS_MULTI_CONST_VALUE,
+    MIS_MODULE_EXTRA_NAME,
+    MIS_MODULE_EXTRA_DATA,
+    MIS_NAME_INDEX,
+    MIS_MODULE_INDEX,
+    MIS_NUM_SECTIONS
+} module_image_section_t;
+
+typedef struct module_image_tag module_image_t;
+typedef struct module_image_writer_tag module_image_writer_t;
+
+// Reading
+char module_image_file_is_image(const char* filename);
+
+// Returns NULL if the file cannot be mapped or it is not a valid image
+module_image_t* module_image_open(const char* filename);
+void module_image_close(module_image_t* image);
+
+int module_image_num_columns(module_image_t* image, module_image_section_t section);
+const char** module_image_column_names(module_image_t* image, module_image_section_t section);
+int module_image_num_rows(module_image_t* image, module_image_section_t section);
+
+// Sets the range of rows [*first, *first + *count) whose key is key
+char module_image_find_rows(module_image_t* image, module_image_section_t section,
+        uint64_t key, int *first, int *count);
+
+// Cells are NUL-terminated and point into the mapping. NULL cells are NULL
+void module_image_get_row(module_image_t* image, module_image_section_t section,
+        int row, const char** values);
+
+// Writing
+module_image_writer_t* module_image_writer_new(void);
+void module_image_writer_begin_section(module_image_writer_t* writer,
+        module_image_section_t section,
+        int num_columns, const char** column_names);
+// A NULL value is a NULL cell. Rows with the same key keep their insertion order
+void module_image_writer_add_row(module_image_writer_t* writer,
+        uint64_t key, const char** values, const int* lengths);
+// Writes the image and frees the writer
+void module_image_writer_write(module_image_writer_t* writer, const char* filename);
+
+MCXX_END_DECLS
+
+#endif // FORTRAN03_MODULES_IMAGE_H
@@ -30,6 +30,7 @@
 
 #include "fortran03-modules.h"
 #include "fortran03-modules-data.h"
+#include "fortran03-modules-image.h"
 #include "fortran03-buildscope.h"
 #include "cxx-limits.h"
 #include "cxx-utils.h"
@@ -48,7 +49,10 @@
 #include <sqlite3.h>
 #include <errno.h>
 #include <string.h>
+#include <ctype.h>
 #include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 
 #ifdef Q
  #error Q cannot be defined here
@@ -68,10 +72,13 @@ enum { CURRENT_MODULE_VERSION = 22 };
   #define Q "%Q"
 #endif
 
-static void create_storage(sqlite3**, scope_entry_t*);
+static void create_storage(sqlite3**, const char**, scope_entry_t*);
 static void init_storage(sqlite3*);
 static void dispose_storage(sqlite3*);
+static void finalize_statements(void);
+static void write_module_image(sqlite3*, const char*, sqlite3_uint64);
 static void prepare_statements(sqlite3*);
+static void module_cache_flush(void);
 
 static void start_transaction(sqlite3*);
 static void end_transaction(sqlite3*);
@@ -150,6 +157,10 @@ static void insert_extra_attr_data(sqlite3* handle, scope_entry_t* symbol, const
         sqlite3_uint64 (*fun)(sqlite3* handle, void* data));
 static sqlite3_uint64 insert_default_argument_info_ptr(sqlite3* handle, void* p);
 static char query_contains_field(int ncols, char** names, const char* field_name, int *result);
+static int run_select_query(sqlite3* handle, const char* query,
+        int (*fun)(void*, int, char**, char**),
+        void * data,
+        char ** errmsg);
 static void run_query(sqlite3* handle, const char* query);
 static const decl_context_t* load_decl_context(sqlite3* handle, sqlite3_uint64 oid);
 
@@ -335,6 +346,86 @@ static sqlite3_uint64 module_oid_being_loaded = 0;
 
 static rb_red_blk_tree * _oid_map = NULL;
 
+// Image being read, NULL when reading a SQLite module file
+static module_image_t* _module_image = NULL;
+
+// Members of modules read from an image are loaded on demand. The image and
+// the oid map of the module are kept until all its members have been loaded
+typedef
+struct lazy_module_tag
+{
+    scope_entry_t* module;
+    sqlite3_uint64 module_oid;
+    module_image_t* image;
+    rb_red_blk_tree* oid_map;
+    char shared;
+} lazy_module_t;
+
+static int _num_lazy_modules = 0;
+static lazy_module_t** _lazy_modules = NULL;
+
+// Modules written in this compilation are staged in an in-memory database
+// from which the image is written. This way TL can still extend them
+typedef
+struct staged_module_tag
+{
+    const char* filename;
+    sqlite3* handle;
+    sqlite3_uint64 module_oid;
+} staged_module_t;
+
+static int _num_staged_modules = 0;
+static staged_module_t** _staged_modules = NULL;
+
+static staged_module_t* get_staged_module(const char* filename)
+{
+    int i;
+    for (i = 0; i < _num_staged_modules; i++)
+    {
+        if (strcmp(_staged_modules[i]->filename, filename) == 0)
+            return _staged_modules[i];
+    }
+    return NULL;
+}
+
+static void stage_module_storage(const char* filename, sqlite3* handle, sqlite3_uint64 module_oid)
+{
+    staged_module_t* staged_module = get_staged_module(filename);
+    if (staged_module == NULL)
+    {
+        staged_module = NEW0(staged_module_t);
+        staged_module->filename = uniquestr(filename);
+        P_LIST_ADD(_staged_modules, _num_staged_modules, staged_module);
+    }
+    else
+    {
+        // The module has been written again
+        sqlite3_close(staged_module->handle);
+    }
+
+    staged_module->handle = handle;
+    staged_module->module_oid = module_oid;
+}
+
+static sqlite3_uint64 write_module_storage(sqlite3** handle, const char** filename, scope_entry_t* module)
+{
+    create_storage(handle, filename, module);
+
+    start_transaction(*handle);
+
+    init_storage(*handle);
+
+    module_being_emitted = module;
+    sqlite3_uint64 module_oid = insert_symbol(*handle, module);
+    module_being_emitted = NULL;
+
+    finish_module_file(*handle, module->symbol_name, module_oid);
+
+    end_transaction(*handle);
+
+    return module_oid;
+}
+
 void dump_module_info(scope_entry_t* module)
 {
     ERROR_CONDITION(module->kind != SK_MODULE, "Invalid symbol!", 0);
@@ -352,22 +443,24 @@ void dump_module_info(scope_entry_t* module)
     timing_t timing_dump_module;
     timing_start(&timing_dump_module);
 
-    sqlite3* handle = NULL;
-    create_storage(&handle, module);
-
-    start_transaction(handle);
-
-    init_storage(handle);
-
-    module_being_emitted = module;
-    sqlite3_uint64 module_oid = insert_symbol(handle, module);
-    module_being_emitted = NULL;
+    // Modules loaded so far may refer to the one being written
+    module_cache_flush();
 
-    finish_module_file(handle, module->symbol_name, module_oid);
+    sqlite3* handle = NULL;
+    const char* filename = NULL;
+    sqlite3_uint64 module_oid = write_module_storage(&handle, &filename, module);
 
-    end_transaction(handle);
+    if (!CURRENT_CONFIGURATION->fortran_binary_modules)
+    {
+        dispose_storage(handle);
+    }
+    else
+    {
+        write_module_image(handle, filename, module_oid);
 
-    dispose_storage(handle);
+        finalize_statements();
+        stage_module_storage(filename, handle, module_oid);
+    }
 
     timing_end(&timing_dump_module);
 
@@ -408,6 +501,266 @@ static int int64cmp_vptr(const void* ptr1, const void* ptr2)
         return 0;
 }
 
+// With --module-cache, modules loaded from files are kept for the
+// translation units compiled later by this process. The symbols are not
+// copied, so changes done to them by a translation unit are seen by the
+// next ones. Since intrinsic modules are built again in every
+// translation unit, a module is shared only if neither it nor any of the
+// modules it refers to (recursively) refers to an intrinsic module
+typedef
+enum module_cache_sharing_tag
+{
+    MCS_UNKNOWN = 0,
+    MCS_CHECKING,
+    MCS_SHAREABLE,
+    MCS_NOT_SHAREABLE,
+} module_cache_sharing_t;
+
+typedef
+struct module_cache_entry_tag
+{
+    const char* name;
+
+    // File found by the driver and its state when the entry was created
+    const char* located_filename;
+    dev_t device;
+    ino_t inode;
+    off_t size;
+    time_t mtime;
+    compilation_configuration_t* configuration;
+
+    // Files given by driver_fortran_retrieve_module
+    const char* filename;
+    const char* wrap_filename;
+
+    module_cache_sharing_t sharing;
+
+    // Modules referred in the module file, including itself
+    int num_used_modules;
+    const char** used_modules;
+
+    // Symbol shared by all the translation units. It may not be defined yet
+    // if it has only been referred from other modules
+    scope_entry_t* module;
+} module_cache_entry_t;
+
+static rb_red_blk_tree* _module_cache = NULL;
+
+// Nonzero while loading (eagerly or lazily) a module that is shared
+static char _loading_shared_module = 0;
+
+static char module_cache_is_enabled(void)
+{
+    return CURRENT_CONFIGURATION->fortran_module_cache;
+}
+
+static void module_cache_flush(void)
+{
+    if (_module_cache == NULL)
+        return;
+
+    DEBUG_CODE()
+    {
+        fprintf(stderr, "FORTRAN-MODULES: Flushing the cache of loaded modules\n");
+    }
+
+    // Entries are not freed as a module being loaded may still use them
+    rb_tree_destroy(_module_cache);
+    _module_cache = NULL;
+}
+
+static module_cache_entry_t* module_cache_get_entry(const char* module_name)
+{
+    if (!module_cache_is_enabled()
+            || fortran_is_intrinsic_module_name(module_name))
+        return NULL;
+
+    const char* located_filename = NULL;
+    char is_wrap = 0;
+    driver_fortran_locate_module(module_name, &located_filename, &is_wrap);
+
+    struct stat st;
+    if (located_filename == NULL
+            || stat(located_filename, &st) != 0)
+        return NULL;
+
+    if (_module_cache == NULL)
+    {
+        _module_cache = rb_tree_create((int (*)(const void*, const void*))strcasecmp,
+                null_dtor_func, null_dtor_func);
+    }
+
+    rb_red_blk_node* query = rb_tree_query(_module_cache, module_name);
+    if (query != NULL)
+    {
+        module_cache_entry_t* entry = (module_cache_entry_t*)rb_node_get_info(query);
+        if (strcmp(entry->located_filename, located_filename) == 0
+                && entry->device == st.st_dev
+                && entry->inode == st.st_ino
+                && entry->size == st.st_size
+                && entry->mtime == st.st_mtime
+                && entry->configuration == CURRENT_CONFIGURATION)
+            return entry;
+
+        DEBUG_CODE()
+        {
+            fprintf(stderr, "FORTRAN-MODULES: Module file '%s' has changed\n", located_filename);
+        }
+
+        // Other cached modules may refer to the stale module so start afresh
+        module_cache_flush();
+        _module_cache = rb_tree_create((int (*)(const void*, const void*))strcasecmp,
+                null_dtor_func, null_dtor_func);
+    }
+
+    module_cache_entry_t* entry = NEW0(module_cache_entry_t);
+    entry->name = strtolower(module_name);
+    entry->located_filename = located_filename;
+    entry->device = st.st_dev;
+    entry->inode = st.st_ino;
+    entry->size = st.st_size;
+    entry->mtime = st.st_mtime;
+    entry->configuration = CURRENT_CONFIGURATION;
+
+    rb_tree_insert(_module_cache, entry->name, entry);
+
+    return entry;
+}
+
+static int get_used_module_name(void* datum,
+        int ncols UNUSED_PARAMETER,
+        char **values,
+        char **names UNUSED_PARAMETER)
+{
+    module_cache_entry_t* entry = (module_cache_entry_t*)datum;
+    P_LIST_ADD(entry->used_modules, entry->num_used_modules, uniquestr(values[0]));
+    return 0;
+}
+
+static void load_used_modules(module_cache_entry_t* entry)
+{
+    if (module_image_file_is_image(entry->filename))
+    {
+        module_image_t* image = module_image_open(entry->filename);
+        if (image == NULL)
+        {
+            fatal_error("Module file '%s' is not a valid module image\n", entry->filename);
+        }
+
+        int i, num_rows = module_image_num_rows(image, MIS_MODULE_INDEX);
+        for (i = 0; i < num_rows; i++)
+        {
+            const char* values[1];
+            module_image_get_row(image, MIS_MODULE_INDEX, i, values);
+            get_used_module_name(entry, 1, (char**)values, NULL);
+        }
+
+        module_image_close(image);
+    }
+    else
+    {
+        sqlite3* handle = NULL;
+        if (sqlite3_open(entry->filename, &handle) != SQLITE_OK)
+        {
+            fatal_error("Error while opening module database '%s' (%s)\n", entry->filename, sqlite3_errmsg(handle));
+        }
+
+        char* query = sqlite3_mprintf(
+                "SELECT str1.string FROM symbol s, string_table str1, string_table str2 "
+                "WHERE str1.oid = s.name AND str2.oid = s.kind AND str2.string = " Q ";",
+                symbol_kind_to_str(SK_MODULE));
+        char* errmsg = NULL;
+        run_select_query(handle, query, get_used_module_name, entry, &errmsg);
+        sqlite3_free(query);
+
+        sqlite3_close(handle);
+    }
+}
+
+static char module_cache_entry_is_shareable(module_cache_entry_t* entry)
+{
+    if (entry->sharing == MCS_UNKNOWN)
+    {
+        entry->sharing = MCS_CHECKING;
+
+        driver_fortran_retrieve_module(entry->name, &entry->filename, &entry->wrap_filename);
+
+        char shareable = (entry->filename != NULL);
+        if (shareable)
+        {
+            load_used_modules(entry);
+
+            int i;
+            for (i = 0; i < entry->num_used_modules && shareable; i++)
+            {
+                if (strcasecmp(entry->used_modules[i], entry->name) == 0)
+                    continue;
+
+                module_cache_entry_t* used_entry = module_cache_get_entry(entry->used_modules[i]);
+                shareable = (used_entry != NULL
+                        && module_cache_entry_is_shareable(used_entry));
+            }
+        }
+
+        entry->sharing = shareable ? MCS_SHAREABLE : MCS_NOT_SHAREABLE;
+
+        DEBUG_CODE()
+        {
+            fprintf(stderr, "FORTRAN-MODULES: Module '%s' %s be shared between files\n",
+                    entry->name, shareable ? "can" : "cannot");
+        }
+    }
+
+    return (entry->sharing == MCS_SHAREABLE);
+}
+
+// Modules of this translation unit that are not the shared ones (i.e. those
+// defined in it) cannot be referred by a shared module
+static char module_cache_conflicts_with_translation_unit(module_cache_entry_t* entry)
+{
+    int i;
+    for (i = 0; i < entry->num_used_modules; i++)
+    {
+        rb_red_blk_node* query = rb_tree_query(CURRENT_COMPILED_FILE->module_file_cache,
+                entry->used_modules[i]);
+        if (query == NULL)
+            continue;
+
+        rb_red_blk_node* shared_query = rb_tree_query(_module_cache, entry->used_modules[i]);
+        scope_entry_t* shared_module = (shared_query != NULL)
+            ? ((module_cache_entry_t*)rb_node_get_info(shared_query))->module
+            : NULL;
+
+        if ((scope_entry_t*)rb_node_get_info(query) != shared_module)
+            return 1;
+    }
+
+    return 0;
+}
+
+// Returns the symbol of a shareable module as known by other translation
+// units, if any
+static scope_entry_t* module_cache_get_symbol(const char* module_name)
+{
+    module_cache_entry_t* entry = module_cache_get_entry(module_name);
+    if (entry == NULL
+            || !module_cache_entry_is_shareable(entry))
+        return NULL;
+
+    return entry->module;
+}
+
+static void module_cache_register_symbol(scope_entry_t* module)
+{
+    module_cache_entry_t* entry = module_cache_get_entry(module->symbol_name);
+    if (entry == NULL
+            || !module_cache_entry_is_shareable(entry)
+            || entry->module != NULL)
+        return;
+
+    entry->module = module;
+}
+
 static void load_storage(sqlite3** handle, const char* filename)
 {
     sqlite3_uint64 result = sqlite3_open(filename, handle);
@@ -430,8 +783,48 @@ void load_module_info(const char* module_name, scope_entry_t** module)
     ERROR_CONDITION(module == NULL, "Invalid parameter", 0);
     *module = NULL;
 
+    module_cache_entry_t* cache_entry = module_cache_get_entry(module_name);
+    char shared = (cache_entry != NULL
+            && module_cache_entry_is_shareable(cache_entry)
+            && !module_cache_conflicts_with_translation_unit(cache_entry));
+
+    if (shared
+            && cache_entry->module != NULL
+            && cache_entry->module->defined)
+    {
+        DEBUG_CODE()
+        {
+            fprintf(stderr, "FORTRAN-MODULES: Module '%s' was already loaded by a previous file\n",
+                    module_name);
+        }
+        if (CURRENT_CONFIGURATION->verbose)
+        {
+            fprintf(stderr, "Reusing module '%s' loaded by a previous file\n", module_name);
+        }
+
+        *module = cache_entry->module;
+
+        if (cache_entry->wrap_filename != NULL
+                && !symbol_entity_specs_get_is_builtin(*module))
+        {
+            P_LIST_ADD(CURRENT_COMPILED_FILE->module_files_to_hide,
+                    CURRENT_COMPILED_FILE->num_module_files_to_hide,
+                    cache_entry->wrap_filename);
+        }
+        return;
+    }
+
     const char *filename = NULL, *wrap_filename = NULL; 
-    driver_fortran_retrieve_module(module_name, &filename, &wrap_filename);
+    if (cache_entry != NULL)
+    {
+        // Already retrieved when checking if the module can be shared
+        filename = cache_entry->filename;
+        wrap_filename = cache_entry->wrap_filename;
+    }
+    else
+    {
+        driver_fortran_retrieve_module(module_name, &filename, &wrap_filename);
+    }
 
     if (filename == NULL)
     {
@@ -458,9 +851,32 @@ void load_module_info(const char* module_name, scope_entry_t** module)
     timing_t timing_load_module;
     timing_start(&timing_load_module);
 
+    // Trees of modules kept for other files cannot live in the arena of this file
+    mem_arena_t* ast_arena = ast_get_current_arena();
+    if (module_cache_is_enabled())
+        ast_set_current_arena(NULL);
+
+    char was_loading_shared_module = _loading_shared_module;
+    _loading_shared_module = shared;
+
     sqlite3* handle = NULL;
+    module_image_t* image = NULL;
+
+    if (module_image_file_is_image(filename))
+    {
+        image = module_image_open(filename);
+        if (image == NULL)
+        {
+            fatal_error("Module file '%s' is not a valid module image\n", filename);
+        }
 
-    load_storage(&handle, filename);
+        _module_image = image;
+        _oid_map = rb_tree_create(int64cmp_vptr, null_dtor_func, null_dtor_func);
+    }
+    else
+    {
+        load_storage(&handle, filename);
+    }
 
     module_info_t minfo;
     memset(&minfo, 0, sizeof(minfo));
@@ -473,9 +889,12 @@ void load_module_info(const char* module_name, scope_entry_t** module)
                 filename, minfo.version, CURRENT_MODULE_VERSION);
     }
 
-    prepare_statements(handle);
+    if (image == NULL)
+    {
+        prepare_statements(handle);
 
-    start_transaction(handle);
+        start_transaction(handle);
+    }
 
     module_oid_being_loaded = minfo.module_oid;
     *module = load_symbol(handle, minfo.module_oid);
@@ -483,9 +902,42 @@ void load_module_info(const char* module_name, scope_entry_t** module)
 
     load_extra_data_from_module(handle, *module);
 
-    end_transaction(handle);
+    if (image == NULL)
+    {
+        end_transaction(handle);
+
+        dispose_storage(handle);
+    }
+    else
+    {
+        _module_image = NULL;
+
+        char has_lazy_members = 0;
+        int i;
+        for (i = 0; i < _num_lazy_modules && !has_lazy_members; i++)
+        {
+            has_lazy_members = (_lazy_modules[i]->image == image);
+        }
+        if (!has_lazy_members)
+        {
+            module_image_close(image);
+        }
+    }
 
-    dispose_storage(handle);
+    _loading_shared_module = was_loading_shared_module;
+    ast_set_current_arena(ast_arena);
+
+    if (shared)
+    {
+        cache_entry->module = *module;
+    }
+    else if (cache_entry != NULL
+            && cache_entry->module == *module)
+    {
+        // The symbol known by other files has been loaded with modules of
+        // this file, it cannot be shared anymore
+        module_cache_flush();
+    }
 
     timing_end(&timing_load_module);
 
@@ -509,27 +961,37 @@ void load_module_info(const char* module_name, scope_entry_t** module)
 
 }
 
-static void create_storage(sqlite3** handle, scope_entry_t* module)
+static void create_storage(sqlite3** handle, const char** module_filename, scope_entry_t* module)
 {
     const char* filename = NULL;
     driver_fortran_register_module(module->symbol_name, &filename, 
             /* is_intrinsic */ symbol_entity_specs_get_is_builtin(module));
+    *module_filename = filename;
 
     DEBUG_CODE()
     {
         fprintf(stderr, "FORTRAN-MODULES: File used will be '%s'\n", filename);
     }
 
-    // Make sure the file has been removed
-    if (access(filename, F_OK) == 0)
+    if (!CURRENT_CONFIGURATION->fortran_binary_modules)
     {
-        if (remove(filename) != 0)
+        // Make sure the file has been removed
+        if (access(filename, F_OK) == 0)
         {
-            fatal_error("Error while removing old module '%s' (%s)\n", filename, strerror(errno));
+            if (remove(filename) != 0)
+            {
+                fatal_error("Error while removing old module '%s' (%s)\n", filename, strerror(errno));
+            }
         }
-    }
 
-    load_storage(handle, filename);
+        load_storage(handle, filename);
+    }
+    else
+    {
+        // The image is written from this database once the module is
+        // complete and then replaces the old file
+        load_storage(handle, ":memory:");
+    }
 }
 
 static int run_select_query(sqlite3* handle, const char* query, 
@@ -877,8 +1339,21 @@ static int get_module_info_(void *datum,
     return 0;
 }
 
+static int run_select_image(module_image_section_t section, sqlite3_uint64 key,
+        int (*fun)(void* datum, int ncols, char** values, char **names),
+        void *datum);
+
 static void get_module_info(sqlite3* handle, module_info_t* minfo)
 {
+    if (_module_image != NULL)
+    {
+        if (run_select_image(MIS_INFO, 0, get_module_info_, minfo) != 1)
+        {
+            fatal_error("Invalid module image: it does not contain module information\n");
+        }
+        return;
+    }
+
     const char * module_info_query = "SELECT module, date, version, build, root_symbol FROM info LIMIT 1;";
 
     char* errmsg = NULL;
@@ -1807,27 +2282,98 @@ static int run_select_query_prepared(sqlite3* handle, sqlite3_stmt* prepared_stm
     return SQLITE_OK;
 }
 
-static void get_extended_attribute(sqlite3* handle, sqlite3_uint64 oid, const char* attr_name,
-        void *extra_info,
-        int (*get_extra_info_fun)(void *datum, int ncols, char **values, char **names))
+static int run_select_image(module_image_section_t section, sqlite3_uint64 key,
+        int (*fun)(void* datum, int ncols, char** values, char **names),
+        void *datum)
 {
-    sqlite3_bind_int64(_get_extended_attr_stmt, 1, oid);
-    sqlite3_bind_text (_get_extended_attr_stmt, 2, attr_name, -1, SQLITE_STATIC);
+    // Unlike run_select_query_prepared, here there are no reentrancy issues:
+    // the rows of an image are immutable so the callback is run directly on
+    // the mapped cells
+    int first = 0, count = 0;
+    module_image_find_rows(_module_image, section, key, &first, &count);
 
-    const char * errmsg = NULL;
-    if (run_select_query_prepared(handle, _get_extended_attr_stmt, get_extra_info_fun, extra_info, &errmsg) != SQLITE_OK)
+    int ncols = module_image_num_columns(_module_image, section);
+    const char** names = module_image_column_names(_module_image, section);
+
+    int i;
+    for (i = first; i < first + count; i++)
     {
-        fatal_error("Error while running query: %s\n", errmsg);
+        const char* values[ncols + 1];
+        module_image_get_row(_module_image, section, i, values);
+
+        // Callbacks do not modify values or names
+        fun(datum, ncols, (char**)values, (char**)names);
     }
+
+    return count;
 }
 
-static sqlite3_uint64 insert_scope(sqlite3* handle, scope_t* scope)
+static void register_lazy_module(sqlite3_uint64 module_oid)
 {
-    if (scope == NULL)
-        return 0;
+    lazy_module_t* lazy_module = NEW0(lazy_module_t);
+    lazy_module->module = (scope_entry_t*)get_ptr_of_oid(NULL, module_oid);
+    lazy_module->module_oid = module_oid;
+    lazy_module->image = _module_image;
+    lazy_module->oid_map = _oid_map;
+    lazy_module->shared = _loading_shared_module;
 
-    if (oid_already_inserted_scope(handle, scope))
-    {
+    ERROR_CONDITION(lazy_module->module == NULL, "Module has not been loaded yet", 0);
+
+    P_LIST_ADD(_lazy_modules, _num_lazy_modules, lazy_module);
+}
+
+static void get_extended_attribute(sqlite3* handle, sqlite3_uint64 oid, const char* attr_name,
+        void *extra_info,
+        int (*get_extra_info_fun)(void *datum, int ncols, char **values, char **names))
+{
+    if (_module_image != NULL)
+    {
+        if (oid == module_oid_being_loaded
+                && strcmp(attr_name, "related_symbols") == 0)
+        {
+            // Do not load the members of the module now but when they are
+            // looked up, see load_module_members_by_name
+            register_lazy_module(oid);
+            return;
+        }
+
+        int first = 0, count = 0;
+        module_image_find_rows(_module_image, MIS_ATTRIBUTES, oid, &first, &count);
+
+        const char* names[] = { "value", NULL };
+        int i;
+        for (i = first; i < first + count; i++)
+        {
+            // name, value
+            const char* row[2];
+            module_image_get_row(_module_image, MIS_ATTRIBUTES, i, row);
+
+            if (strcmp(row[0], attr_name) == 0)
+            {
+                const char* values[] = { row[1], NULL };
+                get_extra_info_fun(extra_info, 1, (char**)values, (char**)names);
+            }
+        }
+        return;
+    }
+
+    sqlite3_bind_int64(_get_extended_attr_stmt, 1, oid);
+    sqlite3_bind_text (_get_extended_attr_stmt, 2, attr_name, -1, SQLITE_STATIC);
+
+    const char * errmsg = NULL;
+    if (run_select_query_prepared(handle, _get_extended_attr_stmt, get_extra_info_fun, extra_info, &errmsg) != SQLITE_OK)
+    {
+        fatal_error("Error while running query: %s\n", errmsg);
+    }
+}
+
+static sqlite3_uint64 insert_scope(sqlite3* handle, scope_t* scope)
+{
+    if (scope == NULL)
+        return 0;
+
+    if (oid_already_inserted_scope(handle, scope))
+    {
         return (sqlite3_uint64)(uintptr_t)scope;
     }
  
@@ -2036,12 +2582,28 @@ static int get_symbol(void *datum,
     // Early checks to use already loaded symbols
     if (symbol_kind == SK_MODULE)
     {
+        fortran_sign_in_intrinsic_module_on_demand(strtolower(name));
         rb_red_blk_node* query = rb_tree_query(CURRENT_COMPILED_FILE->module_file_cache, strtolower(name));
-        // Check if this symbol is in the cache and reuse it 
+        scope_entry_t* module_symbol = NULL;
         if (query != NULL)
+        {
+            module_symbol = (scope_entry_t*)rb_node_get_info(query);
+        }
+        else if (oid != module_oid_being_loaded
+                || _loading_shared_module)
+        {
+            // Reuse the symbol of the module used by previous files
+            module_symbol = module_cache_get_symbol(name);
+            if (module_symbol != NULL)
+            {
+                rb_tree_insert(CURRENT_COMPILED_FILE->module_file_cache, strtolower(name), module_symbol);
+            }
+        }
+
+        // Check if this symbol is in the cache and reuse it 
+        if (module_symbol != NULL)
         {
             // fprintf(stderr, "HIT FOR module '%s' (OID=%llu)\n", strtolower(name), oid);
-            scope_entry_t* module_symbol = (scope_entry_t*)rb_node_get_info(query);
             (*result) = module_symbol;
             insert_map_ptr(handle, oid, (*result));
 
@@ -2078,6 +2640,9 @@ static int get_symbol(void *datum,
 
         if (in_module != NULL)
         {
+            // The member may still be pending in the image of its module
+            load_module_members_by_name(in_module, name);
+
             for (i = 0; i < symbol_entity_specs_get_num_related_symbols(in_module); i++)
             {
                 scope_entry_t* member = symbol_entity_specs_get_related_symbols_num(in_module, i);
@@ -2211,6 +2776,12 @@ static int get_symbol(void *datum,
     {
         rb_tree_insert(CURRENT_COMPILED_FILE->module_file_cache, strtolower((*result)->symbol_name), (*result));
 
+        if (module_oid_being_loaded != oid
+                || _loading_shared_module)
+        {
+            module_cache_register_symbol(*result);
+        }
+
         if (module_oid_being_loaded == oid)
         {
             // A module is defined once it is loaded
@@ -2261,6 +2832,17 @@ static scope_entry_t* load_symbol(sqlite3* handle, sqlite3_uint64 oid)
         }
     }
 
+    if (_module_image != NULL)
+    {
+        symbol_handle_t symbol_handle;
+        memset(&symbol_handle, 0, sizeof(symbol_handle));
+
+        int num_rows = run_select_image(MIS_SYMBOL, oid, get_symbol, &symbol_handle);
+        ERROR_CONDITION(num_rows != 1, "Invalid number of symbols (%d) with oid %llu\n", num_rows, oid);
+
+        return symbol_handle.symbol;
+    }
+
     // Bind the oid parameter
     sqlite3_bind_int64(_load_symbol_stmt, 1, oid);
 
@@ -2378,6 +2960,12 @@ static scope_t* load_scope(sqlite3* handle, sqlite3_uint64 oid)
     memset(&info, 0, sizeof(info));
     info.handle = handle;
 
+    if (_module_image != NULL)
+    {
+        run_select_image(MIS_SCOPE, oid, get_scope_, &info);
+        return info.scope;
+    }
+
     sqlite3_bind_int64(_select_scope_stmt, 1, oid);
     const char *errmsg = NULL;
 
@@ -2409,6 +2997,15 @@ static int get_current_scope_oid_of_decl_context_oid_(void *datum,
     return 0;
 }
 
+static int get_current_scope_oid_of_decl_context_row_(void *datum, 
+        int ncols, 
+        char **values, 
+        char **names)
+{
+    // values[8] is current_scope, see get_decl_context_
+    return get_current_scope_oid_of_decl_context_oid_(datum, ncols - 8, values + 8, names + 8);
+}
+
 static sqlite3_uint64 get_current_scope_oid_of_decl_context_oid(sqlite3* handle, sqlite3_uint64 decl_context_oid)
 {
     if (decl_context_oid == 0)
@@ -2416,6 +3013,13 @@ static sqlite3_uint64 get_current_scope_oid_of_decl_context_oid(sqlite3* handle,
 
     sqlite3_uint64 result_oid = 0;
 
+    if (_module_image != NULL)
+    {
+        run_select_image(MIS_DECL_CONTEXT, decl_context_oid,
+                get_current_scope_oid_of_decl_context_row_, &result_oid);
+        return result_oid;
+    }
+
     const char *errmsg = NULL;
     sqlite3_bind_int64(_get_current_scope_of_decl_context_stmt, 1, decl_context_oid);
     if (run_select_query_prepared(handle, _get_current_scope_of_decl_context_stmt,
@@ -2470,6 +3074,12 @@ static const decl_context_t* load_decl_context(sqlite3* handle, sqlite3_uint64 d
     decl_context_info.decl_context = NULL;
     decl_context_info.handle = handle;
 
+    if (_module_image != NULL)
+    {
+        run_select_image(MIS_DECL_CONTEXT, decl_context_oid, get_decl_context_, &decl_context_info);
+        return decl_context_info.decl_context;
+    }
+
     const char *errmsg = NULL;
     sqlite3_bind_int64(_select_decl_context_stmt, 1, decl_context_oid);
     if (run_select_query_prepared(handle, _select_decl_context_stmt, get_decl_context_, &decl_context_info, &errmsg) != SQLITE_OK)
@@ -2568,6 +3178,12 @@ static AST load_ast(sqlite3* handle, sqlite3_uint64 oid)
     memset(&query_handle, 0, sizeof(query_handle));
     query_handle.handle = handle;
 
+    if (_module_image != NULL)
+    {
+        run_select_image(MIS_AST, oid, get_ast, &query_handle);
+        return query_handle.a;
+    }
+
     const char *errmsg = NULL;
     sqlite3_bind_int64(_select_ast_stmt, 1, oid);
     if (run_select_query_prepared(handle, _select_ast_stmt, get_ast, &query_handle, &errmsg) != SQLITE_OK)
@@ -2869,6 +3485,12 @@ static type_t* load_type(sqlite3* handle, sqlite3_uint64 oid)
     memset(&type_handle, 0, sizeof(type_handle));
     type_handle.handle = handle;
 
+    if (_module_image != NULL)
+    {
+        run_select_image(MIS_TYPE, oid, get_type, &type_handle);
+        return type_handle.type;
+    }
+
     const char* errmsg = NULL;
     sqlite3_bind_int64(_select_type_stmt, 1, oid);
     if (run_select_query_prepared(handle, _select_type_stmt, get_type, &type_handle, &errmsg) != SQLITE_OK)
@@ -2988,6 +3610,106 @@ static sqlite3_uint64 insert_const_value(sqlite3* handle, const_value_t* value)
     return 0;
 }
 
+static const_value_t* build_multi_const_value(int multival_kind,
+        int num_elems,
+        const_value_t** list,
+        type_t* struct_type)
+{
+    const_value_t* result = NULL;
+
+    switch (multival_kind)
+    {
+        case CKT_ARRAY:
+            {
+                result = const_value_make_array(num_elems, list);
+                break;
+            }
+        case CKT_VECTOR:
+            {
+                result = const_value_make_vector(num_elems, list);
+                break;
+            }
+        case CKT_STRUCT:
+            {
+                result = const_value_make_struct(num_elems, list, struct_type);
+                break;
+            }
+        case CKT_COMPLEX:
+            {
+                ERROR_CONDITION(num_elems != 2, "Invalid complex constant!", 0);
+
+                result = const_value_make_complex(list[0], list[1]);
+                break;
+            }
+        case CKT_STRING:
+            {
+                result = const_value_make_string_from_values(num_elems, list);
+                break;
+            }
+        case CKT_RANGE:
+            {
+                ERROR_CONDITION(num_elems != 3, "Invalid range constant!", 0);
+
+                result = const_value_make_range(list[0], list[1], list[2]);
+                break;
+            }
+        default:
+            {
+                internal_error("Code unreachable", 0);
+            }
+    }
+
+    return result;
+}
+
+static const_value_t* load_const_value_from_image(sqlite3_uint64 oid)
+{
+    int first = 0, count = 0;
+    if (!module_image_find_rows(_module_image, MIS_CONST_VALUE, oid, &first, &count))
+    {
+        internal_error("Constant value with oid %llu not found\n", oid);
+    }
+
+    // oid, kind, raw_oid, struct_type
+    const char* values[4];
+    module_image_get_row(_module_image, MIS_CONST_VALUE, first, values);
+
+    // Single values have a raw_oid
+    if (values[2] != NULL)
+    {
+        sqlite3_uint64 raw_oid = safe_atoull(values[2]);
+        if (!module_image_find_rows(_module_image, MIS_RAW_CONST_VALUE, raw_oid, &first, &count))
+        {
+            internal_error("Raw constant value with oid %llu not found\n", raw_oid);
+        }
+
+        // raw_bytes
+        const char* raw_bytes[1];
+        module_image_get_row(_module_image, MIS_RAW_CONST_VALUE, first, raw_bytes);
+
+        return const_value_build_from_raw_data(raw_bytes[0]);
+    }
+
+    // Multi values do not have raw_oid
+    int multival_kind = safe_atoi(values[1]);
+    type_t* struct_type = load_type(NULL, safe_atoull(values[3]));
+
+    module_image_find_rows(_module_image, MIS_MULTI_CONST_VALUE, oid, &first, &count);
+
+    const_value_t* list[count + 1];
+    int i;
+    for (i = 0; i < count; i++)
+    {
+        // oid_part
+        const char* part[1];
+        module_image_get_row(_module_image, MIS_MULTI_CONST_VALUE, first + i, part);
+
+        list[i] = load_const_value(NULL, safe_atoull(part[0]));
+    }
+
+    return build_multi_const_value(multival_kind, count, list, struct_type);
+}
+
 static const_value_t* load_const_value(sqlite3* handle, sqlite3_uint64 oid)
 {
     void *p = get_ptr_of_oid(handle, oid);
@@ -2998,6 +3720,14 @@ static const_value_t* load_const_value(sqlite3* handle, sqlite3_uint64 oid)
 
     const_value_t* result = NULL;
 
+    if (_module_image != NULL)
+    {
+        result = load_const_value_from_image(oid);
+        insert_map_ptr(handle, oid, result);
+
+        return result;
+    }
+
     sqlite3_bind_int64(_select_const_value_stmt, 1, oid);
 
     int result_query = sqlite3_step(_select_const_value_stmt);
@@ -3088,47 +3818,7 @@ static const_value_t* load_const_value(sqlite3* handle, sqlite3_uint64 oid)
             }
 
             // Finally build the multi const value
-            switch (multival_kind)
-            {
-                case CKT_ARRAY:
-                    {
-                        result = const_value_make_array(num_elems, list);
-                        break;
-                    }
-                case CKT_VECTOR:
-                    {
-                        result = const_value_make_vector(num_elems, list);
-                        break;
-                    }
-                case CKT_STRUCT:
-                    {
-                        result = const_value_make_struct(num_elems, list, struct_type);
-                        break;
-                    }
-                case CKT_COMPLEX:
-                    {
-                        ERROR_CONDITION(num_elems != 2, "Invalid complex constant!", 0);
-
-                        result = const_value_make_complex(list[0], list[1]);
-                        break;
-                    }
-                case CKT_STRING:
-                    {
-                        result = const_value_make_string_from_values(num_elems, list);
-                        break;
-                    }
-                case CKT_RANGE:
-                    {
-                        ERROR_CONDITION(num_elems != 3, "Invalid range constant!", 0);
-
-                        result = const_value_make_range(list[0], list[1], list[2]);
-                        break;
-                    }
-                default:
-                    {
-                        internal_error("Code unreachable", 0);
-                    }
-            }
+            result = build_multi_const_value(multival_kind, num_elems, list, struct_type);
         }
         else
         {
@@ -3145,7 +3835,7 @@ static const_value_t* load_const_value(sqlite3* handle, sqlite3_uint64 oid)
     return result;
 }
 
-static void dispose_storage(sqlite3* handle)
+static void finalize_statements(void)
 {
     int i;
     for (i = 0; _prepared_statements_registry[i] != NULL; i++)
@@ -3153,6 +3843,11 @@ static void dispose_storage(sqlite3* handle)
         sqlite3_finalize(*(_prepared_statements_registry[i]));
         *(_prepared_statements_registry[i]) = NULL;
     }
+}
+
+static void dispose_storage(sqlite3* handle)
+{
+    finalize_statements();
 
     if (sqlite3_close(handle) != SQLITE_OK)
     {
@@ -3238,6 +3933,18 @@ struct get_module_extra_name_tag
     scope_entry_t* module;
 };
 
+static void add_module_extra_data(scope_entry_t* module, fortran_modules_data_t* module_data)
+{
+    fortran_modules_data_set_t* extra_info_attr = symbol_entity_specs_get_module_extra_info(module);
+    if (extra_info_attr == NULL)
+    {
+        extra_info_attr = NEW0(fortran_modules_data_set_t);
+        symbol_entity_specs_set_module_extra_info(module, extra_info_attr);
+    }
+
+    P_LIST_ADD(extra_info_attr->data, extra_info_attr->num_data, module_data);
+}
+
 static int count_module_extra_name(void *data, 
         int num_columns UNUSED_PARAMETER, 
         char **values, 
@@ -3291,20 +3998,51 @@ static int get_module_extra_name(void *data,
 
     sqlite3_free(query);
 
-    fortran_modules_data_set_t* extra_info_attr = symbol_entity_specs_get_module_extra_info(p->module);
-    if (extra_info_attr == NULL)
+    add_module_extra_data(p->module, module_data);
+
+    return 0;
+}
+
+static void load_extra_data_from_module_image(scope_entry_t* module)
+{
+    int num_names = module_image_num_rows(_module_image, MIS_MODULE_EXTRA_NAME);
+    int i;
+    for (i = 0; i < num_names; i++)
     {
-        extra_info_attr = NEW0(fortran_modules_data_set_t);
-        symbol_entity_specs_set_module_extra_info(p->module, extra_info_attr);
-    }
+        // oid, name
+        const char* values[2];
+        module_image_get_row(_module_image, MIS_MODULE_EXTRA_NAME, i, values);
 
-    P_LIST_ADD(extra_info_attr->data, extra_info_attr->num_data, module_data);
+        sqlite3_uint64 oid_name = safe_atoull(values[0]);
 
-    return 0;
+        int first = 0, num_items = 0;
+        if (!module_image_find_rows(_module_image, MIS_MODULE_EXTRA_DATA, oid_name, &first, &num_items))
+            continue;
+
+        fortran_modules_data_t *module_data = NEW0(fortran_modules_data_t);
+        module_data->name = uniquestr(values[1]);
+        module_data->num_items = num_items;
+        module_data->items = NEW_VEC0(tl_type_t, num_items);
+
+        struct get_module_extra_data_tag extra_data;
+
+        extra_data.handle = NULL;
+        extra_data.current_item = module_data->items;
+
+        run_select_image(MIS_MODULE_EXTRA_DATA, oid_name, get_module_extra_data, &extra_data);
+
+        add_module_extra_data(module, module_data);
+    }
 }
 
 static void load_extra_data_from_module(sqlite3* handle, scope_entry_t* module)
 {
+    if (_module_image != NULL)
+    {
+        load_extra_data_from_module_image(module);
+        return;
+    }
+
     struct get_module_extra_name_tag module_extra_name;
 
     module_extra_name.handle = handle;
@@ -3317,23 +4055,8 @@ static void load_extra_data_from_module(sqlite3* handle, scope_entry_t* module)
     }
 }
 
-void extend_module_info(scope_entry_t* module, const char* domain, int num_items, tl_type_t* info)
+static void insert_module_extra_data(sqlite3* handle, const char* domain, int num_items, tl_type_t* info)
 {
-    ERROR_CONDITION(module->kind != SK_MODULE, "This is not a module!\n", 0);
-
-    const char* module_name = strtolower(module->symbol_name);
-
-    sqlite3* handle = NULL;
-    const char* filename = NULL;
-
-    driver_fortran_register_module(module_name, &filename, 
-            /* is_intrinsic */ symbol_entity_specs_get_is_builtin(module));
-    load_storage(&handle, filename);
-
-    prepare_statements(handle);
-
-    start_transaction(handle);
-
     // Insert domain
     char* insert_domain = sqlite3_mprintf("INSERT OR REPLACE INTO module_extra_name(name) VALUES (" Q ");",  domain);
     run_query(handle, insert_domain);
@@ -3420,14 +4143,381 @@ void extend_module_info(scope_entry_t* module, const char* domain, int num_items
         run_query(handle, query);
         sqlite3_free(query);
     }
+}
+
+// Writes again a module image not written in this compilation, from the
+// symbol of the module, so it is staged and can be extended
+static sqlite3_uint64 rewrite_module_image(sqlite3** handle, const char** filename, scope_entry_t* module)
+{
+    if (CURRENT_CONFIGURATION->verbose)
+    {
+        fprintf(stderr, "Writing module '%s' again to extend it\n", module->symbol_name);
+    }
+
+    // The image will not be read anymore
+    load_all_module_members(module);
+
+    sqlite3_uint64 module_oid = write_module_storage(handle, filename, module);
+
+    // Keep the data of earlier extensions
+    fortran_modules_data_set_t* extra_info_attr = symbol_entity_specs_get_module_extra_info(module);
+    if (extra_info_attr != NULL)
+    {
+        start_transaction(*handle);
+        int i;
+        for (i = 0; i < extra_info_attr->num_data; i++)
+        {
+            insert_module_extra_data(*handle,
+                    extra_info_attr->data[i]->name,
+                    extra_info_attr->data[i]->num_items,
+                    extra_info_attr->data[i]->items);
+        }
+        end_transaction(*handle);
+    }
+
+    finalize_statements();
+
+    return module_oid;
+}
+
+void extend_module_info(scope_entry_t* module, const char* domain, int num_items, tl_type_t* info)
+{
+    ERROR_CONDITION(module->kind != SK_MODULE, "This is not a module!\n", 0);
+
+    const char* module_name = strtolower(module->symbol_name);
+
+    sqlite3* handle = NULL;
+    const char* filename = NULL;
+    sqlite3_uint64 module_oid = 0;
+    char write_image = 0;
+
+    module_cache_flush();
+
+    driver_fortran_register_module(module_name, &filename, 
+            /* is_intrinsic */ symbol_entity_specs_get_is_builtin(module));
+
+    staged_module_t* staged_module = get_staged_module(filename);
+    if (staged_module != NULL)
+    {
+        handle = staged_module->handle;
+        module_oid = staged_module->module_oid;
+        write_image = 1;
+    }
+    else if (module_image_file_is_image(filename))
+    {
+        module_oid = rewrite_module_image(&handle, &filename, module);
+        write_image = CURRENT_CONFIGURATION->fortran_binary_modules;
+    }
+    else
+    {
+        load_storage(&handle, filename);
+    }
+
+    prepare_statements(handle);
+
+    start_transaction(handle);
+
+    insert_module_extra_data(handle, domain, num_items, info);
 
     end_transaction(handle);
 
-    dispose_storage(handle);
+    if (write_image)
+    {
+        write_module_image(handle, filename, module_oid);
+        finalize_statements();
+
+        if (staged_module == NULL)
+            stage_module_storage(filename, handle, module_oid);
+    }
+    else
+    {
+        dispose_storage(handle);
+    }
+}
+
+static uint64_t module_member_name_hash(const char* name)
+{
+    // FNV-1a of the lowercase name
+    uint64_t hash = 14695981039346656037ULL;
+    for (; *name != '\0'; name++)
+    {
+        hash ^= (unsigned char)tolower(*name);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static void export_section(sqlite3* handle, module_image_writer_t* writer,
+        module_image_section_t section, const char* query,
+        char key_is_name)
+{
+    // The first column of the query is the key of the rows, unless
+    // key_is_name where the key is the hash of the first column
+    sqlite3_stmt* stmt = NULL;
+    if (sqlite3_prepare_v2(handle, query, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        internal_error("An error happened while preparing statement '%s' %s\n",
+                query,
+                sqlite3_errmsg(handle));
+    }
+
+    int first_column = key_is_name ? 0 : 1;
+    int ncols = sqlite3_column_count(stmt) - first_column;
+
+    const char* names[ncols + 1];
+    int i;
+    for (i = 0; i < ncols; i++)
+    {
+        names[i] = sqlite3_column_name(stmt, first_column + i);
+    }
+    module_image_writer_begin_section(writer, section, ncols, names);
+
+    int result_query = sqlite3_step(stmt);
+    while (result_query == SQLITE_ROW)
+    {
+        const char* values[ncols + 1];
+        int lengths[ncols + 1];
+        for (i = 0; i < ncols; i++)
+        {
+            switch (sqlite3_column_type(stmt, first_column + i))
+            {
+                case SQLITE_NULL:
+                    {
+                        values[i] = NULL;
+                        lengths[i] = 0;
+                        break;
+                    }
+                case SQLITE_BLOB:
+                    {
+                        values[i] = (const char*)sqlite3_column_blob(stmt, first_column + i);
+                        if (values[i] == NULL)
+                            values[i] = "";
+                        lengths[i] = sqlite3_column_bytes(stmt, first_column + i);
+                        break;
+                    }
+                default:
+                    {
+                        values[i] = (const char*)sqlite3_column_text(stmt, first_column + i);
+                        lengths[i] = sqlite3_column_bytes(stmt, first_column + i);
+                        break;
+                    }
+            }
+        }
+
+        uint64_t key = key_is_name
+            ? module_member_name_hash((const char*)sqlite3_column_text(stmt, 0))
+            : (uint64_t)sqlite3_column_int64(stmt, 0);
+        module_image_writer_add_row(writer, key, values, lengths);
+
+        result_query = sqlite3_step(stmt);
+    }
+
+    if (result_query != SQLITE_DONE)
+    {
+        internal_error("Unexpected error %d when running query '%s'",
+                result_query,
+                sqlite3_errmsg(handle));
+    }
+
+    sqlite3_finalize(stmt);
+}
+
+static void write_module_image(sqlite3* handle, const char* filename, sqlite3_uint64 module_oid)
+{
+    DEBUG_CODE()
+    {
+        fprintf(stderr, "FORTRAN-MODULES: Writing module image '%s'\n", filename);
+    }
+
+    module_image_writer_t* writer = module_image_writer_new();
+
+    // The columns of every section are the same ones the statements in
+    // prepare_statements return, so rows can be handed to the same callbacks
+    export_section(handle, writer, MIS_INFO,
+            "SELECT 0, module, date, version, build, root_symbol FROM info;", 0);
+
+    char* symbol_query = sqlite3_mprintf(
+            "SELECT s.oid, s.oid, decl_context, str1.string AS name, str2.string AS kind, type, str3.string AS file, line,"
+            " value, bit_entity_specs, related_decl_context, %s "
+            "FROM symbol s, string_table str1, string_table str2, string_table str3 "
+            "WHERE str1.oid = s.name AND str2.oid = s.kind AND str3.oid = s.file;",
+            attr_field_names);
+    export_section(handle, writer, MIS_SYMBOL, symbol_query, 0);
+    sqlite3_free(symbol_query);
+
+    export_section(handle, writer, MIS_ATTRIBUTES,
+            "SELECT a.symbol, str.string AS name, a.value FROM attributes a, string_table str "
+            "WHERE a.name = str.oid ORDER BY a.symbol, a.oid;", 0);
+    export_section(handle, writer, MIS_SCOPE,
+            "SELECT oid, oid, kind, contained_in, related_entry FROM scope;", 0);
+    export_section(handle, writer, MIS_DECL_CONTEXT,
+            "SELECT oid, oid, " DECL_CONTEXT_FIELDS " FROM decl_context;", 0);
+    export_section(handle, writer, MIS_AST,
+            "SELECT a.oid, a.oid, str0.string AS kind, str1.string AS file, a.line, str2.string AS text, "
+            "a.ast0, a.ast1, a.ast2, a.ast3, a.type, a.symbol, a.is_lvalue, a.is_const_val, a.const_val, a.is_value_dependent "
+            "FROM ast a, string_table str0, string_table str1, string_table str2 "
+            "WHERE a.kind = str0.oid AND a.file = str1.oid AND a.text = str2.oid;", 0);
+    export_section(handle, writer, MIS_TYPE,
+            "SELECT oid, oid, kind, cv_qualifier, kind_size, ast0, ast1, ref_type, types, symbols FROM type;", 0);
+    export_section(handle, writer, MIS_CONST_VALUE,
+            "SELECT c.oid, c.oid, c.kind, c.raw_oid, c.struct_type FROM const_value c;", 0);
+    export_section(handle, writer, MIS_RAW_CONST_VALUE,
+            "SELECT r.oid, r.raw_bytes FROM raw_const_value r;", 0);
+    export_section(handle, writer, MIS_MULTI_CONST_VALUE,
+            "SELECT oid_object, oid_part FROM multi_const_value ORDER BY oid;", 0);
+    export_section(handle, writer, MIS_MODULE_EXTRA_NAME,
+            "SELECT 0, oid, name FROM module_extra_name ORDER BY oid;", 0);
+    export_section(handle, writer, MIS_MODULE_EXTRA_DATA,
+            "SELECT oid_name, kind, value FROM module_extra_data ORDER BY oid_name, order_;", 0);
+
+    // Members of the module by name
+    char* name_index_query = sqlite3_mprintf(
+            "SELECT str.string AS name, a.value AS oid "
+            "FROM attributes a, string_table attr_name, symbol s, string_table str "
+            "WHERE a.symbol = %llu AND a.name = attr_name.oid AND attr_name.string = 'related_symbols' "
+            "AND s.oid = a.value AND str.oid = s.name ORDER BY a.oid;",
+            module_oid);
+    export_section(handle, writer, MIS_NAME_INDEX, name_index_query, /* key_is_name */ 1);
+    sqlite3_free(name_index_query);
+
+    // Modules referenced by this one (and itself)
+    char* module_index_query = sqlite3_mprintf(
+            "SELECT 0, str1.string AS name FROM symbol s, string_table str1, string_table str2 "
+            "WHERE str1.oid = s.name AND str2.oid = s.kind AND str2.string = " Q ";",
+            symbol_kind_to_str(SK_MODULE));
+    export_section(handle, writer, MIS_MODULE_INDEX, module_index_query, 0);
+    sqlite3_free(module_index_query);
+
+    module_image_writer_write(writer, filename);
+}
+
+static lazy_module_t* get_lazy_module(scope_entry_t* module)
+{
+    int i;
+    for (i = 0; i < _num_lazy_modules; i++)
+    {
+        if (_lazy_modules[i]->module == module)
+            return _lazy_modules[i];
+    }
+    return NULL;
+}
+
+typedef
+struct module_image_state_tag
+{
+    module_image_t* image;
+    rb_red_blk_tree* oid_map;
+    sqlite3_uint64 module_oid_being_loaded;
+    char loading_shared_module;
+    mem_arena_t* ast_arena;
+} module_image_state_t;
+
+static void enter_lazy_module(lazy_module_t* lazy_module, module_image_state_t* saved_state)
+{
+    saved_state->image = _module_image;
+    saved_state->oid_map = _oid_map;
+    saved_state->module_oid_being_loaded = module_oid_being_loaded;
+    saved_state->loading_shared_module = _loading_shared_module;
+    saved_state->ast_arena = ast_get_current_arena();
+
+    _module_image = lazy_module->image;
+    _oid_map = lazy_module->oid_map;
+    module_oid_being_loaded = 0;
+    _loading_shared_module = lazy_module->shared;
+    if (module_cache_is_enabled())
+        ast_set_current_arena(NULL);
+}
+
+static void leave_lazy_module(module_image_state_t* saved_state)
+{
+    _module_image = saved_state->image;
+    _oid_map = saved_state->oid_map;
+    module_oid_being_loaded = saved_state->module_oid_being_loaded;
+    _loading_shared_module = saved_state->loading_shared_module;
+    ast_set_current_arena(saved_state->ast_arena);
+}
+
+void load_module_members_by_name(scope_entry_t* module, const char* name)
+{
+    lazy_module_t* lazy_module = get_lazy_module(module);
+    // If we are reading the image of the module (e.g. a member refers to
+    // another one) its members are loaded through their oids
+    if (lazy_module == NULL
+            || lazy_module->image == _module_image)
+        return;
+
+    module_image_state_t saved_state;
+    enter_lazy_module(lazy_module, &saved_state);
+
+    uint64_t key = module_member_name_hash(name);
+
+    int first = 0, count = 0;
+    module_image_find_rows(_module_image, MIS_NAME_INDEX, key, &first, &count);
+
+    int i;
+    for (i = first; i < first + count; i++)
+    {
+        // name, oid
+        const char* values[2];
+        module_image_get_row(_module_image, MIS_NAME_INDEX, i, values);
+
+        if (strcasecmp(values[0], name) != 0)
+            continue;
+
+        scope_entry_t* member = load_symbol(NULL, safe_atoull(values[1]));
+        symbol_entity_specs_insert_related_symbols(module, member);
+    }
+
+    leave_lazy_module(&saved_state);
+}
+
+void load_all_module_members(scope_entry_t* module)
+{
+    lazy_module_t* lazy_module = get_lazy_module(module);
+    if (lazy_module == NULL
+            || lazy_module->image == _module_image)
+        return;
+
+    module_image_state_t saved_state;
+    enter_lazy_module(lazy_module, &saved_state);
+
+    // Do what get_extra_attributes would have done when loading the module
+    extra_syms_t extra_syms;
+    memset(&extra_syms, 0, sizeof(extra_syms));
+
+    int first = 0, count = 0;
+    module_image_find_rows(_module_image, MIS_ATTRIBUTES, lazy_module->module_oid, &first, &count);
+
+    int i;
+    for (i = first; i < first + count; i++)
+    {
+        // name, value
+        const char* values[2];
+        module_image_get_row(_module_image, MIS_ATTRIBUTES, i, values);
+
+        if (strcmp(values[0], "related_symbols") == 0)
+        {
+            get_extra_syms(&extra_syms, 1, (char**)(values + 1), NULL);
+        }
+    }
+
+    for (i = 0; i < extra_syms.num_syms; i++)
+    {
+        symbol_entity_specs_append_related_symbols(module, extra_syms.syms[i]);
+    }
+    DELETE(extra_syms.syms);
+
+    leave_lazy_module(&saved_state);
+
+    // Nothing else will be loaded from this image
+    P_LIST_REMOVE(_lazy_modules, _num_lazy_modules, lazy_module);
+    module_image_close(lazy_module->image);
+    DELETE(lazy_module);
 }
 
 scope_entry_t* get_module_in_cache(const char* module_name)
 {
+    fortran_sign_in_intrinsic_module_on_demand(module_name);
     rb_red_blk_node* query = rb_tree_query(CURRENT_COMPILED_FILE->module_file_cache, module_name);
     ERROR_CONDITION(query == NULL, "Module '%s' has not been registered", module_name);
     scope_entry_t* module_sym = (scope_entry_t*)rb_node_get_info(query);
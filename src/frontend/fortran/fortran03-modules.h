@@ -37,6 +37,10 @@ void load_module_info(const char* module_name, scope_entry_t** module);
 
 scope_entry_t* get_module_in_cache(const char* module_name);
 
+// Members of modules loaded from an image are only loaded when needed
+void load_module_members_by_name(scope_entry_t* module, const char* name);
+void load_all_module_members(scope_entry_t* module);
+
 // This is used in TL
 void extend_module_info(scope_entry_t* module, const char* domain, int num_items, tl_type_t* info);
 
@@ -2047,7 +2047,16 @@ static int commit_text(int token_id, const char* str,
     lexer_state.bol = 0;
 
     mf03lval.token_atrib.token_text = uniquestr(str);
-    mf03lloc.first_filename = loc.filename;
+    // Filenames of the scanner are never released, so the file id of the
+    // last one can be reused without hashing it again
+    static const char* last_filename = NULL;
+    static unsigned int last_file_id = 0;
+    if (loc.filename != last_filename)
+    {
+        last_filename = loc.filename;
+        last_file_id = locus_file_id(loc.filename);
+    }
+    mf03lloc.first_file_id = last_file_id;
     mf03lloc.first_line = loc.line;
     mf03lloc.first_column = loc.column;
 
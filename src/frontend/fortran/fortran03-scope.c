@@ -34,6 +34,7 @@
 #include "fortran03-buildscope.h"
 #include "fortran03-typeutils.h"
 #include "fortran03-intrinsics.h"
+#include "fortran03-modules.h"
 #include <string.h>
 #include <ctype.h>
 
@@ -458,6 +459,11 @@ scope_entry_t* fortran_query_intrinsic_name_str(const decl_context_t* decl_conte
     const decl_context_t* global_context = fortran_get_context_of_intrinsics(decl_context);
 
     scope_entry_list_t* global_list = query_in_scope_str(global_context, strtolower(unqualified_name), NULL);
+    if (global_list == NULL
+            && fortran_sign_in_intrinsic_on_demand(global_context, strtolower(unqualified_name)))
+    {
+        global_list = query_in_scope_str(global_context, strtolower(unqualified_name), NULL);
+    }
 
     scope_entry_list_t* result_list = filter_symbol_using_predicate(global_list,
             symbol_is_intrinsic_function_not_from_module, NULL);
@@ -697,6 +703,8 @@ scope_entry_list_t* fortran_query_module_for_name(scope_entry_t* module_symbol,
             || module_symbol->kind != SK_MODULE, "Invalid symbol", 0);
     ERROR_CONDITION(name == NULL, "Invalid name", 0);
 
+    load_module_members_by_name(module_symbol, name);
+
     scope_entry_list_t* result = NULL;
     int i;
     for (i = 0; i < symbol_entity_specs_get_num_related_symbols(module_symbol); i++)
@@ -5607,6 +5607,8 @@ void CxxBase::define_class_symbol_using_member_declarations_aux(TL::Symbol symbo
                     (*file) << ";\n";
                 }
 
+                // Members whose definition was deferred and never referenced
+                // (--lazy-inline-bodies) do not have code and are declared
                 if (!member.get_function_code().is_null()
                         && member.is_defined_inside_class()
                         // Do not emit the empty bodies of defaulted functions
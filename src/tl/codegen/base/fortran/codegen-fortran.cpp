@@ -31,6 +31,7 @@
 #include "fortran03-exprtype.h"
 #include "fortran03-typeutils.h"
 #include "fortran03-cexpr.h"
+#include "fortran03-modules.h"
 #include "tl-compilerpipeline.hpp"
 #include "tl-source.hpp"
 #include "cxx-cexpr.h"
@@ -5480,6 +5481,9 @@ OPERATOR_TABLE
 
     bool FortranBase::symbol_is_public_in_module(TL::Symbol current_module, TL::Symbol entry)
     {
+        // Members of a module loaded from an image may not be loaded yet
+        load_all_module_members(current_module.get_internal_symbol());
+
         TL::ObjectList<TL::Symbol> module_symbols = current_module.get_related_symbols();
 
         for (TL::ObjectList<TL::Symbol>::iterator it = module_symbols.begin();
@@ -5665,6 +5669,7 @@ OPERATOR_TABLE
         use_stmt_info.add_item(module, entry);
 
         // Mark all symbols of this module that have the same name as defined too
+        load_module_members_by_name(module.get_internal_symbol(), entry.get_name().c_str());
         TL::ObjectList<TL::Symbol> symbols_in_module = module.get_related_symbols();
         for (TL::ObjectList<TL::Symbol>::iterator it = symbols_in_module.begin();
                 it != symbols_in_module.end();
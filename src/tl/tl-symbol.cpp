@@ -31,6 +31,7 @@
 #include "tl-scope.hpp"
 #include "tl-type.hpp"
 #include "tl-nodecl.hpp"
+#include "cxx-buildscope.h"
 
 namespace TL
 {
@@ -1040,6 +1041,14 @@ namespace TL
         return symbol_entity_specs_get_function_code(_symbol);
     }
 
+    Nodecl::NodeclBase Symbol::define_deferred_function() const
+    {
+        if (nodecl_is_null(symbol_entity_specs_get_function_code(_symbol)))
+            build_scope_define_deferred_function(_symbol);
+
+        return symbol_entity_specs_get_function_code(_symbol);
+    }
+
     bool Symbol::is_bind_c() const
     {
         Nodecl::NodeclBase n( symbol_entity_specs_get_bind_info(_symbol) );
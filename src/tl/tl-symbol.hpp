@@ -744,6 +744,15 @@ namespace TL
             Nodecl::NodeclBase get_default_argument_num(int i) const;
             Nodecl::NodeclBase get_function_code() const;
 
+            /*!
+             * Analyzes the body of this function if it was deferred by
+             * --lazy-inline-bodies and returns its code
+             *
+             * get_function_code returns a null node for such functions
+             * until they are defined
+             */
+            Nodecl::NodeclBase define_deferred_function() const;
+
             //! States whether this symbol is BIND(C)
             bool is_bind_c() const;
             
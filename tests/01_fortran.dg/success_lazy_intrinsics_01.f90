@@ -0,0 +1,38 @@
+! <testinfo>
+! test_generator=config/mercurium-fortran
+! </testinfo>
+SUBROUTINE S1(X, D, C)
+    IMPLICIT NONE
+    REAL :: X
+    DOUBLE PRECISION :: D
+    COMPLEX :: C
+    INTEGER :: N
+
+    ! Specific names used before their generic names
+    X = ALOG(X) + CABS(C)
+    D = DSQRT(D) + DABS(D)
+    X = ABS(X) + SQRT(X) + LOG(X)
+    ! Custom intrinsics
+    X = SNGL(D)
+    N = IARGC()
+END SUBROUTINE S1
+
+SUBROUTINE S2(X)
+    ! IEEE_ARITHMETIC reexports the names of IEEE_EXCEPTIONS
+    USE, INTRINSIC :: IEEE_ARITHMETIC
+    IMPLICIT NONE
+    REAL :: X
+    LOGICAL :: L
+
+    L = IEEE_IS_NAN(X)
+    CALL IEEE_GET_FLAG(IEEE_OVERFLOW, L)
+END SUBROUTINE S2
+
+SUBROUTINE S3(P)
+    USE, INTRINSIC :: ISO_C_BINDING, ONLY : C_PTR, C_ASSOCIATED
+    IMPLICIT NONE
+    TYPE(C_PTR) :: P
+    LOGICAL :: L
+
+    L = C_ASSOCIATED(P)
+END SUBROUTINE S3
@@ -0,0 +1,45 @@
+/*
+<testinfo>
+test_generator="config/mercurium"
+test_CXXFLAGS="--lazy-inline-bodies"
+</testinfo>
+*/
+
+# 1 "success_639-header.h" 1
+struct A
+{
+    int x;
+    A() : x(1) { }
+    ~A() { x = 0; }
+
+    int get() const { return x; }
+    int unused() const { return x + 42; }
+    static int twice(int y) { return 2 * y; }
+};
+
+inline int add(int a, int b) { return a + b; }
+inline int sub(int a, int b) { return a - b; }
+inline int never_called(int a) { return add(a, a); }
+
+static inline int square(int a) { return a * a; }
+static int (*const p_square)(int) = square;
+# 29 "success_639.cpp" 2
+
+int main(int, char**)
+{
+    A a;
+    if (a.get() != 1)
+        __builtin_abort();
+
+    if (add(A::twice(2), 1) != 5)
+        __builtin_abort();
+
+    int (*p)(int, int) = &sub;
+    if (p(3, 2) != 1)
+        __builtin_abort();
+
+    if (p_square(3) != 9)
+        __builtin_abort();
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+/*
+<testinfo>
+test_generator="config/mercurium"
+</testinfo>
+*/
+
+template <typename T, typename Q>
+struct SameType;
+
+template <typename T>
+struct SameType<T, T> { };
+
+struct Base
+{
+    int x;
+    static float s;
+    typedef char type;
+};
+
+struct L : virtual Base { };
+struct R : virtual Base { };
+struct NL : Base { };
+struct NR : Base { };
+
+struct Diamond : L, R { };
+struct Repeated : NL, NR { };
+
+template <typename Derived, typename T>
+struct Mixin
+{
+    T value;
+    T get() const { return value; }
+};
+
+struct M1 : Mixin<M1, int> { };
+struct M2 : M1 { };
+struct M3 : M2 { };
+
+void f(Diamond& d, Repeated& r, M3& m)
+{
+    // Same shared subobject
+    d.x = 1;
+    d.x = 2;
+    SameType<int, __typeof__(d.x)>();
+
+    // Static members and types are fine in several subobjects
+    r.s = 1.0f;
+    r.s = 2.0f;
+    SameType<float, __typeof__(r.s)>();
+    SameType<char, Repeated::type>();
+    SameType<char, Repeated::type>();
+
+    SameType<int, __typeof__(m.get())>();
+    SameType<int, __typeof__(m.get())>();
+    SameType<int, __typeof__(m.value)>();
+
+    // Lookups in the complete class both before and after its implicit
+    // members are declared
+    M3 m2(m);
+    m2 = m;
+    SameType<int, __typeof__(m2.get())>();
+}
@@ -0,0 +1,79 @@
+/*
+<testinfo>
+test_generator="config/mercurium-cxx11"
+test_CXXFLAGS="--lazy-implicit-members"
+test_nolink=yes
+</testinfo>
+*/
+
+template <typename T, typename Q>
+struct SameType;
+
+template <typename T>
+struct SameType<T, T> { };
+
+struct Unused
+{
+    int x;
+    float y;
+};
+
+struct A
+{
+    int x;
+};
+
+struct B : A
+{
+    A a;
+};
+
+struct C
+{
+    C(int);
+};
+
+struct D
+{
+    C c;
+    virtual ~D() { }
+};
+
+struct E : D
+{
+};
+
+template <typename T>
+struct Wrap
+{
+    T t;
+};
+
+void f(A& a1, const A& a2, B& b1, B&& b2, const E& e)
+{
+    A a3;
+    A a4(a2);
+    A a5(static_cast<A&&>(a1));
+    a1 = a2;
+    a1 = static_cast<A&&>(a3);
+
+    B b3(b1);
+    B b4(static_cast<B&&>(b2));
+    b1 = b3;
+
+    SameType<A&, decltype(a1 = a2)>();
+    SameType<B&, decltype(b1 = b4)>();
+
+    E e2(e);
+
+    Wrap<A> w1;
+    Wrap<A> w2(w1);
+    w2 = w1;
+
+    a3.~A();
+    b3.B::~B();
+}
+
+static_assert(!__has_trivial_constructor(D), "D has a member without default constructor");
+static_assert(__has_virtual_destructor(E), "E inherits a virtual destructor");
+static_assert(__has_trivial_copy(A), "A has a trivial copy constructor");
@@ -0,0 +1,63 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+/*
+<testinfo>
+test_generator=config/mercurium
+compile_versions="store hit"
+cache_dir=$(mktemp -d)
+test_CFLAGS_store="--cache-dir=${cache_dir} -o cache_store.o"
+test_CFLAGS_hit="--cache-dir=${cache_dir} -o cache_hit.o"
+test_CC_hit=compile_from_cache
+compile_from_cache()
+{
+    ${test_CC} "$@" > cache_hit.log 2>&1
+    local result=$?
+    cat cache_hit.log
+    if [ $result -eq 0 ]; then
+        grep -q "found in the compilation cache" cache_hit.log && cmp cache_store.o cache_hit.o
+        result=$?
+    fi
+    rm -rf "${cache_dir}"
+    return $result
+}
+</testinfo>
+*/
+
+// The second compilation of this file must be restored from the cache
+// filled by the first one, with the same object
+struct A
+{
+    int x;
+    float y;
+};
+
+int f(struct A* a)
+{
+    return a->x + (int)a->y;
+}
@@ -0,0 +1,69 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+/*
+<testinfo>
+test_generator=config/mercurium
+export test_nolink=no
+compile_versions="pipes jobs native_jobs"
+test_CFLAGS_pipes="--pipes"
+test_CFLAGS_jobs="-j 2"
+test_CFLAGS_native_jobs="--native-jobs=2"
+test_CC_pipes=compile_several_files
+test_CC_jobs=compile_several_files
+test_CC_native_jobs=compile_several_files
+compile_several_files()
+{
+    printf "static int k = 1;\nint g(int x)\n{\n    return x + k;\n}\n" > several_files_g.c
+    printf "static int k = 2;\nint h(int x)\n{\n    return x * k;\n}\n" > several_files_h.c
+    ${test_CC} "$@" several_files_g.c several_files_h.c
+    local result=$?
+    rm -f several_files_g.c several_files_h.c
+    return $result
+}
+</testinfo>
+*/
+
+// This file is compiled and linked along with two more translation units,
+// several_files_g.c and several_files_h.c, created by the test itself
+#include <stdlib.h>
+
+int g(int);
+int h(int);
+
+static int k = 3;
+
+int main(int argc, char* argv[])
+{
+    if (g(k) != 4)
+        abort();
+    if (h(k) != 6)
+        abort();
+
+    return 0;
+}
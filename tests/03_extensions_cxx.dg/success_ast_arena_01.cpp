@@ -0,0 +1,66 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+/*
+<testinfo>
+test_generator=config/mercurium
+test_CXXFLAGS="--ast-arena"
+</testinfo>
+*/
+
+// Ambiguities, template instantiation and cached constant trees are created
+// while the arena of the translation unit is active
+template <typename T, int N>
+struct A
+{
+    T v[N];
+
+    T get(int i) const { return v[i]; }
+};
+
+struct B
+{
+    B(int);
+};
+
+int f(int);
+
+void g()
+{
+    A<int, 10> a;
+    A<float, 10> b;
+    int c[10];
+
+    int k = a.get(3) + (int)b.get(4) + c[2];
+
+    B b2(k);
+
+    // Ambiguous statements
+    f(k);
+    int s = sizeof(c);
+}
@@ -0,0 +1,54 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+/*
+<testinfo>
+test_generator=config/mercurium
+test_CXXFLAGS="--ast-arena ${srcdir}/${source}"
+</testinfo>
+*/
+
+// This file is compiled twice in the same invocation, so the second
+// translation unit uses the array types created by the first one
+template <typename T, int N>
+struct A
+{
+    T v[N];
+
+    int size() const { return sizeof(v) / sizeof(v[0]); }
+};
+
+const char* s = "hello";
+
+int f(int n)
+{
+    A<int, 10> a;
+    int c[10];
+    char d[sizeof("hello")];
+    int e[n];
+
+    return a.size() + sizeof(c) + sizeof(d) + sizeof(e);
+}